@@ -1,4 +1,4 @@
-# Copyright (C) 2023 by Arm Limited
+# Copyright (C) 2023-2025 by Arm Limited
 #
 # SPDX-License-Identifier: BSD-3-Clause
 
@@ -14,6 +14,7 @@ class DataStorageBackend(str, Enum):
     CIRCULAR_RAM_BUFFER = "circular"
     ITM_INTERFACE = "itm_interface"
     LINEAR_RAM_BUFFER = "linear"
+    PER_CORE_RAM_BUFFER = "per_core"
     STM_INTERFACE = "stm_interface"
 
     def get_define_constant(self):
@@ -21,6 +22,8 @@ class DataStorageBackend(str, Enum):
             return 'BM_CONFIG_USE_DATASTORE_CIRCULAR_RAM_BUFFER'
         elif self == DataStorageBackend.LINEAR_RAM_BUFFER:
             return 'BM_CONFIG_USE_DATASTORE_LINEAR_RAM_BUFFER'
+        elif self == DataStorageBackend.PER_CORE_RAM_BUFFER:
+            return 'BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER'
         elif self == DataStorageBackend.ITM_INTERFACE:
             return 'BM_CONFIG_USE_DATASTORE_ITM'
         elif self == DataStorageBackend.STM_INTERFACE:
@@ -39,6 +42,11 @@ class DataStorageBackend(str, Enum):
                 '#if BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_LINEAR_RAM_BUFFER\n' + \
                 '#include "data-store/barman-linear-ram-buffer.c"\n' + \
                 '#endif\n\n'
+        elif self == DataStorageBackend.PER_CORE_RAM_BUFFER:
+            return \
+                '#if BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER\n' + \
+                '#include "data-store/barman-per-core-ram-buffer.c"\n' + \
+                '#endif\n\n'
         elif self == DataStorageBackend.ITM_INTERFACE:
             return \
                 '#if BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_ITM\n' + \
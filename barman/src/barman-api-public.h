@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2023 by Arm Limited. */
+/* Copyright (C) 2016-2025 by Arm Limited. */
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 /** @file */
@@ -58,7 +58,7 @@ enum bm_task_switch_reason
  *          If BM_CONFIG_MAX_MMAP_LAYOUTS <= 0, then `num_mmap_entries` and `mmap_entries` are not present.
  */
 BM_PUBLIC_FUNCTION
-#if (BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_LINEAR_RAM_BUFFER) || (BM_CONFIG_USE_DATASTORE ==  BM_CONFIG_USE_DATASTORE_CIRCULAR_RAM_BUFFER) || ((BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_USER_SUPPLIED) && BM_CONFIG_DATASTORE_USER_SUPPLIED_IS_IN_MEMORY)
+#if (BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_LINEAR_RAM_BUFFER) || (BM_CONFIG_USE_DATASTORE ==  BM_CONFIG_USE_DATASTORE_CIRCULAR_RAM_BUFFER) || (BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER) || ((BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_USER_SUPPLIED) && BM_CONFIG_DATASTORE_USER_SUPPLIED_IS_IN_MEMORY)
 bm_bool barman_initialize(bm_uint8 * buffer, bm_uintptr buffer_length,
 #elif BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_STM
 bm_bool barman_initialize_with_stm_interface(void * stm_configuration_registers, void * stm_extended_stimulus_ports,
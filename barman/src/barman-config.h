@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2023 by Arm Limited. */
+/* Copyright (C) 2016-2025 by Arm Limited. */
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 /** @file */
@@ -76,6 +76,8 @@
 #define BM_CONFIG_USE_DATASTORE_STREAMING_USER_SUPPLIED   4
 /** Value to define {@link BM_CONFIG_USE_DATASTORE} as if the ITM interface is used as the data store */
 #define BM_CONFIG_USE_DATASTORE_ITM 5
+/** Value to define {@link BM_CONFIG_USE_DATASTORE} as if the ram buffer is split into a linear region per core */
+#define BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER       6
 
 /**
  * @def     BM_CONFIG_USE_DATASTORE
@@ -130,6 +132,29 @@
 #define BM_CONFIG_MIN_SAMPLE_PERIOD                 0
 #endif
 
+/**
+ * @def     BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+ * @brief   When set true, samples are written as compact records, where the timestamp and counter values are stored
+ *          as variable length deltas from the previous sample on the same core, rather than as full width values.
+ * @details Reduces the space used per sample considerably, at the cost of some extra work when writing the sample.
+ *          Requires a version of Streamline that supports protocol version 4.
+ */
+#ifndef BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+#define BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS        0
+#endif
+
+/**
+ * @def     BM_CONFIG_COMPACT_SAMPLE_KEY_INTERVAL
+ * @brief   How often a compact sample stores absolute values rather than deltas.
+ * @details The number of compact sample records written on a core between each one that stores absolute values, so that
+ *          the samples can still be decoded after older records are overwritten (e.g. by the circular ram buffer).
+ *          If zero, only the first sample on each core stores absolute values.
+ *          Ignored unless {@link BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS} is set.
+ */
+#ifndef BM_CONFIG_COMPACT_SAMPLE_KEY_INTERVAL
+#define BM_CONFIG_COMPACT_SAMPLE_KEY_INTERVAL       64
+#endif
+
 /**
  * @def     BM_CONFIG_RECORDS_PER_HEADER_SENT
  * @brief   How often a header should be sent.
@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2023 by Arm Limited. */
+/* Copyright (C) 2016-2025 by Arm Limited. */
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 /** @file */
@@ -17,7 +17,7 @@
  */
 extern bm_bool barman_generated_initialize(void);
 
-#if (BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_LINEAR_RAM_BUFFER) || (BM_CONFIG_USE_DATASTORE ==  BM_CONFIG_USE_DATASTORE_CIRCULAR_RAM_BUFFER) || ((BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_USER_SUPPLIED) && BM_DATASTORE_IS_IN_MEMORY)
+#if (BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_LINEAR_RAM_BUFFER) || (BM_CONFIG_USE_DATASTORE ==  BM_CONFIG_USE_DATASTORE_CIRCULAR_RAM_BUFFER) || (BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER) || ((BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_USER_SUPPLIED) && BM_DATASTORE_IS_IN_MEMORY)
 bm_bool barman_initialize(bm_uint8 * buffer, bm_uintptr buffer_length,
 #elif BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_STM
 bm_bool barman_initialize_with_stm_interface(void * stm_configuration_registers, void * stm_extended_stimulus_ports,
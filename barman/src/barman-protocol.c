@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2023 by Arm Limited. */
+/* Copyright (C) 2016-2025 by Arm Limited. */
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 /** @file */
@@ -30,6 +30,13 @@
 #   define barman_datastore_commit_block(core, block_pointer)   barman_circular_ram_buffer_commit_block(core, block_pointer)
 #   define barman_datastore_close()                             barman_circular_ram_buffer_close()
 #   define barman_datastore_notify_header_updated(timestamp, header, length)    barman_cache_clean(header, length)
+#elif BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER
+#   include "data-store/barman-per-core-ram-buffer.h"
+#   define barman_datastore_initialize(header_data)             barman_per_core_ram_buffer_initialize(header_data)
+#   define barman_datastore_get_block(core, length)             barman_per_core_ram_buffer_get_block(core, length)
+#   define barman_datastore_commit_block(core, block_pointer)   barman_per_core_ram_buffer_commit_block(core, block_pointer)
+#   define barman_datastore_close()                             barman_per_core_ram_buffer_close()
+#   define barman_datastore_notify_header_updated(timestamp, header, length)    barman_cache_clean(header, length)
 #elif BM_DATASTORE_USES_STREAMING_INTERFACE
 #   include "data-store/barman-streaming-interface.h"
 #   define barman_datastore_initialize(config)                  barman_streaming_interface_initialize(config)
@@ -80,8 +87,15 @@
  *                      WFI records and textual annotations.
  *          3           Release in Streamline 6.3; forwards compatible extension from 2 adding
  *                      PC sample, event counter without task ID and warning records (not currently used by barman, only by streamline).
+ *          4           Forwards compatible extension from 3 adding compact sample records. Only written when
+ *                      BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS is set, so that older versions of Streamline can still read
+ *                      the data otherwise.
  */
+#if BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+#define BM_PROTOCOL_VERSION             4
+#else
 #define BM_PROTOCOL_VERSION             3
+#endif
 
 /** @brief  String table length */
 #define BM_PROTOCOL_STRING_TABLE_LENGTH 1024
@@ -285,7 +299,8 @@ enum bm_protocol_record_types
     BM_PROTOCOL_RECORD_HALT_EVENT = 6,                     /**< Halting event (WFI/WFE) */
     BM_PROTOCOL_RECORD_PC_WITHOUT_TASK_ID = 7,             /**< PC sample that doesn't have a task ID regardless of BM_MAX_TASK_INFOS */
     BM_PROTOCOL_RECORD_EVENT_COUNTER_WITHOUT_TASK_ID = 8,  /**< Counter value that doesn't have a task ID regardless of BM_MAX_TASK_INFOS */
-    BM_PROTOCOL_RECORD_WARNING = 9                         /**< Warning for streamline to interpret */
+    BM_PROTOCOL_RECORD_WARNING = 9,                        /**< Warning for streamline to interpret */
+    BM_PROTOCOL_RECORD_COMPACT_SAMPLE = 10                 /**< Counter sample, delta encoded (see {@link bm_protocol_compact_sample_state}) */
 };
 
 /**
@@ -416,6 +431,58 @@ struct bm_protocol_annotation_record
     bm_uint8 type;
 }BM_PACKED_TYPE;
 
+#if BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+
+/**
+ * @brief   The previous compact sample written for some core, that the next compact sample for that core is relative to.
+ * @details A compact sample record has no {@link bm_protocol_record_header}, so that small samples fit in a fraction of
+ *          the space. It is a byte stream in which every value except the first two bytes is an unsigned LEB128 varint:
+ *
+ *          - The record type, as a single byte (BM_PROTOCOL_RECORD_COMPACT_SAMPLE). This never matches the first byte
+ *            of a record header, which in either endianness is the record type (< 10) or zero.
+ *          - The flags byte; a combination of BM_PROTOCOL_COMPACT_SAMPLE_FLAG_*.
+ *          - The core number.
+ *          - The timestamp. For a key sample this is the absolute value, otherwise the difference from the previous
+ *            sample on the same core.
+ *          - The task id (only if BM_CONFIG_MAX_TASK_INFOS > 0).
+ *          - The PC (only if BM_PROTOCOL_COMPACT_SAMPLE_FLAG_HAS_PC is set).
+ *          - The number of counter values, followed by each counter value. For a key sample these are the absolute
+ *            values, otherwise the zigzag encoded difference from the same counter in the previous sample on the same
+ *            core, modulo 2^64.
+ *          - The number of custom counter values, followed by each custom counter id and absolute value
+ *            (only if BM_NUM_CUSTOM_COUNTERS > 0).
+ *
+ *          A sample can interrupt another sample being written on the same core (e.g. a sample taken from a periodic
+ *          interrupt handler while the application is taking one), so each core has an in-use flag. A nested sample
+ *          that finds it set is written as a key sample with BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_NESTED set, and does
+ *          not update this state, so later deltas are never relative to it.
+ */
+struct bm_protocol_compact_sample_state
+{
+    /** The timestamp of the previous sample */
+    bm_uint64 timestamp;
+    /** The counter values of the previous sample */
+    bm_uint64 counter_values[BM_MAX_PMU_COUNTERS];
+    /** The number of counter values in the previous sample */
+    bm_uint32 num_counters;
+    /** The number of samples written since (and including) the last key sample, or zero if there has been none */
+    bm_uint32 samples_since_key;
+    /** Set while a sample on the core is using this state */
+    bm_atomic_bool in_use;
+};
+
+/** Set in the flags of a compact sample that includes a PC value */
+#define BM_PROTOCOL_COMPACT_SAMPLE_FLAG_HAS_PC      0x01u
+/** Set in the flags of a compact sample that stores absolute values rather than deltas */
+#define BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_KEY      0x02u
+/** Set in the flags of a key sample that interrupted another sample on the same core; later deltas are not relative to it */
+#define BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_NESTED   0x04u
+
+/** The previous compact sample for each core */
+static struct bm_protocol_compact_sample_state bm_protocol_compact_sample_states[BM_CONFIG_MAX_CORES];
+
+#endif
+
 /* *************************************** */
 
 #if BM_DATASTORE_IS_IN_MEMORY
@@ -655,17 +722,15 @@ static BM_INLINE void barman_protocol_fill_mmap_record(struct bm_protocol_header
 #endif
 
 /**
- * @brief   Get a block and fill the record header
+ * @brief   Get a block for a record
  * @param   length          The length of the block to get
- * @param   timestamp       The timestamp to put in the header
- * @param   core            The core number to put in the header
- * @param   record_type     The record type to put in the header
+ * @param   core            The core number the record is for
+ * @param   timestamp       The timestamp of the record
  * @return  Pointer to the block, BM_NULL if failure
  */
-static bm_uint8 * barman_protocol_get_block_and_fill_header(bm_datastore_block_length length, bm_uint32 core, enum bm_protocol_record_types record_type, bm_uint64 timestamp)
+static bm_uint8 * barman_protocol_get_block(bm_datastore_block_length length, bm_uint32 core, bm_uint64 timestamp)
 {
     struct bm_protocol_header * const header_ptr = bm_protocol_header();
-    bm_uint8 * block;
 
     /* validate has header configured */
     if ((header_ptr == BM_NULL) || (header_ptr->magic_bytes != BM_PROTOCOL_MAGIC_BYTES)) {
@@ -683,7 +748,21 @@ static bm_uint8 * barman_protocol_get_block_and_fill_header(bm_datastore_block_l
     barman_protocol_update_last_sample_timestamp(header_ptr, timestamp);
 
     /* Get the block */
-    block = barman_datastore_get_block(core, length);
+    return barman_datastore_get_block(core, length);
+}
+
+/**
+ * @brief   Get a block and fill the record header
+ * @param   length          The length of the block to get
+ * @param   timestamp       The timestamp to put in the header
+ * @param   core            The core number to put in the header
+ * @param   record_type     The record type to put in the header
+ * @return  Pointer to the block, BM_NULL if failure
+ */
+static bm_uint8 * barman_protocol_get_block_and_fill_header(bm_datastore_block_length length, bm_uint32 core, enum bm_protocol_record_types record_type, bm_uint64 timestamp)
+{
+    bm_uint8 * const block = barman_protocol_get_block(length, core, timestamp);
+
     if (block != BM_NULL) {
         /* fill it */
         barman_protocol_init_record_header((struct bm_protocol_record_header *) block, core, record_type, timestamp);
@@ -753,7 +832,7 @@ bm_bool barman_protocol_initialize(bm_datastore_config datastore_config,
     bm_uintptr alignment;
 #endif
     struct bm_protocol_header * header_ptr = bm_protocol_header();
-#if (BM_CONFIG_MAX_TASK_INFOS > 0) || (BM_CONFIG_MAX_MMAP_LAYOUTS > 0) || (BM_NUM_CUSTOM_COUNTERS > 0)
+#if (BM_CONFIG_MAX_TASK_INFOS > 0) || (BM_CONFIG_MAX_MMAP_LAYOUTS > 0) || (BM_NUM_CUSTOM_COUNTERS > 0) || BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
     bm_uint32 index;
 #endif
 
@@ -897,6 +976,13 @@ bm_bool barman_protocol_initialize(bm_datastore_config datastore_config,
         return BM_FALSE;
     }
 
+#if BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+    /* the first sample on each core must be a key sample */
+    for (index = 0; index < BM_CONFIG_MAX_CORES; ++index) {
+        bm_protocol_compact_sample_states[index].samples_since_key = 0;
+    }
+#endif
+
     /* set the magic bytes to indicate initialized */
     ((bm_uint32 *)&header_ptr->magic_bytes)[1] = BM_PROTOCOL_MAGIC_BYTES_SECOND_WORD;
     barman_atomic_store((bm_uint32 *)&header_ptr->magic_bytes, BM_PROTOCOL_MAGIC_BYTES_FIRST_WORD);
@@ -1039,6 +1125,179 @@ bm_uint64 barman_protocol_get_minimum_sample_period(void)
 }
 #endif
 
+#if BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+/**
+ * @brief   Append an unsigned LEB128 varint
+ * @param   pointer     The record to append to, or BM_NULL to only measure the length
+ * @param   offset      The offset into the record to append at
+ * @param   value       The value to append
+ * @return  The offset following the appended value
+ */
+static BM_INLINE bm_uint32 barman_protocol_append_varint(bm_uint8 * pointer, bm_uint32 offset, bm_uint64 value)
+{
+    while (value >= 0x80u) {
+        if (pointer != BM_NULL) {
+            pointer[offset] = (bm_uint8) (value | 0x80u);
+        }
+        value >>= 7;
+        ++offset;
+    }
+
+    if (pointer != BM_NULL) {
+        pointer[offset] = (bm_uint8) value;
+    }
+
+    return offset + 1;
+}
+
+/**
+ * @brief   Encode a compact sample record (see {@link bm_protocol_compact_sample_state})
+ * @param   pointer     The record to fill, or BM_NULL to only measure the length
+ * @param   state       The previous sample on the core
+ * @param   flags       The BM_PROTOCOL_COMPACT_SAMPLE_FLAG_* values other than BM_PROTOCOL_COMPACT_SAMPLE_FLAG_HAS_PC
+ * @return  The length of the record
+ */
+BM_NONNULL((2))
+static bm_uint32 barman_protocol_encode_compact_sample(bm_uint8 * pointer, const struct bm_protocol_compact_sample_state * state,
+                                                       bm_uint8 flags, bm_uint64 timestamp, bm_uint32 core,
+#if BM_CONFIG_MAX_TASK_INFOS > 0
+                                                       bm_task_id_t task_id,
+#endif
+                                                       const void * pc,
+                                                       bm_uint32 num_counters, const bm_uint64 * counter_values,
+                                                       bm_uint32 num_custom_counters, const bm_uint32 * custom_counter_ids, const bm_uint64 * custom_counter_values)
+{
+    const bm_bool is_key = ((flags & BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_KEY) != 0);
+    bm_uint32 offset = 2;
+    bm_uint32 index;
+
+    if (pointer != BM_NULL) {
+        pointer[0] = BM_PROTOCOL_RECORD_COMPACT_SAMPLE;
+        pointer[1] = (pc != BM_NULL ? BM_PROTOCOL_COMPACT_SAMPLE_FLAG_HAS_PC : 0) | flags;
+    }
+
+    offset = barman_protocol_append_varint(pointer, offset, core);
+    offset = barman_protocol_append_varint(pointer, offset, (is_key ? timestamp : timestamp - state->timestamp));
+#if BM_CONFIG_MAX_TASK_INFOS > 0
+    offset = barman_protocol_append_varint(pointer, offset, task_id);
+#endif
+    if (pc != BM_NULL) {
+        offset = barman_protocol_append_varint(pointer, offset, (bm_uintptr) pc);
+    }
+
+    offset = barman_protocol_append_varint(pointer, offset, num_counters);
+    for (index = 0; index < num_counters; ++index) {
+        if (is_key) {
+            offset = barman_protocol_append_varint(pointer, offset, counter_values[index]);
+        }
+        else {
+            /* zigzag encode so that small negative deltas (e.g. from a counter being reset) stay small */
+            const bm_uint64 delta = counter_values[index] - state->counter_values[index];
+            offset = barman_protocol_append_varint(pointer, offset, (delta << 1) ^ (0 - (delta >> 63)));
+        }
+    }
+
+#if BM_NUM_CUSTOM_COUNTERS > 0
+    offset = barman_protocol_append_varint(pointer, offset, num_custom_counters);
+    for (index = 0; index < num_custom_counters; ++index) {
+        offset = barman_protocol_append_varint(pointer, offset, custom_counter_ids[index]);
+        offset = barman_protocol_append_varint(pointer, offset, custom_counter_values[index]);
+    }
+#endif
+
+    return offset;
+}
+
+/**
+ * @brief   Write a compact sample record
+ * @details Takes the same arguments as {@link barman_protocol_write_sample}
+ */
+static bm_bool barman_protocol_write_compact_sample(bm_uint64 timestamp, bm_uint32 core,
+#if BM_CONFIG_MAX_TASK_INFOS > 0
+                                                    bm_task_id_t task_id,
+#endif
+                                                    const void * pc,
+                                                    bm_uint32 num_counters, const bm_uint64 * counter_values,
+                                                    bm_uint32 num_custom_counters, const bm_uint32 * custom_counter_ids, const bm_uint64 * custom_counter_values)
+{
+    struct bm_protocol_compact_sample_state * state;
+    struct bm_protocol_compact_sample_state previous;
+    bm_datastore_block_length length;
+    bm_uint8 * pointer;
+    bm_uint32 index;
+    bm_uint8 flags;
+    bm_bool is_nested;
+
+    if (core >= BM_CONFIG_MAX_CORES) {
+        BM_DEBUG("Could not write as core > BM_CONFIG_MAX_CORES\n");
+        return BM_FALSE;
+    }
+
+    if (num_counters > BM_MAX_PMU_COUNTERS) {
+        BM_DEBUG("Could not write as num_counters > BM_MAX_PMU_COUNTERS\n");
+        return BM_FALSE;
+    }
+
+    /* A sample that interrupted another on this core must not use or change the state the other is using */
+    state = &bm_protocol_compact_sample_states[core];
+    is_nested = barman_atomic_exchange(&state->in_use, BM_TRUE);
+    if (is_nested) {
+        flags = BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_KEY | BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_NESTED;
+    }
+    else {
+        /* Measure and fill from the same copy of the state, so that both encode exactly the same values */
+        previous = *state;
+
+        /* Write a key sample periodically, so that the rest can still be decoded if older records are lost (e.g. overwritten in a circular buffer).
+         * The timestamp delta is not zigzag encoded, so it must never be negative. */
+        flags = ((previous.samples_since_key == 0) || (previous.num_counters != num_counters) || (timestamp < previous.timestamp)
+#if BM_CONFIG_COMPACT_SAMPLE_KEY_INTERVAL > 0
+                 || (previous.samples_since_key >= BM_CONFIG_COMPACT_SAMPLE_KEY_INTERVAL)
+#endif
+                 ? BM_PROTOCOL_COMPACT_SAMPLE_FLAG_IS_KEY : 0);
+    }
+
+    /* Measure, then get the block and fill it. A key sample does not read the previous state. */
+    length = barman_protocol_encode_compact_sample(BM_NULL, &previous, flags, timestamp, core,
+#if BM_CONFIG_MAX_TASK_INFOS > 0
+                                                   task_id,
+#endif
+                                                   pc, num_counters, counter_values,
+                                                   num_custom_counters, custom_counter_ids, custom_counter_values);
+
+    pointer = barman_protocol_get_block(length, core, timestamp);
+    if (pointer == BM_NULL) {
+        if (!is_nested) {
+            barman_atomic_store(&state->in_use, BM_FALSE);
+        }
+        return BM_FALSE;
+    }
+
+    barman_protocol_encode_compact_sample(pointer, &previous, flags, timestamp, core,
+#if BM_CONFIG_MAX_TASK_INFOS > 0
+                                          task_id,
+#endif
+                                          pc, num_counters, counter_values,
+                                          num_custom_counters, custom_counter_ids, custom_counter_values);
+
+    /* commit the data */
+    barman_datastore_commit_block_and_header(core, pointer);
+
+    if (!is_nested) {
+        /* the next sample is relative to this one */
+        state->timestamp = timestamp;
+        state->num_counters = num_counters;
+        for (index = 0; index < num_counters; ++index) {
+            state->counter_values[index] = counter_values[index];
+        }
+        state->samples_since_key = (flags != 0 ? 1 : previous.samples_since_key + 1);
+
+        barman_atomic_store(&state->in_use, BM_FALSE);
+    }
+
+    return BM_TRUE;
+}
+#endif
 
 bm_bool barman_protocol_write_sample(bm_uint64 timestamp, bm_uint32 core,
 #if BM_CONFIG_MAX_TASK_INFOS > 0
@@ -1048,6 +1307,14 @@ bm_bool barman_protocol_write_sample(bm_uint64 timestamp, bm_uint32 core,
                                      bm_uint32 num_counters, const bm_uint64 * counter_values,
                                      bm_uint32 num_custom_counters, const bm_uint32 * custom_counter_ids, const bm_uint64 * custom_counter_values)
 {
+#if BM_CONFIG_USE_COMPACT_SAMPLE_RECORDS
+    return barman_protocol_write_compact_sample(timestamp, core,
+#if BM_CONFIG_MAX_TASK_INFOS > 0
+                                                task_id,
+#endif
+                                                pc, num_counters, counter_values,
+                                                num_custom_counters, custom_counter_ids, custom_counter_values);
+#else
     const bm_datastore_block_length length = sizeof(struct bm_protocol_sample) +
                                                 (pc != BM_NULL ? sizeof(void *) : 0) +
                                                 (num_counters * sizeof(bm_uint64)) +
@@ -1099,6 +1366,7 @@ bm_bool barman_protocol_write_sample(bm_uint64 timestamp, bm_uint32 core,
     barman_datastore_commit_block_and_header(core, (bm_uint8* ) pointer);
 
     return BM_TRUE;
+#endif
 }
 
 #if BM_CONFIG_MAX_TASK_INFOS > 0
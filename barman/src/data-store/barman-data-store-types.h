@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2023 by Arm Limited. */
+/* Copyright (C) 2016-2025 by Arm Limited. */
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 /** @file */
@@ -19,6 +19,10 @@
 #   define BM_DATASTORE_IS_IN_MEMORY                            1
 #   define BM_DATASTORE_USES_STREAMING_INTERFACE                0
 
+#elif BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER
+#   define BM_DATASTORE_IS_IN_MEMORY                            1
+#   define BM_DATASTORE_USES_STREAMING_INTERFACE                0
+
 #elif BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_STM
 #   define BM_DATASTORE_IS_IN_MEMORY                            0
 #   define BM_DATASTORE_USES_STREAMING_INTERFACE                1
@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2023 by Arm Limited. */
+/* Copyright (C) 2016-2025 by Arm Limited. */
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 /** @file */
@@ -8,6 +8,7 @@
 
 #include "barman-types.h"
 #include "barman-atomics.h"
+#include "barman-config.h"
 
 /**
  * @defgroup    bm_data_store   Data Store: Interface
@@ -49,6 +50,35 @@ typedef bm_atomic_uintptr   bm_datastore_block_length;
 /** Encode block length */
 #define BM_DATASTORE_ENCODE_PADDING_BLOCK(v, p) (BM_DATASTORE_GET_LENGTH_VALUE(v) | ((p) ? BM_DATASTORE_BLOCK_PADDING_BIT : 0))
 
+#if BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER
+
+/** The alignment of each per-core region, so that no two cores ever write to the same cache line */
+#define BM_DATASTORE_PER_CORE_REGION_ALIGNMENT  64
+
+/**
+ * @brief   Describes the location of one core's region within the buffer of the per-core data store.
+ * @details Written once when the data store is initialized.
+ */
+struct bm_datastore_per_core_region
+{
+    bm_uint64 offset;   /**< The offset of the region from `base_pointer` */
+    bm_uint64 length;   /**< The length of the region, including its {@link struct bm_datastore_per_core_region_header} */
+};
+
+/**
+ * @brief   Stored at the start of each core's region of the per-core data store, and only ever written by that core.
+ * @details The blocks follow immediately after this struct. All the records in a region are for the same core and so
+ *          are in timestamp order; the host reconstructs the complete stream by merging the regions by the
+ *          timestamp in each record header.
+ */
+struct bm_datastore_per_core_region_header
+{
+    bm_datastore_header_length write_offset;    /**< The offset of the first unwritten byte, relative to the end of this struct.
+                                                     Blocks before it that are marked invalid have not been committed yet */
+};
+
+#endif
+
 /**
  * @brief   Structure passed to most in-memory data stores that forms part of the protocol header and contains
  *          data about the layout of the in-memory data.
@@ -63,6 +93,10 @@ struct bm_datastore_header_data
     bm_datastore_header_length read_offset;     /**< The current read offset. For ring buffers this is the start of the ring */
     bm_datastore_header_length total_written;   /**< Total number of bytes consumed; always increments */
     bm_uint8 * base_pointer;                    /**< The base address of the buffer */
+#if BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_PER_CORE_RAM_BUFFER
+    /** The layout of the per-core regions. The offsets and total above are not used by this data store. */
+    struct bm_datastore_per_core_region per_core_regions[BM_CONFIG_MAX_CORES];
+#endif
 };
 
 #if BM_CONFIG_USE_DATASTORE == BM_CONFIG_USE_DATASTORE_USER_SUPPLIED
@@ -0,0 +1,217 @@
+/* Copyright (C) 2025 by Arm Limited. */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+/** @file */
+
+#include "data-store/barman-per-core-ram-buffer.h"
+#include "barman-config.h"
+#include "barman-atomics.h"
+#include "barman-cache.h"
+#include "barman-intrinsics.h"
+
+/* *********************************** */
+
+/**
+ * @brief   The private state for one core's region. Only ever accessed by that core once initialized.
+ * @details The same core may still re-enter get_block / commit_block, for example when the PMU interrupt handler writes a
+ *          sample while a thread on that core is writing an annotation, so the offsets are updated atomically. As no other
+ *          core touches them, this does not cause any contention.
+ * @ingroup bm_data_store_per_core_ram_buffer
+ */
+struct barman_per_core_ram_buffer_core_state
+{
+    /** The header at the start of the core's region */
+    struct bm_datastore_per_core_region_header * region_header;
+    /** The start of the block data within the region */
+    bm_uint8 * data_pointer;
+    /** The length of the block data within the region */
+    bm_uintptr data_length;
+    /** The offset following the last block returned by get_block, relative to `data_pointer` */
+    bm_datastore_header_length reserved_offset;
+} BM_ALIGN(BM_DATASTORE_PER_CORE_REGION_ALIGNMENT);
+
+/**
+ * @brief   Defines the data
+ * @ingroup bm_data_store_per_core_ram_buffer
+ */
+struct barman_per_core_ram_buffer_configuration
+{
+    /** The state for each core; each is in its own cache line */
+    struct barman_per_core_ram_buffer_core_state cores[BM_CONFIG_MAX_CORES];
+    /** Closed flag */
+    bm_atomic_bool closed;
+};
+
+/** The configuration settings */
+static struct barman_per_core_ram_buffer_configuration barman_per_core_ram_buffer_configuration = { { { BM_NULL, BM_NULL, 0, 0 } }, BM_TRUE };
+
+/* *********************************** */
+
+/**
+ * @brief   Align a block size to a multiple of `sizeof(bm_datastore_block_length)`
+ * @param   length  the length to align
+ * @return  The aligned length
+ */
+static BM_INLINE bm_datastore_block_length barman_per_core_ram_buffer_align_block_size(bm_datastore_block_length length)
+{
+    return ((length + (sizeof(bm_datastore_block_length) - 1)) & ~((bm_datastore_block_length) (sizeof(bm_datastore_block_length) - 1)));
+}
+
+/* *********************************** */
+
+bm_bool barman_per_core_ram_buffer_initialize(struct bm_datastore_header_data * header_data)
+{
+    const bm_uintptr alignment_mask = BM_DATASTORE_PER_CORE_REGION_ALIGNMENT - 1;
+    const bm_uintptr alignment = ((((bm_uintptr) header_data->base_pointer) + alignment_mask) & ~alignment_mask) - ((bm_uintptr) header_data->base_pointer);
+    bm_uintptr region_length;
+    bm_uint32 core;
+
+    /* Can only change the settings if closed */
+    if (!barman_atomic_cmp_ex_strong_value(&barman_per_core_ram_buffer_configuration.closed, BM_TRUE, BM_FALSE)) {
+        return BM_FALSE;
+    }
+
+    /* Split the buffer (after aligning its start) into equal, aligned regions */
+    region_length = (header_data->buffer_length > alignment ? ((header_data->buffer_length - alignment) / BM_CONFIG_MAX_CORES) & ~alignment_mask : 0);
+
+    if (region_length <= sizeof(struct bm_datastore_per_core_region_header)) {
+        barman_atomic_store(&barman_per_core_ram_buffer_configuration.closed, BM_TRUE);
+        return BM_FALSE;
+    }
+
+    /* The shared offsets are not used as each region records its own */
+    header_data->read_offset = 0;
+    header_data->write_offset = 0;
+    header_data->total_written = 0;
+
+    for (core = 0; core < BM_CONFIG_MAX_CORES; ++core) {
+        struct barman_per_core_ram_buffer_core_state * const state = &barman_per_core_ram_buffer_configuration.cores[core];
+        const bm_uintptr region_offset = alignment + (core * region_length);
+        bm_uint8 * const region_pointer = header_data->base_pointer + region_offset;
+
+        /* Describe the region in the header */
+        header_data->per_core_regions[core].offset = region_offset;
+        header_data->per_core_regions[core].length = region_length;
+
+        /* Reset the region */
+        state->region_header = BM_ASSUME_ALIGNED_CAST(struct bm_datastore_per_core_region_header, region_pointer);
+        state->region_header->write_offset = 0;
+        state->data_pointer = region_pointer + sizeof(struct bm_datastore_per_core_region_header);
+        state->data_length = region_length - sizeof(struct bm_datastore_per_core_region_header);
+        state->reserved_offset = 0;
+
+        barman_cache_clean(state->region_header, sizeof(*state->region_header));
+    }
+
+    barman_dsb();
+
+    return BM_TRUE;
+}
+
+bm_uint8 * barman_per_core_ram_buffer_get_block(bm_uint32 core, bm_datastore_block_length user_length)
+{
+    const bm_datastore_block_length aligned_length = barman_per_core_ram_buffer_align_block_size(user_length);
+    const bm_datastore_block_length required_length = aligned_length + sizeof(bm_datastore_block_length);
+    struct barman_per_core_ram_buffer_core_state * state;
+    bm_datastore_header_length old_reserved_offset;
+    bm_datastore_header_length new_reserved_offset;
+    bm_uint8 * block_pointer;
+
+    /* Check length */
+    if (aligned_length <= 0) {
+        return BM_NULL;
+    }
+
+    /* Check core number */
+    if (core >= BM_CONFIG_MAX_CORES) {
+        return BM_NULL;
+    }
+
+    /* Check not already closed */
+    if (barman_atomic_load(&barman_per_core_ram_buffer_configuration.closed)) {
+        return BM_NULL;
+    }
+
+    state = &barman_per_core_ram_buffer_configuration.cores[core];
+    old_reserved_offset = barman_atomic_load(&state->reserved_offset);
+
+    /* Reserve the space; a nested call on this core (from an interrupt handler) will get the block after this one */
+    do {
+        /* NB: old_reserved_offset is modified by barman_atomic_cmp_ex_weak_pointer if it fails */
+        new_reserved_offset = old_reserved_offset + required_length;
+
+        /* Check the region has space */
+        if (new_reserved_offset > state->data_length) {
+            return BM_NULL;
+        }
+    } while (!barman_atomic_cmp_ex_weak_pointer(&state->reserved_offset, &old_reserved_offset, new_reserved_offset));
+
+    /* Configure the result */
+    block_pointer = state->data_pointer + old_reserved_offset;
+
+    /* Write the length value, but mark the block invalid */
+    *BM_ASSUME_ALIGNED_CAST(bm_datastore_block_length, block_pointer) = BM_DATASTORE_ENCODE_PADDING_BLOCK(aligned_length, BM_TRUE);
+
+    return block_pointer + sizeof(bm_datastore_block_length);
+}
+
+void barman_per_core_ram_buffer_commit_block(bm_uint32 core, bm_uint8 * user_pointer)
+{
+    /* Check core number */
+    if (core >= BM_CONFIG_MAX_CORES) {
+        return;
+    }
+
+    /* Check not already closed */
+    else if (barman_atomic_load(&barman_per_core_ram_buffer_configuration.closed)) {
+        return;
+    }
+
+    /* Pre tests are valid */
+    else {
+        struct barman_per_core_ram_buffer_core_state * const state = &barman_per_core_ram_buffer_configuration.cores[core];
+        bm_uint8 * const block_pointer = user_pointer - sizeof(bm_datastore_block_length);
+        bm_datastore_block_length * const length_pointer = BM_ASSUME_ALIGNED_CAST(bm_datastore_block_length, block_pointer);
+        const bm_datastore_header_length reserved_offset = barman_atomic_load(&state->reserved_offset);
+        bm_datastore_header_length old_write_offset = barman_atomic_load(&state->region_header->write_offset);
+        bm_datastore_header_length new_write_offset;
+        bm_datastore_block_length user_length;
+
+        /* Check the block is within the reserved part of the region */
+        if ((block_pointer < state->data_pointer) || (block_pointer >= (state->data_pointer + reserved_offset))) {
+            return;
+        }
+
+        user_length = BM_DATASTORE_GET_LENGTH_VALUE(*length_pointer);
+        new_write_offset = (block_pointer - state->data_pointer) + user_length + sizeof(bm_datastore_block_length);
+
+        if ((user_length == 0) || (new_write_offset > reserved_offset)) {
+            return;
+        }
+
+        /* Write the length value, now marked as valid */
+        *length_pointer = BM_DATASTORE_ENCODE_PADDING_BLOCK(user_length, BM_FALSE);
+
+        /* Clean the cache lines that contain the data */
+        barman_cache_clean(block_pointer, user_length + sizeof(bm_datastore_block_length));
+
+        /* The block must be visible before the write offset that includes it */
+        barman_dmb();
+
+        /* Publish the new write offset, unless a nested block that follows this one was committed first. Any block
+         * before it that is not yet committed is still marked invalid. */
+        do {
+            /* NB: old_write_offset is modified by barman_atomic_cmp_ex_weak_pointer if it fails */
+            if (old_write_offset >= new_write_offset) {
+                break;
+            }
+        } while (!barman_atomic_cmp_ex_weak_pointer(&state->region_header->write_offset, &old_write_offset, new_write_offset));
+
+        barman_cache_clean(state->region_header, sizeof(*state->region_header));
+    }
+}
+
+void barman_per_core_ram_buffer_close(void)
+{
+    barman_atomic_store(&barman_per_core_ram_buffer_configuration.closed, BM_TRUE);
+}
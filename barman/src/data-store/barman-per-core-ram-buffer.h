@@ -0,0 +1,55 @@
+/* Copyright (C) 2025 by Arm Limited. */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+/** @file */
+
+#ifndef INCLUDE_BARMAN_DATA_STORE_PER_CORE_RAM_BUFFER
+#define INCLUDE_BARMAN_DATA_STORE_PER_CORE_RAM_BUFFER
+
+#include "data-store/barman-data-store.h"
+
+/**
+ * @defgroup    bm_data_store_per_core_ram_buffer     Data Store: The per-core RAM buffer data store
+ * @brief       Stores data in a fixed length RAM buffer that is split into one linear region per core.
+ * @details     Each core only ever writes to its own region, so unlike {@link bm_data_store_linear_ram_buffer} there is
+ *              no shared write offset. The offsets that get_block / commit_block update atomically are only ever touched by
+ *              one core (possibly re-entered from an interrupt handler), so there is no contention on them.
+ *              The layout of the regions is described by `per_core_regions` in {@link struct bm_datastore_header_data}.
+ *              Once the space in a core's region is exhausted, all subsequent calls to
+ *              {@link barman_per_core_ram_buffer_get_block} for that core will return null; other cores are unaffected.
+ * @note        The `core` argument to {@link barman_per_core_ram_buffer_get_block} and
+ *              {@link barman_per_core_ram_buffer_commit_block} must be the number of the calling core.
+ * @{ */
+
+/**
+ * @brief   Initialize the per-core ram buffer
+ * @param   header_data The header object to store data into
+ * @return  BM_TRUE if initialized successfully, BM_FALSE if not
+ * @note    If this function is called multiple times, it will fail unless the buffer was previously closed
+ *
+ */
+BM_NONNULL((1))
+bm_bool barman_per_core_ram_buffer_initialize(struct bm_datastore_header_data * header_data);
+
+/**
+ * @brief   Get a pointer to a block of memory of `length` bytes which can be written to.
+ * @see     barman_datastore_get_block
+ */
+bm_uint8 * barman_per_core_ram_buffer_get_block(bm_uint32 core, bm_datastore_block_length length);
+
+/**
+ * @brief   Commit a completed block of memory.
+ * @see     barman_datastore_commit_block
+ */
+BM_NONNULL((2))
+void barman_per_core_ram_buffer_commit_block(bm_uint32 core, bm_uint8 * block_pointer);
+
+/**
+ * @brief   Close the data store.
+ * @see     barman_datastore_close
+ */
+extern void barman_per_core_ram_buffer_close(void);
+
+/** @} */
+
+#endif /* INCLUDE_BARMAN_DATA_STORE_PER_CORE_RAM_BUFFER */
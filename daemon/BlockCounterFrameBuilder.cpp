@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #include "BlockCounterFrameBuilder.h"
 
@@ -80,6 +80,27 @@ bool BlockCounterFrameBuilder::event64(int key, int64_t value)
     return false;
 }
 
+bool BlockCounterFrameBuilder::events64(lib::Span<const event64_t> events)
+{
+    if (!ensureFrameStarted()) {
+        return false;
+    }
+
+    // check the space once for the whole batch; if it won't all fit then fall back to
+    // writing one at a time so that as much as possible goes in this frame
+    constexpr int event_size = buffer_utils::MAXSIZE_PACK64 + buffer_utils::MAXSIZE_PACK32;
+    if (!checkSpace(static_cast<int>(events.size()) * event_size)) {
+        return IBlockCounterFrameBuilder::events64(events);
+    }
+
+    for (const auto & event : events) {
+        rawBuilder.packInt(event.key);
+        rawBuilder.packInt64(event.value);
+    }
+
+    return true;
+}
+
 bool BlockCounterFrameBuilder::check(const uint64_t time)
 {
     if ((flushIsNeeded != nullptr) && ((*flushIsNeeded)(time, rawBuilder.needsFlush()))) {
@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2021 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -37,6 +37,8 @@ public:
 
     bool event64(int key, int64_t value) override;
 
+    bool events64(lib::Span<const event64_t> events) override;
+
     bool check(const uint64_t time) override;
 
     bool flush() override;
@@ -12,7 +12,6 @@
 #include "OlyUtility.h"
 #include "PrimarySourceProvider.h"
 #include "ProductVersion.h"
-#include "ProtocolVersion.h"
 #include "SessionData.h"
 #include "lib/FsEntry.h"
 #include "lib/Span.h"
@@ -113,7 +112,7 @@ static mxml_node_t * getTree(bool includeTime,
                        (gSessionData.mBacktraceDepth > 0) ? primarySourceProvider.getBacktraceProcessingMode()
                                                           : "none");
     mxmlElementSetAttr(captured, "type", primarySourceProvider.getCaptureXmlTypeValue());
-    mxmlElementSetAttrf(captured, "protocol", "%d", PROTOCOL_VERSION);
+    mxmlElementSetAttrf(captured, "protocol", "%d", gSessionData.getProtocolVersion());
     mxmlElementSetAttrf(captured, "product", "%d", PRODUCT_VERSION);
     mxmlElementSetAttrf(captured, "product_tag", "%s", PRODUCT_VERSION_BRANCH_NAME);
     if (includeTime) {                    // Send the following only after the capture is complete
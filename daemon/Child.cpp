@@ -56,6 +56,7 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <set>
 #include <string>
 #include <string_view>
@@ -194,6 +195,20 @@ namespace {
         static const metrics::metric_group_set_t empty {};
         return config.events.empty() && config.spes.empty() && config.metric_groups == empty;
     }
+
+#ifdef CONFIG_USE_PERFETTO
+    /** @return the perfetto trace settings from the session (zero meaning use the agent's default) */
+    ipc::msg_perfetto_configuration_t perfettoConfigurationFromSession()
+    {
+        auto const setting = [](int value) { return static_cast<std::uint32_t>(std::max(value, 0)); };
+
+        return ipc::msg_perfetto_configuration_t {ipc::perfetto_configuration_t {
+            setting(gSessionData.mPerfettoBufferSizeKb),
+            setting(gSessionData.mPerfettoFlushPeriodMs),
+            setting(gSessionData.mPerfettoFileWritePeriodMs),
+        }};
+    }
+#endif
 }
 
 void Child::run()
@@ -392,7 +407,8 @@ void Child::run()
     // Initialize ftrace source before child as it's slow and depends on nothing else
     // If initialized later, us gator with ftrace has time sync issues
     // Must be initialized before senderThread is started as senderThread checks externalSource
-    if (!addSource(createExternalSource(senderSem, drivers),
+    if (!addSource(SenderChannel::external,
+                   createExternalSource(senderSem, drivers),
                    [this, &waitForExternalSourceAgent, &waitForPerfettoAgent, enablePerfettoAgent](auto & source) {
                        this->agent_workers_process->async_add_external_source(
                            source,
@@ -411,6 +427,10 @@ void Child::run()
                        if (enablePerfettoAgent) {
                            this->agent_workers_process->async_add_perfetto_source(
                                source,
+                               perfettoConfigurationFromSession(),
+                               [&perfettoDriver = drivers.getPerfettoDriver()](std::uint64_t overruns) {
+                                   perfettoDriver.setOverruns(overruns);
+                               },
                                [&waitForPerfettoAgent](bool success) {
                                    waitForPerfettoAgent.disable();
                                    if (!success) {
@@ -448,7 +468,7 @@ void Child::run()
     // create the primary source last as it will launch the process, which may lead to a race receiving external messages
     auto newPrimarySource = primarySourceProvider.createPrimarySource(
         senderSem,
-        *sender,
+        sender->getChannel(SenderChannel::perf),
         [this]() -> bool { return sessionEnded; },
         execTargetCallback,
         startedCallback,
@@ -463,11 +483,12 @@ void Child::run()
     }
 
     auto & primarySource = *newPrimarySource;
-    addSource(std::move(newPrimarySource));
+    addSource(SenderChannel::perf, std::move(newPrimarySource));
 
     // initialize midgard hardware counters
     if (drivers.getMaliHwCntrs().countersEnabled()) {
-        if (!addSource(mali_userspace::createMaliHwCntrSource(senderSem, drivers.getMaliHwCntrs()))) {
+        if (!addSource(SenderChannel::mali,
+                       mali_userspace::createMaliHwCntrSource(senderSem, drivers.getMaliHwCntrs()))) {
             LOG_ERROR("Unable to prepare midgard hardware counters source for capture");
             handleException();
         }
@@ -482,17 +503,18 @@ void Child::run()
     }
 
     if (shouldStartUserSpaceSource(drivers.getAllPolledConst())) {
-        if (!addSource(createUserSpaceSource(senderSem, drivers.getAllPolled()))) {
+        if (!addSource(SenderChannel::userspace, createUserSpaceSource(senderSem, drivers.getAllPolled()))) {
             LOG_ERROR("Unable to prepare userspace source for capture");
             handleException();
         }
     }
 
-    if (!addSource(armnn::createSource(drivers.getArmnnDriver().getCaptureController(), senderSem),
+    if (!addSource(SenderChannel::armnn,
+                   armnn::createSource(drivers.getArmnnDriver().getCaptureController(), senderSem),
 #if CONFIG_ARMNN_AGENT
                    [this, &waitForArmnnAgent](auto & /*source*/) {
                        this->agent_workers_process->async_add_armnn_source(
-                           drivers.getArmnnDriver().getAcceptedSocketConsumer(),
+                           drivers.getArmnnDriver().getConnectionConsumer(),
                            [&waitForArmnnAgent](bool success) {
                                waitForArmnnAgent.disable();
                                if (!success) {
@@ -578,6 +600,7 @@ void Child::run()
     agent_workers_process->join();
 
     sources.clear();
+    sourceChannels.clear();
 
     if (gSessionData.mLocalCapture) {
         if (gSessionData.mLogToFile) {
@@ -631,13 +654,13 @@ void Child::sendGatorLog()
 }
 
 template<typename S>
-bool Child::addSource(std::shared_ptr<S> source)
+bool Child::addSource(SenderChannel channel, std::shared_ptr<S> source)
 {
-    return addSource(std::move(source), [](auto const & /*source*/) {});
+    return addSource(channel, std::move(source), [](auto const & /*source*/) {});
 }
 
 template<typename S, typename Callback>
-bool Child::addSource(std::shared_ptr<S> source, Callback callback)
+bool Child::addSource(SenderChannel channel, std::shared_ptr<S> source, Callback callback)
 {
     if (!source) {
         return false;
@@ -646,6 +669,7 @@ bool Child::addSource(std::shared_ptr<S> source, Callback callback)
     if (!sessionEnded) {
         callback(*source);
         sources.push_back(std::move(source));
+        sourceChannels.push_back(channel);
     }
     return true;
 }
@@ -838,12 +862,12 @@ void Child::stopThreadEntryPoint()
     LOG_FINE("Exit stop thread");
 }
 
-bool Child::sendAllSources()
+bool Child::sendAllSources(const std::vector<std::size_t> & sendOrder)
 {
     bool done = true;
-    for (auto & source : sources) {
+    for (auto index : sendOrder) {
         // bitwise &, no short circuit
-        done &= source->write(*sender);
+        done &= sources[index]->write(sender->getChannel(sourceChannels[index]));
     }
     return !done;
 }
@@ -853,11 +877,21 @@ void Child::senderThreadEntryPoint()
     prctl(PR_SET_NAME, reinterpret_cast<unsigned long>(&"gatord-sender"), 0, 0, 0);
     sem_wait(&haltPipeline);
 
+    // drain the latency sensitive sources first each time round
+    std::vector<std::size_t> sendOrder(sources.size());
+    std::iota(sendOrder.begin(), sendOrder.end(), 0);
+    auto const priorityOf = [this](std::size_t index) {
+        return sender->getChannel(sourceChannels[index]).getPriority();
+    };
+    std::stable_sort(sendOrder.begin(), sendOrder.end(), [&priorityOf](std::size_t a, std::size_t b) {
+        return priorityOf(a) < priorityOf(b);
+    });
+
     do {
         if (sem_wait(&senderSem) != 0) {
             LOG_ERROR("wait failed: %d, (%s)", errno, lib::strerror());
         }
-    } while (sendAllSources());
+    } while (sendAllSources(sendOrder));
 
     LOG_FINE("Exit sender thread");
 }
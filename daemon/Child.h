@@ -14,6 +14,7 @@
 #include "metrics/metric_group_set.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -75,6 +76,8 @@ private:
     sem_t haltPipeline;
     sem_t senderSem;
     std::vector<std::shared_ptr<Source>> sources {};
+    // the sender channel of each of the sources
+    std::vector<SenderChannel> sourceChannels {};
     std::unique_ptr<Sender> sender;
     Drivers & drivers;
     OlySocket * socket;
@@ -102,10 +105,10 @@ private:
      * return true if not empty
      */
     template<typename S>
-    bool addSource(std::shared_ptr<S> source);
+    bool addSource(SenderChannel channel, std::shared_ptr<S> source);
 
     template<typename S, typename Callback>
-    bool addSource(std::shared_ptr<S> source, Callback callback);
+    bool addSource(SenderChannel channel, std::shared_ptr<S> source, Callback callback);
 
     /**
      * Send gator log and the end sequence of APC.
@@ -120,9 +123,10 @@ private:
     /**
      * Writes data to the sender.
      *
+     * @param sendOrder The indexes of the sources, in the order to send them
      * @return true if there will be more to send again on at least one source, false otherwise (EOF)
      */
-    bool sendAllSources();
+    bool sendAllSources(const std::vector<std::size_t> & sendOrder);
     void watchPidsThreadEntryPoint(std::set<int> &, const lib::Waiter & waiter);
     void doEndSession();
 
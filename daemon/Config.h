@@ -1,4 +1,4 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 #ifndef CONFIG_H
 #define CONFIG_H
@@ -57,13 +57,25 @@
 #endif
 
 #ifndef CONFIG_LOG_TRACE
-#if (!defined(NDEBUG) || (defined(GATOR_UNIT_TESTS) && GATOR_UNIT_TESTS))
+#if defined(CONFIG_LOG_MIN_LEVEL)
+#define CONFIG_LOG_TRACE (CONFIG_LOG_MIN_LEVEL == 0)
+#elif (!defined(NDEBUG) || (defined(GATOR_UNIT_TESTS) && GATOR_UNIT_TESTS))
 #define CONFIG_LOG_TRACE 1
 #else
 #define CONFIG_LOG_TRACE 0
 #endif
 #endif
 
+// The most verbose level for which LOG_TRACE/LOG_DEBUG/LOG_FINE call sites are compiled in;
+// one of trace (0), debug (1), fine (3) or info (4)
+#ifndef CONFIG_LOG_MIN_LEVEL
+#if CONFIG_LOG_TRACE
+#define CONFIG_LOG_MIN_LEVEL 0
+#else
+#define CONFIG_LOG_MIN_LEVEL 1
+#endif
+#endif
+
 #ifndef CONFIG_ARMNN_AGENT
 #if defined(ANDROID) || defined(__ANDROID__)
 #define CONFIG_ARMNN_AGENT 1
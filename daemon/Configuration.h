@@ -160,4 +160,20 @@ enum class MetricSamplingMode {
     strobing,
 };
 
+/// The capture sources, each of which sends its data to Streamline through its own channel of the Sender
+enum class SenderChannel {
+    perf,      ///< CPU samples, SPE and the other perf data
+    external,  ///< Annotations, ftrace and Mali Timeline data
+    mali,      ///< Mali hardware counters
+    userspace, ///< Polled counters
+    armnn,     ///< ArmNN counters and timeline
+};
+
+/// How a Sender channel is scheduled relative to the others, when several are waiting to send
+enum class SendPriority {
+    high,   ///< Low volume, latency sensitive data; sent first
+    normal, ///< Sent after any high priority data
+    bulk,   ///< High volume data; yields to the other channels
+};
+
 #endif /* CONFIGURATION_H_ */
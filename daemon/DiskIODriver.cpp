@@ -1,8 +1,4 @@
-/* Copyright (C) 2013-2023 by Arm Limited. All rights reserved. */
-
-// Define to get format macros from inttypes.h
-#define __STDC_FORMAT_MACROS
-// must be before includes
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #include "DiskIODriver.h"
 
@@ -10,18 +6,20 @@
 #include "Logging.h"
 #include "PolledDriver.h"
 #include "lib/String.h"
+#include "lib/Syscall.h"
 
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <fstream>
-#include <functional>
-#include <sstream>
 #include <string>
-#include <tuple>
+#include <string_view>
+#include <system_error>
 #include <vector>
 
+#include <fcntl.h>
 #include <mxml.h>
-#include <unistd.h>
 
 class DiskIOCounter : public DriverCounter {
 public:
@@ -63,65 +61,75 @@ void DiskIOCounter::set(uint64_t sectors)
 }
 
 namespace {
-    constexpr int MIN_LINE_LEN_FOR_NAME_AND_USAGE = 10;
-    constexpr int MIN_LINE_LEN_FOR_DISK_NAME = 3;
-    constexpr int NAME_INDEX = 2;
-    constexpr int READ_INDEX = 5;
-    constexpr int WRITE_INDEX = 9;
+    constexpr std::size_t MIN_LINE_LEN_FOR_NAME_AND_USAGE = 10;
+    constexpr std::size_t NAME_INDEX = 2;
+    constexpr std::size_t READ_INDEX = 5;
+    constexpr std::size_t WRITE_INDEX = 9;
+
+    constexpr std::string_view TOTAL_READS_NAME = "Linux_block_rq_rd";
+    constexpr std::string_view TOTAL_WRITES_NAME = "Linux_block_rq_wr";
+
+    using diskstats_fields_t = std::array<std::string_view, MIN_LINE_LEN_FOR_NAME_AND_USAGE>;
+
+    /** Split off the next line from 'text', returning the line (without the '\n') */
+    std::string_view next_line(std::string_view & text)
+    {
+        auto const end = text.find('\n');
+        auto const line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        return line;
+    }
 
-    std::vector<std::string> split_diskstat_line_on_whitespace(const std::string & line, int words_needed)
+    /** Split the first fields of a diskstats line on whitespace, without copying. Returns the number of fields found */
+    std::size_t split_diskstats_line(std::string_view line, diskstats_fields_t & fields)
     {
-        std::istringstream line_stream {line};
-        std::string string_in_diskstat_line {};
-        std::vector<std::string> strings_in_diststat_line {};
-        int words_found = 0;
-        while (line_stream >> string_in_diskstat_line) {
-            if (words_found == words_needed) {
-                break; // don't visit the whole line, stop when we have reached the number of words we want
+        std::size_t count = 0;
+        while (count < fields.size()) {
+            auto const start = line.find_first_not_of(" \t");
+            if (start == std::string_view::npos) {
+                break;
             }
-            strings_in_diststat_line.emplace_back(string_in_diskstat_line);
-            words_found++;
+            line.remove_prefix(start);
+            auto const end = line.find_first_of(" \t");
+            fields[count++] = line.substr(0, end);
+            line.remove_prefix(end == std::string_view::npos ? line.size() : end);
         }
-        return strings_in_diststat_line;
+        return count;
     }
 
-    using diskstats_line_tuple_t = std::tuple<std::string, uint64_t, uint64_t>;
-
-    diskstats_line_tuple_t parse_diskstats_line(const std::vector<std::string> & diskstat_line)
+    bool parse_u64(std::string_view text, uint64_t & value)
     {
-        return {diskstat_line[NAME_INDEX],
-                std::stoull(diskstat_line[READ_INDEX]),
-                std::stoull(diskstat_line[WRITE_INDEX])};
+        auto const [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return (ec == std::errc {}) && (ptr == text.data() + text.size());
     }
 
-    std::string parse_diskstats_name(const std::vector<std::string> & diskstat_line)
+    std::string counter_name_reads(std::string_view disk_name)
     {
-        return diskstat_line[NAME_INDEX];
+        return "diskstats_" + std::string(disk_name) + "_reads";
     }
 
-    template<class T>
-    std::vector<T> parse_diskstats(int min_line_len, std::function<T(std::vector<std::string>)> line_parser)
+    std::string counter_name_writes(std::string_view disk_name)
     {
-        std::vector<T> result {};
-
-        std::ifstream diskstats("/proc/diskstats");
-        if (diskstats.fail()) {
-            LOG_ERROR("Unable to read /proc/diskstats");
-            handleException();
-        }
-
-        std::string diskstat_line {};
-        const std::string current_partition_name {};
-        while (std::getline(diskstats, diskstat_line)) {
-            const std::vector<std::string> strings_in_diskstat_line =
-                split_diskstat_line_on_whitespace(diskstat_line, min_line_len);
+        return "diskstats_" + std::string(disk_name) + "_writes";
+    }
 
-            if (strings_in_diskstat_line.size() < static_cast<typename std::vector<T>::size_type>(min_line_len)) {
+    std::vector<std::string> parse_diskstats_names(DynBuf & buf)
+    {
+        std::vector<std::string> result {};
+        std::string_view text {buf.getBuf(), buf.getLength()};
+
+        while (!text.empty()) {
+            auto const line = next_line(text);
+            diskstats_fields_t fields {};
+            auto const count = split_diskstats_line(line, fields);
+            if (count == 0) {
+                continue;
+            }
+            if (count <= NAME_INDEX) {
                 LOG_ERROR("Unable to parse /proc/diskstats");
                 handleException();
             }
-
-            result.emplace_back(line_parser(strings_in_diskstat_line));
+            result.emplace_back(fields[NAME_INDEX]);
         }
 
         return result;
@@ -129,30 +137,32 @@ namespace {
 
     std::vector<std::string> parse_diskstats_names()
     {
-        return parse_diskstats<std::string>(MIN_LINE_LEN_FOR_DISK_NAME, parse_diskstats_name);
-    }
-
-    std::vector<diskstats_line_tuple_t> parse_diskstats_names_and_usage()
-    {
-        return parse_diskstats<diskstats_line_tuple_t>(MIN_LINE_LEN_FOR_NAME_AND_USAGE, parse_diskstats_line);
+        DynBuf buf {};
+        if (!buf.read("/proc/diskstats")) {
+            LOG_ERROR("Unable to read /proc/diskstats");
+            handleException();
+        }
+        return parse_diskstats_names(buf);
     }
-
 }
 
 void DiskIODriver::readEvents(mxml_node_t * const /*unused*/)
 {
-    if (access("/proc/diskstats", R_OK) == 0) {
-        setCounters(new DiskIOCounter(getCounters(), "Linux_block_rq_rd"));
-        setCounters(new DiskIOCounter(getCounters(), "Linux_block_rq_wr"));
-
-        for (const auto & disk_name : parse_diskstats_names()) {
-            std::string counter_name_reads = "diskstats_" + disk_name + "_reads";
-            setCounters(new DiskIOCounter(getCounters(), counter_name_reads.data()));
-            std::string counter_name_writes = "diskstats_" + disk_name + "_writes";
-            setCounters(new DiskIOCounter(getCounters(), counter_name_writes.data()));
+    mFd = lib::open("/proc/diskstats", O_RDONLY | O_CLOEXEC);
+    if (mFd && mBuf.pread(*mFd)) {
+        setCounters(new DiskIOCounter(getCounters(), TOTAL_READS_NAME.data()));
+        setCounters(new DiskIOCounter(getCounters(), TOTAL_WRITES_NAME.data()));
+
+        for (const auto & disk_name : parse_diskstats_names(mBuf)) {
+            setCounters(new DiskIOCounter(getCounters(), counter_name_reads(disk_name).c_str()));
+            setCounters(new DiskIOCounter(getCounters(), counter_name_writes(disk_name).c_str()));
         }
+
+        // precompute the mapping from diskstats line to counter so that polling need not search by name
+        buildDiskIndex();
     }
     else {
+        mFd.close();
         LOG_SETUP("Linux counters\nCannot access /proc/diskstats. Disk I/O read and write counters not available.");
     }
 }
@@ -175,17 +185,15 @@ void DiskIODriver::writeEvents(mxml_node_t * root) const
 
         // Add the per-disk reads and writes counters to this node
         for (const auto & disk_name : parse_diskstats_names()) {
-            std::string counter_name_reads = "diskstats_" + disk_name + "_reads";
             auto * reads_xml = mxmlNewElement(node, "event");
-            mxmlElementSetAttr(reads_xml, "counter", counter_name_reads.data());
+            mxmlElementSetAttr(reads_xml, "counter", counter_name_reads(disk_name).c_str());
             mxmlElementSetAttr(reads_xml, "title", "Disk I/O");
             const std::string counter_display_name_reads = "Reads: " + disk_name;
             mxmlElementSetAttr(reads_xml, "name", counter_display_name_reads.c_str());
             mxmlElementSetAttr(reads_xml, "units", "B");
 
-            std::string counter_name_writes = "diskstats_" + disk_name + "_writes";
             auto * writes_xml = mxmlNewElement(node, "event");
-            mxmlElementSetAttr(writes_xml, "counter", counter_name_writes.data());
+            mxmlElementSetAttr(writes_xml, "counter", counter_name_writes(disk_name).c_str());
             mxmlElementSetAttr(writes_xml, "title", "Disk I/O");
             const std::string counter_display_name_writes = "Writes: " + disk_name;
             mxmlElementSetAttr(writes_xml, "name", counter_display_name_writes.c_str());
@@ -194,47 +202,110 @@ void DiskIODriver::writeEvents(mxml_node_t * root) const
     }
 }
 
-void DiskIODriver::doRead()
+DiskIOCounter * DiskIODriver::findDiskIOCounter(std::string const & name) const
 {
-    if (!countersEnabled()) {
-        return;
+    for (DriverCounter * counter = getCounters(); counter != nullptr; counter = counter->getNext()) {
+        if (name == counter->getName()) {
+            return static_cast<DiskIOCounter *>(counter);
+        }
     }
+    return nullptr;
+}
 
-    uint64_t totalWriteBytes = 0;
-    uint64_t totalReadBytes = 0;
+void DiskIODriver::buildDiskIndex()
+{
+    mTotalReads = findDiskIOCounter(std::string(TOTAL_READS_NAME));
+    mTotalWrites = findDiskIOCounter(std::string(TOTAL_WRITES_NAME));
+    mDisks.clear();
 
     std::string current_partition_name {};
-    for (const auto & [disk_name, read_bytes, write_bytes] : parse_diskstats_names_and_usage()) {
+    for (auto & disk_name : parse_diskstats_names(mBuf)) {
         // If a disk name starts with a previously seen disk name it's a
         // partition e.g. sda1 is a partition of sda
         const bool disk_is_not_a_partition = !lib::starts_with(disk_name, current_partition_name);
         const bool first_disk = current_partition_name.empty();
-        if (first_disk || disk_is_not_a_partition) {
-            totalReadBytes += read_bytes;
-            totalWriteBytes += write_bytes;
+        const bool counts_towards_total = first_disk || disk_is_not_a_partition;
+        if (counts_towards_total) {
             current_partition_name = disk_name;
         }
 
-        const std::string counter_name_reads = "diskstats_" + disk_name + "_reads";
-        const std::string counter_name_writes = "diskstats_" + disk_name + "_writes";
-        for (DriverCounter * counter = getCounters(); counter != nullptr; counter = counter->getNext()) {
-            auto * diskIoCounter = dynamic_cast<DiskIOCounter *>(counter);
-            if (strcmp(diskIoCounter->getName(), counter_name_reads.c_str()) == 0) {
-                diskIoCounter->set(static_cast<int64_t>(read_bytes));
-            }
-            if (strcmp(diskIoCounter->getName(), counter_name_writes.c_str()) == 0) {
-                diskIoCounter->set(static_cast<int64_t>(write_bytes));
-            }
-        }
+        // disks that appeared after readEvents have no counters, but may still contribute to the totals
+        auto * reads = findDiskIOCounter(counter_name_reads(disk_name));
+        auto * writes = findDiskIOCounter(counter_name_writes(disk_name));
+        mDisks.push_back(disk_t {std::move(disk_name), reads, writes, counts_towards_total});
     }
+}
 
-    for (DriverCounter * counter = getCounters(); counter != nullptr; counter = counter->getNext()) {
-        auto * diskIoCounter = dynamic_cast<DiskIOCounter *>(counter);
-        if (strcmp(diskIoCounter->getName(), "Linux_block_rq_rd") == 0) {
-            diskIoCounter->set(totalReadBytes);
+bool DiskIODriver::applyDiskstats()
+{
+    uint64_t totalWriteBytes = 0;
+    uint64_t totalReadBytes = 0;
+
+    std::size_t index = 0;
+    std::string_view text {mBuf.getBuf(), mBuf.getLength()};
+    while (!text.empty()) {
+        auto const line = next_line(text);
+        diskstats_fields_t fields {};
+        auto const count = split_diskstats_line(line, fields);
+        if (count == 0) {
+            continue;
+        }
+
+        // any change in the set of disks invalidates the index
+        if ((count < MIN_LINE_LEN_FOR_NAME_AND_USAGE) || (index >= mDisks.size())
+            || (mDisks[index].name != fields[NAME_INDEX])) {
+            return false;
+        }
+
+        uint64_t read_bytes = 0;
+        uint64_t write_bytes = 0;
+        if (!parse_u64(fields[READ_INDEX], read_bytes) || !parse_u64(fields[WRITE_INDEX], write_bytes)) {
+            return false;
+        }
+
+        auto const & disk = mDisks[index++];
+        if (disk.counts_towards_total) {
+            totalReadBytes += read_bytes;
+            totalWriteBytes += write_bytes;
         }
-        if (strcmp(diskIoCounter->getName(), "Linux_block_rq_wr") == 0) {
-            diskIoCounter->set(totalWriteBytes);
+        if (disk.reads != nullptr) {
+            disk.reads->set(read_bytes);
+        }
+        if (disk.writes != nullptr) {
+            disk.writes->set(write_bytes);
+        }
+    }
+
+    if (index != mDisks.size()) {
+        return false;
+    }
+
+    if (mTotalReads != nullptr) {
+        mTotalReads->set(totalReadBytes);
+    }
+    if (mTotalWrites != nullptr) {
+        mTotalWrites->set(totalWriteBytes);
+    }
+    return true;
+}
+
+void DiskIODriver::doRead()
+{
+    if (!countersEnabled()) {
+        return;
+    }
+
+    if (!mFd || !mBuf.pread(*mFd)) {
+        LOG_ERROR("Unable to read /proc/diskstats");
+        handleException();
+    }
+
+    if (!applyDiskstats()) {
+        // the set of disks changed (or the file is malformed), so rebuild the index and try once more
+        buildDiskIndex();
+        if (!applyDiskstats()) {
+            LOG_ERROR("Unable to parse /proc/diskstats");
+            handleException();
         }
     }
 }
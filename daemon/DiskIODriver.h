@@ -1,10 +1,16 @@
-/* Copyright (C) 2013-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #ifndef DISKIODRIVER_H
 #define DISKIODRIVER_H
 
 #include "DynBuf.h"
 #include "PolledDriver.h"
+#include "lib/AutoClosingFd.h"
+
+#include <string>
+#include <vector>
+
+class DiskIOCounter;
 
 class DiskIODriver : public PolledDriver {
 private:
@@ -25,7 +31,25 @@ public:
     void writeEvents(mxml_node_t * root) const override;
 
 private:
+    /** One line of /proc/diskstats, and the counters it feeds */
+    struct disk_t {
+        std::string name;
+        DiskIOCounter * reads;
+        DiskIOCounter * writes;
+        bool counts_towards_total;
+    };
+
     void doRead();
+    bool applyDiskstats();
+    void buildDiskIndex();
+    [[nodiscard]] DiskIOCounter * findDiskIOCounter(std::string const & name) const;
+
+    lib::AutoClosingFd mFd {};
+    DynBuf mBuf {};
+    // in /proc/diskstats line order
+    std::vector<disk_t> mDisks {};
+    DiskIOCounter * mTotalReads {nullptr};
+    DiskIOCounter * mTotalWrites {nullptr};
 };
 
 #endif // DISKIODRIVER_H
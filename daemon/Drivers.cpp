@@ -84,6 +84,7 @@ Drivers::Drivers(CaptureOperationMode captureOperationMode,
     all.push_back(&mCcnDriver);
     all.push_back(&mArmnnDriver);
     all.push_back(&mPerfettoDriver);
+    allPolled.push_back(&mPerfettoDriver);
 
     auto staticEventsXml = events_xml::getStaticTree(mPrimarySourceProvider->getCpuInfo().getClusters(),
                                                      mPrimarySourceProvider->getDetectedUncorePmus());
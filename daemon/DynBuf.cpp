@@ -85,6 +85,37 @@ fail:
     return result;
 }
 
+bool DynBuf::pread(const int fd)
+{
+    length = 0;
+
+    for (;;) {
+        const size_t minCapacity = length + MIN_BUFFER_FREE + 1;
+        if (capacity < minCapacity) {
+            if (resize(minCapacity) != 0) {
+                LOG_DEBUG("DynBuf::resize failed");
+                return false;
+            }
+        }
+
+        const ssize_t bytes = ::pread(fd, buf + length, capacity - length - 1, static_cast<off_t>(length));
+        if (bytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG_DEBUG("pread failed");
+            return false;
+        }
+        if (bytes == 0) {
+            break;
+        }
+        length += bytes;
+    }
+
+    buf[length] = '\0';
+    return true;
+}
+
 int DynBuf::readlink(const char * const path)
 {
     ssize_t bytes = MIN_BUFFER_FREE;
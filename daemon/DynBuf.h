@@ -28,6 +28,12 @@ public:
     }
 
     bool read(const char * path);
+    /**
+     * Read the whole contents of an already open file from offset zero using pread, so that the
+     * same fd may be re-read repeatedly (e.g. procfs files that are polled). Once the buffer has
+     * grown to fit the file no further allocation is performed.
+     */
+    bool pread(int fd);
     // On error instead of printing the error and returning false, this returns -errno
     int readlink(const char * path);
     __attribute__((format(printf, 2, 3))) bool printf(const char * format, ...);
@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cerrno>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <map>
 #include <optional>
@@ -43,9 +45,25 @@ namespace {
     constexpr int GATOR_ANNOTATION_PORT2 = 8083;
     constexpr int GATOR_MAX_VALUE_PORT = 65535;
     constexpr int SPE_MAX_SAMPLE_RATE = 1000000000;
+    constexpr int POLLED_COUNTER_MAX_RATE = 10000;
+    constexpr int MALI_MAX_SAMPLE_RATE = 100000;
+    constexpr int PERFETTO_MIN_BUFFER_SIZE_KB = 256;
+    constexpr int PERFETTO_MAX_BUFFER_SIZE_KB = 256 * 1024;
+    constexpr int PERFETTO_MIN_FLUSH_PERIOD_MS = 10;
+    // perfetto will not write into the file more often than this
+    constexpr int PERFETTO_MIN_FILE_WRITE_PERIOD_MS = 100;
+    constexpr int PERFETTO_MAX_PERIOD_MS = 10000;
 
     enum {
         OPT_METRIC_MODE = 256,
+        OPT_POLLED_COUNTER_RATE,
+        OPT_MALI_RAW_COUNTERS,
+        OPT_MALI_SAMPLE_RATE,
+        OPT_PERFETTO_BUFFER,
+        OPT_PERFETTO_FLUSH,
+        OPT_PERFETTO_WRITE,
+        OPT_SEND_PRIORITY,
+        OPT_SPE_FILTER,
     };
 
     constexpr const char * OPTSTRING_SHORT =
@@ -54,50 +72,58 @@ namespace {
     const struct option OPTSTRING_LONG[] = { // PLEASE KEEP THIS LIST IN ALPHANUMERIC ORDER TO ALLOW EASY SELECTION
                                              // OF NEW ITEMS.
                                              // Remaining free letters are: bjqyBGHKU
-        {"allow-command", /**********/ no_argument, /***/ nullptr, 'a'},             //
-        {"config-xml", /*************/ required_argument, nullptr, 'c'},             //
-        {"debug", /******************/ no_argument, /***/ nullptr, 'd'},             //
-        {"events-xml", /*************/ required_argument, nullptr, 'e'},             //
-        {"use-efficient-ftrace", /***/ required_argument, nullptr, 'f'},             //
-        {"gpu-timeline", /***********/ required_argument, nullptr, 'g'},             //
-        {"help", /*******************/ no_argument, /***/ nullptr, 'h'},             //
-        {"pid", /********************/ required_argument, nullptr, 'i'},             //
-        {"exclude-kernel", /*********/ required_argument, nullptr, 'k'},             //
-        ANDROID_PACKAGE,                                                             //
-        ANDROID_ACTIVITY,                                                            //
-        PACKAGE_FLAGS,                                                               //
-        {"output", /*****************/ required_argument, nullptr, 'o'},             //
-        {"port", /*******************/ required_argument, nullptr, 'p'},             //
-        {"sample-rate", /************/ required_argument, nullptr, 'r'},             //
-        {"session-xml", /************/ required_argument, nullptr, 's'},             //
-        {"max-duration", /***********/ required_argument, nullptr, 't'},             //
-        {"call-stack-unwinding", /***/ required_argument, nullptr, 'u'},             //
-        {"version", /****************/ no_argument, /***/ nullptr, 'v'},             //
-        {"app-cwd", /****************/ required_argument, nullptr, 'w'},             //
-        {"stop-on-exit", /***********/ required_argument, nullptr, 'x'},             //
-        {"smmuv3-model", /***********/ required_argument, nullptr, 'z'},             //
-        APP,                                                                         //
-        {"counters", /***************/ required_argument, nullptr, 'C'},             //
-        {"disable-kernel-annotations", no_argument, /***/ nullptr, 'D'},             //
-        {"append-events-xml", /******/ required_argument, nullptr, 'E'},             //
-        {"spe-sample-rate", /********/ required_argument, nullptr, 'F'},             //
-        {"inherit", /****************/ required_argument, nullptr, 'I'},             //
-        {"probe-report", /***********/ no_argument, /***/ nullptr, 'J'},             //
-        {"capture-log", /************/ no_argument, /***/ nullptr, 'L'},             //
-        {"metric-group", /***********/ required_argument, nullptr, 'M'},             //
-        {"num-pmu-counters", /*******/ required_argument, nullptr, 'N'},             //
-        {"disable-cpu-onlining", /***/ required_argument, nullptr, 'O'},             //
-        {"pmus-xml", /***************/ required_argument, nullptr, 'P'},             //
-        WAIT_PROCESS,                                                                //
-        {"print", /******************/ required_argument, nullptr, 'R'},             //
-        {"system-wide", /************/ required_argument, nullptr, 'S'},             //
-        {"trace", /******************/ no_argument, /***/ nullptr, 'T'},             //
-        {"version", /****************/ no_argument, /***/ nullptr, 'V'},             //
-        {"workflow", /***************/ required_argument, nullptr, 'W'},             //
-        {"spe", /********************/ required_argument, nullptr, 'X'},             //
-        {"off-cpu-time", /***********/ required_argument, nullptr, 'Y'},             //
-        {"mmap-pages", /*************/ required_argument, nullptr, 'Z'},             //
-        {"metric-mode", /************/ required_argument, nullptr, OPT_METRIC_MODE}, //
+        {"allow-command", /**********/ no_argument, /***/ nullptr, 'a'},                     //
+        {"config-xml", /*************/ required_argument, nullptr, 'c'},                     //
+        {"debug", /******************/ no_argument, /***/ nullptr, 'd'},                     //
+        {"events-xml", /*************/ required_argument, nullptr, 'e'},                     //
+        {"use-efficient-ftrace", /***/ required_argument, nullptr, 'f'},                     //
+        {"gpu-timeline", /***********/ required_argument, nullptr, 'g'},                     //
+        {"help", /*******************/ no_argument, /***/ nullptr, 'h'},                     //
+        {"pid", /********************/ required_argument, nullptr, 'i'},                     //
+        {"exclude-kernel", /*********/ required_argument, nullptr, 'k'},                     //
+        ANDROID_PACKAGE,                                                                     //
+        ANDROID_ACTIVITY,                                                                    //
+        PACKAGE_FLAGS,                                                                       //
+        {"output", /*****************/ required_argument, nullptr, 'o'},                     //
+        {"port", /*******************/ required_argument, nullptr, 'p'},                     //
+        {"sample-rate", /************/ required_argument, nullptr, 'r'},                     //
+        {"session-xml", /************/ required_argument, nullptr, 's'},                     //
+        {"max-duration", /***********/ required_argument, nullptr, 't'},                     //
+        {"call-stack-unwinding", /***/ required_argument, nullptr, 'u'},                     //
+        {"version", /****************/ no_argument, /***/ nullptr, 'v'},                     //
+        {"app-cwd", /****************/ required_argument, nullptr, 'w'},                     //
+        {"stop-on-exit", /***********/ required_argument, nullptr, 'x'},                     //
+        {"smmuv3-model", /***********/ required_argument, nullptr, 'z'},                     //
+        APP,                                                                                 //
+        {"counters", /***************/ required_argument, nullptr, 'C'},                     //
+        {"disable-kernel-annotations", no_argument, /***/ nullptr, 'D'},                     //
+        {"append-events-xml", /******/ required_argument, nullptr, 'E'},                     //
+        {"spe-sample-rate", /********/ required_argument, nullptr, 'F'},                     //
+        {"inherit", /****************/ required_argument, nullptr, 'I'},                     //
+        {"probe-report", /***********/ no_argument, /***/ nullptr, 'J'},                     //
+        {"capture-log", /************/ no_argument, /***/ nullptr, 'L'},                     //
+        {"metric-group", /***********/ required_argument, nullptr, 'M'},                     //
+        {"num-pmu-counters", /*******/ required_argument, nullptr, 'N'},                     //
+        {"disable-cpu-onlining", /***/ required_argument, nullptr, 'O'},                     //
+        {"pmus-xml", /***************/ required_argument, nullptr, 'P'},                     //
+        WAIT_PROCESS,                                                                        //
+        {"print", /******************/ required_argument, nullptr, 'R'},                     //
+        {"system-wide", /************/ required_argument, nullptr, 'S'},                     //
+        {"trace", /******************/ no_argument, /***/ nullptr, 'T'},                     //
+        {"version", /****************/ no_argument, /***/ nullptr, 'V'},                     //
+        {"workflow", /***************/ required_argument, nullptr, 'W'},                     //
+        {"spe", /********************/ required_argument, nullptr, 'X'},                     //
+        {"off-cpu-time", /***********/ required_argument, nullptr, 'Y'},                     //
+        {"mmap-pages", /*************/ required_argument, nullptr, 'Z'},                     //
+        {"metric-mode", /************/ required_argument, nullptr, OPT_METRIC_MODE},         //
+        {"polled-counter-rate", /****/ required_argument, nullptr, OPT_POLLED_COUNTER_RATE}, //
+        {"mali-raw-counters", /******/ required_argument, nullptr, OPT_MALI_RAW_COUNTERS},   //
+        {"mali-sample-rate", /*******/ required_argument, nullptr, OPT_MALI_SAMPLE_RATE},    //
+        {"perfetto-buffer-size", /***/ required_argument, nullptr, OPT_PERFETTO_BUFFER},     //
+        {"perfetto-flush-period", /**/ required_argument, nullptr, OPT_PERFETTO_FLUSH},      //
+        {"perfetto-write-period", /**/ required_argument, nullptr, OPT_PERFETTO_WRITE},      //
+        {"send-priority", /**********/ required_argument, nullptr, OPT_SEND_PRIORITY},       //
+        {"spe-filter", /*************/ required_argument, nullptr, OPT_SPE_FILTER},           //
         {nullptr, 0, nullptr, 0}};
 
     const char PRINTABLE_SEPARATOR = ',';
@@ -218,6 +244,29 @@ namespace {
         return false;
     }
 
+    /**
+     * Parse an integer option value that must be within [min, max]
+     *
+     * @return the value, or -1 if it is invalid (in which case the error is added to the result)
+     */
+    int parseIntInRange(ParserResult & result, const char * option, const char * value, int min, int max)
+    {
+        int parsed = -1;
+        if (!stringToInt(&parsed, value, OlyBase::Decimal)) {
+            result.error_messages.emplace_back(lib::Format() << "Invalid value for " << option << " (" << value
+                                                             << "): not an integer");
+            result.parsingFailed();
+            return -1;
+        }
+        if ((parsed < min) || (parsed > max)) {
+            result.error_messages.emplace_back(lib::Format() << "Invalid value for " << option << " (" << value
+                                                             << "): must be between " << min << " and " << max);
+            result.parsingFailed();
+            return -1;
+        }
+        return parsed;
+    }
+
     std::string_view slice(std::string const & src, int startpos, int pos)
     {
         std::size_t const len = pos - startpos;
@@ -233,6 +282,105 @@ namespace {
         return {data, ""};
     }
 
+    /**
+     * Parse the --send-priority value, a comma separated list of <source>=<priority>
+     *
+     * Any error is added to the result
+     */
+    void parseSendPriorities(ParserResult & result, const char * value)
+    {
+        static const std::map<std::string_view, SenderChannel> channels {
+            {"perf", SenderChannel::perf},
+            {"external", SenderChannel::external},
+            {"mali", SenderChannel::mali},
+            {"userspace", SenderChannel::userspace},
+            {"armnn", SenderChannel::armnn},
+        };
+        static const std::map<std::string_view, SendPriority> priorities {
+            {"high", SendPriority::high},
+            {"normal", SendPriority::normal},
+            {"bulk", SendPriority::bulk},
+        };
+
+        std::vector<std::string> parts;
+        split(value, PRINTABLE_SEPARATOR, parts);
+
+        for (auto const & part : parts) {
+            auto const [channel, priority] = split_one(part, '=');
+            auto const channelIt = channels.find(channel);
+            auto const priorityIt = priorities.find(priority);
+            if ((channelIt == channels.end()) || (priorityIt == priorities.end())) {
+                result.error_messages.emplace_back(lib::Format()
+                                                   << "Invalid value for --send-priority (" << part
+                                                   << "): expected <perf|external|mali|userspace|armnn>="
+                                                      "<high|normal|bulk>");
+                result.parsingFailed();
+                return;
+            }
+            result.mSendPriorities[channelIt->second] = priorityIt->second;
+        }
+    }
+
+    /** Parse an address for --spe-filter, in decimal or in hex with a 0x prefix */
+    std::optional<std::uint64_t> parseSpeFilterAddress(std::string_view value)
+    {
+        std::string const str {value};
+        if (str.empty() || (str[0] == '-')) {
+            return {};
+        }
+
+        char * end = nullptr;
+        errno = 0;
+        auto const result = std::strtoull(str.c_str(), &end, 0);
+        if ((errno != 0) || (*end != '\0')) {
+            return {};
+        }
+        return result;
+    }
+
+    /**
+     * Parse the --spe-filter value, a comma separated list of pc=<start>-<end>, va=<start>-<end> or tid=<tid>
+     *
+     * Any error is added to the result
+     */
+    void parseSpeFilter(ParserResult & result, const char * value)
+    {
+        std::vector<std::string> parts;
+        split(value, PRINTABLE_SEPARATOR, parts);
+
+        for (auto const & part : parts) {
+            auto const [key, filter] = split_one(part, '=');
+            bool valid = false;
+
+            if ((key == "pc") || (key == "va")) {
+                auto const [startStr, endStr] = split_one(filter, '-');
+                auto const start = parseSpeFilterAddress(startStr);
+                auto const end = parseSpeFilterAddress(endStr);
+                if (start && end && (*start < *end)) {
+                    auto & range = (key == "pc" ? result.mSpeFilter.pc_range : result.mSpeFilter.data_address_range);
+                    range = agents::perf::spe_filter_config_t::address_range_t {*start, *end};
+                    valid = true;
+                }
+            }
+            else if (key == "tid") {
+                // the kernel writes the thread id (not the process id) to CONTEXTIDR
+                int tid = 0;
+                if (stringToInt(&tid, std::string(filter).c_str(), OlyBase::Decimal) && (tid > 0)) {
+                    result.mSpeFilter.context_ids.insert(tid);
+                    valid = true;
+                }
+            }
+
+            if (!valid) {
+                result.error_messages.emplace_back(lib::Format()
+                                                   << "Invalid value for --spe-filter (" << part
+                                                   << "): expected pc=<start>-<end>, va=<start>-<end> or tid=<tid>");
+                result.parsingFailed();
+                return;
+            }
+        }
+    }
+
     EventCode parseEvent(std::string_view event, ParserResult & result)
     {
         if (event.empty()) {
@@ -964,6 +1112,82 @@ void GatorCLIParser::parseCLIArguments(int argc,
                 }
                 break;
             }
+            case OPT_POLLED_COUNTER_RATE: {
+                result.mPolledCounterRate = -1;
+                if (!stringToInt(&result.mPolledCounterRate, optarg, OlyBase::Decimal)) {
+                    result.error_messages.emplace_back(lib::Format() << "Invalid value for --polled-counter-rate ("
+                                                                     << optarg << "): not an integer");
+                    result.parsingFailed();
+                    result.mPolledCounterRate = -1;
+                }
+                else if ((result.mPolledCounterRate < 1) || (result.mPolledCounterRate > POLLED_COUNTER_MAX_RATE)) {
+                    result.error_messages.emplace_back(lib::Format() << "Invalid value for --polled-counter-rate ("
+                                                                     << optarg << "): must be between 1 and "
+                                                                     << POLLED_COUNTER_MAX_RATE);
+                    result.parsingFailed();
+                    result.mPolledCounterRate = -1;
+                }
+                break;
+            }
+            case OPT_MALI_RAW_COUNTERS: {
+                if (optionInt < 0) {
+                    result.error_messages.emplace_back(lib::Format() << "Invalid value for --mali-raw-counters ("
+                                                                     << optarg << "), 'yes' or 'no' expected.");
+                    result.parsingFailed();
+                    return;
+                }
+                result.mMaliRawCounters = optionInt == 1;
+                break;
+            }
+            case OPT_MALI_SAMPLE_RATE: {
+                result.mMaliSampleRate = -1;
+                if (!stringToInt(&result.mMaliSampleRate, optarg, OlyBase::Decimal)) {
+                    result.error_messages.emplace_back(lib::Format() << "Invalid value for --mali-sample-rate ("
+                                                                     << optarg << "): not an integer");
+                    result.parsingFailed();
+                    result.mMaliSampleRate = -1;
+                }
+                else if ((result.mMaliSampleRate < 1) || (result.mMaliSampleRate > MALI_MAX_SAMPLE_RATE)) {
+                    result.error_messages.emplace_back(lib::Format() << "Invalid value for --mali-sample-rate ("
+                                                                     << optarg << "): must be between 1 and "
+                                                                     << MALI_MAX_SAMPLE_RATE);
+                    result.parsingFailed();
+                    result.mMaliSampleRate = -1;
+                }
+                break;
+            }
+            case OPT_PERFETTO_BUFFER: {
+                result.mPerfettoBufferSizeKb = parseIntInRange(result,
+                                                               "--perfetto-buffer-size",
+                                                               optarg,
+                                                               PERFETTO_MIN_BUFFER_SIZE_KB,
+                                                               PERFETTO_MAX_BUFFER_SIZE_KB);
+                break;
+            }
+            case OPT_PERFETTO_FLUSH: {
+                result.mPerfettoFlushPeriodMs = parseIntInRange(result,
+                                                                "--perfetto-flush-period",
+                                                                optarg,
+                                                                PERFETTO_MIN_FLUSH_PERIOD_MS,
+                                                                PERFETTO_MAX_PERIOD_MS);
+                break;
+            }
+            case OPT_PERFETTO_WRITE: {
+                result.mPerfettoFileWritePeriodMs = parseIntInRange(result,
+                                                                    "--perfetto-write-period",
+                                                                    optarg,
+                                                                    PERFETTO_MIN_FILE_WRITE_PERIOD_MS,
+                                                                    PERFETTO_MAX_PERIOD_MS);
+                break;
+            }
+            case OPT_SEND_PRIORITY: {
+                parseSendPriorities(result, optarg);
+                break;
+            }
+            case OPT_SPE_FILTER: {
+                parseSpeFilter(result, optarg);
+                break;
+            }
             case ':': // Missing argument
             case '?': // Unrecognised
             default: {
@@ -1064,6 +1288,11 @@ void GatorCLIParser::parseCLIArguments(int argc,
             result.parsingFailed();
             return;
         }
+        if (result.mSpeFilter.is_enabled()) {
+            result.error_messages.emplace_back("--spe-filter is not applicable in daemon mode.");
+            result.parsingFailed();
+            return;
+        }
     }
 
     if ((result.mAndroidActivity != nullptr) && (result.mAndroidPackage == nullptr)) {
@@ -1252,6 +1481,10 @@ mode specify an output directory with --output.
                                         Values below this threshold are ignored
                                         and the hardware minimum is used
                                         instead.
+  --polled-counter-rate <n>             Specify the rate, in Hz, at which the
+                                        memory, network and disk I/O counters
+                                        are polled (defaults to 10, maximum
+                                        10000).
   -L|--capture-log                      Enable to generate a log file for
                                         the capture in the capture's directory,
                                         as well as sending the logs to 'stderr'.
@@ -1298,6 +1531,45 @@ mode specify an output directory with --output.
                                         without error. Note: Timeline data is
                                         provided by a layer driver loaded into
                                         your application.
+  --mali-raw-counters (yes|no)          Send the raw Mali GPU hardware counter
+                                        blocks for every sample, rather than
+                                        the per-counter values summed over the
+                                        shader cores and L2 slices. The
+                                        default is 'no'.
+  --mali-sample-rate <n>                Specify the rate, in Hz, at which Mali
+                                        GPU hardware counters are sampled,
+                                        overriding the rate chosen by
+                                        --sample-rate (maximum 100000). At
+                                        high rates the driver may not keep up;
+                                        any samples it drops are reported by
+                                        the 'Dropped samples' counter.
+  --perfetto-buffer-size <KiB>          Specify the size of the trace buffer used
+                                        to collect Mali Timeline data from
+                                        perfetto (between 256 and 262144,
+                                        defaults to 8192). Any data lost
+                                        because the buffer filled up is
+                                        reported by the 'Perfetto overruns'
+                                        counter.
+  --perfetto-flush-period <ms>          Specify how often perfetto flushes the
+                                        Mali Timeline data into its trace
+                                        buffer (between 10 and 10000, defaults
+                                        to 100).
+  --perfetto-write-period <ms>          Specify how often perfetto writes the
+                                        trace buffer out to gatord (between 100
+                                        and 10000, defaults to 100).
+  --send-priority <source>=<priority>[,<source>=<priority>...]
+                                        Specify how the data from each source
+                                        is scheduled onto the connection to
+                                        Streamline, so that latency sensitive
+                                        data is not held up behind bulk data.
+                                        <source> is one of perf, external
+                                        (annotations, ftrace and Mali
+                                        Timeline), mali (Mali hardware
+                                        counters), userspace (polled counters)
+                                        or armnn. <priority> is one of high,
+                                        normal or bulk. By default perf is
+                                        bulk, external is normal and the rest
+                                        are high.
 
 * Arguments available only on Android targets:
 
@@ -1395,6 +1667,26 @@ mode specify an output directory with --output.
                                           invert the SPE event filter. This value is
                                           ignored if the device does not support SPE 1.2
                                           By default this is disabled.
+  --spe-filter <filter>[,<filter>...]   Only send the SPE records that match all
+                                        of the filters. Unlike the filters in
+                                        --spe these are applied by gatord on the
+                                        target, after the records have been
+                                        written by the hardware. Where <filter>
+                                        is one of:
+                                        * pc=<start>-<end> to keep records whose
+                                          PC is in the range [<start>,<end>).
+                                        * va=<start>-<end> to keep records whose
+                                          data virtual address is in the range
+                                          [<start>,<end>).
+                                        * tid=<tid> to keep records from the
+                                          thread <tid>. This is a thread id, so
+                                          for a multithreaded process give each
+                                          of its threads. May be given more than
+                                          once. Requires a kernel built with
+                                          CONFIG_PID_IN_CONTEXTIDR, and kernel
+                                          events to be enabled.
+                                        Addresses are decimal, or hex with a 0x
+                                        prefix.
 )";
 /*                                                                              ^ */
 /*                                                                              | */
@@ -616,6 +616,14 @@ void updateSessionData(const ParserResult & result)
     gSessionData.mStopOnExit = result.mStopGator;
     gSessionData.mPerfMmapSizeInPages = result.mPerfMmapSizeInPages;
     gSessionData.mSpeSampleRate = result.mSpeSampleRate;
+    gSessionData.mSpeFilter = result.mSpeFilter;
+    gSessionData.mPolledCounterRate = result.mPolledCounterRate;
+    gSessionData.mMaliRawCounters = result.mMaliRawCounters;
+    gSessionData.mMaliSampleRate = result.mMaliSampleRate;
+    gSessionData.mPerfettoBufferSizeKb = result.mPerfettoBufferSizeKb;
+    gSessionData.mPerfettoFlushPeriodMs = result.mPerfettoFlushPeriodMs;
+    gSessionData.mPerfettoFileWritePeriodMs = result.mPerfettoFileWritePeriodMs;
+    gSessionData.mSendPriorities = result.mSendPriorities;
     gSessionData.mAndroidPackage = result.mAndroidPackage;
     gSessionData.mAndroidActivity = result.mAndroidActivity;
     gSessionData.mAndroidActivityFlags = (result.mAndroidActivityFlags == nullptr) ? "" : result.mAndroidActivityFlags;
@@ -1070,6 +1078,9 @@ int gator_main(int argc, char ** argv)
     global_logging->add_sink<logging::std_log_sink_t>();
     logging::set_logger(global_logging);
 
+    // apply any per-module log filter (which is inherited by the agents via the environment)
+    logging::set_log_module_filter_from_env();
+
     // and enable debug mode
     global_logging->set_debug_enabled(GatorCLIParser::hasDebugFlag(argc, argv));
 
@@ -1,7 +1,9 @@
-/* Copyright (C) 2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
+#include "lib/Span.h"
+
 #include <cstdint>
 
 /**
@@ -40,6 +42,26 @@ public:
      */
     virtual bool event64(int key, int64_t value) = 0;
 
+    /** A key/value pair as passed to events64 */
+    struct event64_t {
+        int key;
+        int64_t value;
+    };
+
+    /**
+     * add several 64 bit counter values to the frame for the current core/TID
+     * @return true if they could all be written
+     */
+    virtual bool events64(lib::Span<const event64_t> events)
+    {
+        for (const auto & event : events) {
+            if (!event64(event.key, event.value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * commits the currently built up frame if needed
      * @return true if the current frame was committed (which resets core/tid/timestamp)
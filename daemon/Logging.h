@@ -1,36 +1,50 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
 #include "Config.h"
 #include "logging/parameters.h"
 
+#include <atomic>
+#include <cstdint>
 #include <string_view>
 
 #define LOG_ITEM(level, format, ...)                                                                                   \
     ::logging::detail::do_log_item((level), lib::source_loc_t {__FILE__, __LINE__}, (format), ##__VA_ARGS__)
 
-#if CONFIG_LOG_TRACE
-/** Log a 'trace' level item */
-#define LOG_TRACE(format, ...)                                                                                         \
+/**
+ * Log some verbose (trace, debug or fine) level item, subject to the compile time minimum level and the runtime
+ * per-module filter. When filtered out, the arguments are not evaluated.
+ */
+#define LOG_FILTERED_ITEM(level, format, ...)                                                                          \
     do {                                                                                                               \
-        if (::logging::is_log_enable_trace()) {                                                                        \
-            LOG_ITEM(::logging::log_level_t::trace, (format), ##__VA_ARGS__);                                          \
+        if constexpr (::logging::is_log_level_compiled_in(level)) {                                                    \
+            if (LOG_LEVEL_ENABLED(level)) {                                                                            \
+                LOG_ITEM((level), (format), ##__VA_ARGS__);                                                            \
+            }                                                                                                          \
         }                                                                                                              \
     } while (false)
-#else
-/** ignore LOG_TRACE */
-template<typename... Args>
-inline void LOG_TRACE(char const *, Args &&...)
-{
-}
-#endif
+
+/** @return true if an item logged at `level` from the calling source file would be written */
+#define LOG_LEVEL_ENABLED(level)                                                                                       \
+    ([]() noexcept {                                                                                                   \
+        if constexpr (::logging::is_log_level_compiled_in(level)) {                                                    \
+            static ::logging::detail::call_site_filter_t log_call_site_filter {__FILE__};                              \
+            return log_call_site_filter.is_enabled(level);                                                             \
+        }                                                                                                              \
+        else {                                                                                                         \
+            return false;                                                                                              \
+        }                                                                                                              \
+    }())
+
+/** Log a 'trace' level item */
+#define LOG_TRACE(format, ...) LOG_FILTERED_ITEM(::logging::log_level_t::trace, (format), ##__VA_ARGS__)
 
 /** Log a 'debug' level item */
-#define LOG_DEBUG(format, ...) LOG_ITEM(::logging::log_level_t::debug, (format), ##__VA_ARGS__)
+#define LOG_DEBUG(format, ...) LOG_FILTERED_ITEM(::logging::log_level_t::debug, (format), ##__VA_ARGS__)
 
 /** Log a 'fine' level item */
-#define LOG_FINE(format, ...) LOG_ITEM(::logging::log_level_t::fine, (format), ##__VA_ARGS__)
+#define LOG_FINE(format, ...) LOG_FILTERED_ITEM(::logging::log_level_t::fine, (format), ##__VA_ARGS__)
 
 /** Log a 'info' level item */
 #define LOG_INFO(format, ...) LOG_ITEM(::logging::log_level_t::info, (format), ##__VA_ARGS__)
@@ -78,8 +92,59 @@ inline void LOG_TRACE(char const *, Args &&...)
 
 namespace logging {
 
+    /** @return true for the verbose levels that may be compiled out, or filtered per module */
+    constexpr bool is_filtered_log_level(log_level_t level)
+    {
+        return (level == log_level_t::trace) || (level == log_level_t::debug) || (level == log_level_t::fine);
+    }
+
+    /** The most verbose level that is compiled in */
+    constexpr log_level_t min_compiled_in_log_level = log_level_t(CONFIG_LOG_MIN_LEVEL);
+
+    /** @return true if call sites for `level` are compiled in (see CONFIG_LOG_MIN_LEVEL) */
+    constexpr bool is_log_level_compiled_in(log_level_t level)
+    {
+        return (!is_filtered_log_level(level)) || (level >= min_compiled_in_log_level);
+    }
+
     // internal helper functions used by the macros; use the macros for convenience sake
     namespace detail {
+        /** Incremented each time the runtime filter changes, so that call_site_filter_t can refresh its cache */
+        extern std::atomic<std::uint32_t> log_filter_generation;
+
+        /** @return the minimum enabled level for items logged from `file` */
+        [[nodiscard]] log_level_t lookup_min_log_level(char const * file) noexcept;
+
+        /**
+         * Caches the result of the runtime filter for a single call site, so that the common case of the filter not
+         * having changed is a single relaxed load and compare.
+         */
+        class call_site_filter_t {
+        public:
+            constexpr explicit call_site_filter_t(char const * file) noexcept : file(file) {}
+
+            [[nodiscard]] bool is_enabled(log_level_t level) noexcept
+            {
+                auto const generation = log_filter_generation.load(std::memory_order_relaxed);
+                auto state = cached_state.load(std::memory_order_relaxed);
+
+                if ((state >> level_bits) != (generation & generation_mask)) {
+                    state = ((generation & generation_mask) << level_bits) | std::uint8_t(lookup_min_log_level(file));
+                    cached_state.store(state, std::memory_order_relaxed);
+                }
+
+                return std::uint8_t(level) >= (state & level_mask);
+            }
+
+        private:
+            static constexpr unsigned level_bits = 8;
+            static constexpr std::uint32_t level_mask = (1U << level_bits) - 1;
+            static constexpr std::uint32_t generation_mask = ~std::uint32_t(0) >> level_bits;
+
+            char const * file;
+            /** The generation in the upper bits, and the minimum level in the lower bits; 0 is never valid */
+            std::atomic<std::uint32_t> cached_state {0};
+        };
 
         /** Write out a log item */
         //NOLINTNEXTLINE(cert-dcl50-cpp)
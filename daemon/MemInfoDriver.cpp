@@ -1,17 +1,21 @@
-/* Copyright (C) 2013-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #include "MemInfoDriver.h"
 
 #include "DriverCounter.h"
 #include "Logging.h"
 #include "PolledDriver.h"
+#include "lib/Syscall.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
-#include <cstdlib>
-#include <cstring>
+#include <string_view>
+#include <system_error>
 
+#include <fcntl.h>
 #include <mxml.h>
-#include <unistd.h>
 
 class MemInfoCounter : public DriverCounter {
 public:
@@ -39,64 +43,127 @@ int64_t MemInfoCounter::read()
     return *mValue;
 }
 
+namespace {
+    /** Split off the next line from 'text', returning the line (without the '\n') */
+    std::string_view next_line(std::string_view & text)
+    {
+        auto const end = text.find('\n');
+        auto const line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        return line;
+    }
+
+    /** Parse the kB value following the ':' in a meminfo line */
+    bool parse_kb_value(std::string_view text, int64_t & value)
+    {
+        auto const start = text.find_first_not_of(" \t");
+        if (start == std::string_view::npos) {
+            return false;
+        }
+        int64_t kb = 0;
+        auto const [ptr, ec] = std::from_chars(text.data() + start, text.data() + text.size(), kb);
+        if (ec != std::errc {}) {
+            return false;
+        }
+        value = kb << 10;
+        return true;
+    }
+}
+
 void MemInfoDriver::readEvents(mxml_node_t * const /*unused*/)
 {
-    if (access("/proc/meminfo", R_OK) == 0) {
+    mFd = lib::open("/proc/meminfo", O_RDONLY | O_CLOEXEC);
+    if (mFd) {
         setCounters(new MemInfoCounter(getCounters(), "Linux_meminfo_memused2", &mMemUsed));
         setCounters(new MemInfoCounter(getCounters(), "Linux_meminfo_memfree", &mMemFree));
         setCounters(new MemInfoCounter(getCounters(), "Linux_meminfo_bufferram", &mBuffers));
         setCounters(new MemInfoCounter(getCounters(), "Linux_meminfo_cached", &mCached));
         setCounters(new MemInfoCounter(getCounters(), "Linux_meminfo_slab", &mSlab));
+
+        // precompute which lines hold the values we want, so that polling need not compare every key
+        mFieldIndexValid = mBuf.pread(*mFd) && buildFieldIndex();
     }
     else {
         LOG_SETUP("Linux counters\nCannot access /proc/meminfo. Memory usage counters not available.");
     }
 }
 
-void MemInfoDriver::read(IBlockCounterFrameBuilder & buffer)
+bool MemInfoDriver::buildFieldIndex()
 {
-    if (!countersEnabled()) {
-        return;
-    }
+    std::string_view text {mBuf.getBuf(), mBuf.getLength()};
 
-    if (!mBuf.read("/proc/meminfo")) {
-        LOG_ERROR("Failed to read /proc/meminfo");
-        handleException();
+    for (auto & field : mFields) {
+        field.line = NO_LINE;
     }
 
-    char * key = mBuf.getBuf();
-    char * colon;
-    int64_t memTotal = 0;
-    while ((colon = strchr(key, ':')) != nullptr) {
-        char * end = strchr(colon + 1, '\n');
-        if (end != nullptr) {
-            *end = '\0';
+    mFieldCount = 0;
+    for (std::size_t line_no = 0; !text.empty(); ++line_no) {
+        auto const line = next_line(text);
+        auto const key = line.substr(0, line.find(':'));
+        for (auto & field : mFields) {
+            if (key == field.key) {
+                field.line = line_no;
+                mFieldCount += 1;
+            }
         }
-        *colon = '\0';
+    }
 
-        if (strcmp(key, "MemTotal") == 0) {
-            memTotal = strtoll(colon + 1, nullptr, 10) << 10;
-        }
-        else if (strcmp(key, "MemFree") == 0) {
-            mMemFree = strtoll(colon + 1, nullptr, 10) << 10;
-        }
-        else if (strcmp(key, "Buffers") == 0) {
-            mBuffers = strtoll(colon + 1, nullptr, 10) << 10;
+    if (mFieldCount == 0) {
+        LOG_DEBUG("Unable to locate any required fields in /proc/meminfo");
+        return false;
+    }
+
+    // any missing fields sort to the end and are left at zero
+    std::sort(mFields.begin(), mFields.end(), [](field_t const & a, field_t const & b) { return a.line < b.line; });
+    return true;
+}
+
+bool MemInfoDriver::parseFields()
+{
+    std::size_t index = 0;
+    std::string_view text {mBuf.getBuf(), mBuf.getLength()};
+
+    for (std::size_t line_no = 0; (index < mFieldCount) && !text.empty(); ++line_no) {
+        auto const line = next_line(text);
+        auto & field = mFields[index];
+        if (line_no != field.line) {
+            continue;
         }
-        else if (strcmp(key, "Cached") == 0) {
-            mCached = strtoll(colon + 1, nullptr, 10) << 10;
+
+        // the layout may only change if the kernel changes, but validate the key anyway
+        if ((line.size() <= field.key.size()) || (line.compare(0, field.key.size(), field.key) != 0)
+            || (line[field.key.size()] != ':')) {
+            return false;
         }
-        else if (strcmp(key, "Slab") == 0) {
-            mSlab = strtoll(colon + 1, nullptr, 10) << 10;
+        if (!parse_kb_value(line.substr(field.key.size() + 1), *field.value)) {
+            return false;
         }
+        index += 1;
+    }
+
+    return index == mFieldCount;
+}
+
+void MemInfoDriver::read(IBlockCounterFrameBuilder & buffer)
+{
+    if (!countersEnabled()) {
+        return;
+    }
+
+    if (!mFd || !mBuf.pread(*mFd)) {
+        LOG_ERROR("Failed to read /proc/meminfo");
+        handleException();
+    }
 
-        if (end == nullptr) {
-            break;
+    if (!mFieldIndexValid || !parseFields()) {
+        mFieldIndexValid = buildFieldIndex() && parseFields();
+        if (!mFieldIndexValid) {
+            LOG_ERROR("Failed to parse /proc/meminfo");
+            handleException();
         }
-        key = end + 1;
     }
 
-    mMemUsed = memTotal - mMemFree;
+    mMemUsed = mMemTotal - mMemFree;
 
     super::read(buffer);
 }
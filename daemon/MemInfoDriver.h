@@ -1,10 +1,16 @@
-/* Copyright (C) 2013-2021 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #ifndef MEMINFODRIVER_H
 #define MEMINFODRIVER_H
 
 #include "DynBuf.h"
 #include "PolledDriver.h"
+#include "lib/AutoClosingFd.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 class MemInfoDriver : public PolledDriver {
 private:
@@ -23,12 +29,36 @@ public:
     void read(IBlockCounterFrameBuilder & buffer) override;
 
 private:
+    /** Maps a /proc/meminfo key to the line it appears on and the value it is stored into */
+    static constexpr std::size_t NO_LINE = SIZE_MAX;
+
+    struct field_t {
+        std::string_view key;
+        int64_t * value;
+        std::size_t line;
+    };
+
+    bool buildFieldIndex();
+    bool parseFields();
+
+    lib::AutoClosingFd mFd {};
     DynBuf mBuf {};
+    int64_t mMemTotal {0};
     int64_t mMemUsed {0};
     int64_t mMemFree {0};
     int64_t mBuffers {0};
     int64_t mCached {0};
     int64_t mSlab {0};
+    // sorted by line once the index is built
+    std::array<field_t, 5> mFields {{
+        {"MemTotal", &mMemTotal, NO_LINE},
+        {"MemFree", &mMemFree, NO_LINE},
+        {"Buffers", &mBuffers, NO_LINE},
+        {"Cached", &mCached, NO_LINE},
+        {"Slab", &mSlab, NO_LINE},
+    }};
+    std::size_t mFieldCount {0};
+    bool mFieldIndexValid {false};
 };
 
 #endif // MEMINFODRIVER_H
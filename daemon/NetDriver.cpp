@@ -1,22 +1,20 @@
-/* Copyright (C) 2013-2023 by Arm Limited. All rights reserved. */
-
-// Define to get format macros from inttypes.h
-#define __STDC_FORMAT_MACROS
-// must be before includes
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #include "NetDriver.h"
 
 #include "DriverCounter.h"
 #include "Logging.h"
 #include "PolledDriver.h"
+#include "lib/Syscall.h"
 
-#include <cinttypes>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>
-#include <cstring>
+#include <string_view>
+#include <system_error>
 
+#include <fcntl.h>
 #include <mxml.h>
-#include <unistd.h>
 
 class NetCounter : public DriverCounter {
 public:
@@ -47,9 +45,30 @@ int64_t NetCounter::read()
     return result;
 }
 
+namespace {
+    constexpr std::size_t RX_BYTES_INDEX = 0;
+    constexpr std::size_t TX_BYTES_INDEX = 8;
+
+    /** Parse the next whitespace separated unsigned value from 'text', consuming it */
+    bool next_value(std::string_view & text, uint64_t & value)
+    {
+        auto const start = text.find_first_not_of(" \t");
+        if (start == std::string_view::npos) {
+            return false;
+        }
+        auto const [ptr, ec] = std::from_chars(text.data() + start, text.data() + text.size(), value);
+        if (ec != std::errc {}) {
+            return false;
+        }
+        text.remove_prefix(ptr - text.data());
+        return true;
+    }
+}
+
 void NetDriver::readEvents(mxml_node_t * const /*unused*/)
 {
-    if (access("/proc/net/dev", R_OK) == 0) {
+    mFd = lib::open("/proc/net/dev", O_RDONLY | O_CLOEXEC);
+    if (mFd) {
         setCounters(new NetCounter(getCounters(), "Linux_net_rx", &mReceiveBytes));
         setCounters(new NetCounter(getCounters(), "Linux_net_tx", &mTransmitBytes));
     }
@@ -64,46 +83,53 @@ bool NetDriver::doRead()
         return true;
     }
 
-    if (!mBuf.read("/proc/net/dev")) {
+    if (!mFd || !mBuf.pread(*mFd)) {
         return false;
     }
 
+    std::string_view text {mBuf.getBuf(), mBuf.getLength()};
+
     // Skip the header
-    char * key;
-    if (((key = strchr(mBuf.getBuf(), '\n')) == nullptr) || ((key = strchr(key + 1, '\n')) == nullptr)) {
-        return false;
+    for (int header_line = 0; header_line < 2; ++header_line) {
+        auto const end = text.find('\n');
+        if (end == std::string_view::npos) {
+            return false;
+        }
+        text.remove_prefix(end + 1);
     }
-    key = key + 1;
 
     mReceiveBytes = 0;
     mTransmitBytes = 0;
 
-    char * colon;
-    while ((colon = strchr(key, ':')) != nullptr) {
-        char * end = strchr(colon + 1, '\n');
-        if (end != nullptr) {
-            *end = '\0';
-        }
-        *colon = '\0';
-
-        uint64_t receiveBytes;
-        uint64_t transmitBytes;
+    while (!text.empty()) {
+        auto const end = text.find('\n');
+        auto line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
 
-        // NOLINTNEXTLINE(cert-err34-c)
-        const int count = sscanf(colon + 1, //
-                                 " %" SCNu64 " %*u %*u %*u %*u %*u %*u %*u %" SCNu64,
-                                 &receiveBytes,
-                                 &transmitBytes);
-        if (count != 2) {
-            return false;
+        auto const colon = line.find(':');
+        if (colon == std::string_view::npos) {
+            break;
         }
+        line.remove_prefix(colon + 1);
+
+        // receive bytes is the first field, transmit bytes the ninth
+        uint64_t receiveBytes = 0;
+        uint64_t transmitBytes = 0;
+        for (std::size_t index = 0; index <= TX_BYTES_INDEX; ++index) {
+            uint64_t value = 0;
+            if (!next_value(line, value)) {
+                return false;
+            }
+            if (index == RX_BYTES_INDEX) {
+                receiveBytes = value;
+            }
+            else if (index == TX_BYTES_INDEX) {
+                transmitBytes = value;
+            }
+        }
+
         mReceiveBytes += receiveBytes;
         mTransmitBytes += transmitBytes;
-
-        if (end == nullptr) {
-            break;
-        }
-        key = end + 1;
     }
 
     return true;
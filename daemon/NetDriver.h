@@ -1,10 +1,13 @@
-/* Copyright (C) 2013-2021 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #ifndef NETDRIVER_H
 #define NETDRIVER_H
 
 #include "DynBuf.h"
 #include "PolledDriver.h"
+#include "lib/AutoClosingFd.h"
+
+#include <cstdint>
 
 class NetDriver : public PolledDriver {
 private:
@@ -26,6 +29,7 @@ public:
 private:
     bool doRead();
 
+    lib::AutoClosingFd mFd {};
     DynBuf mBuf {};
     uint64_t mReceiveBytes {0};
     uint64_t mTransmitBytes {0};
@@ -4,6 +4,7 @@
 #define PARSERRESULT_H_
 
 #include "Configuration.h"
+#include "agents/perf/spe_record_filter.hpp"
 #include "linux/smmu_identifier.h"
 #include "metrics/definitions.hpp"
 #include "metrics/metric_group_set.hpp"
@@ -65,6 +66,13 @@ public:
     int mDuration {0};
     int mPerfMmapSizeInPages {-1};
     int mSpeSampleRate {-1};
+    agents::perf::spe_filter_config_t mSpeFilter {};
+    int mPolledCounterRate {-1};
+    int mMaliSampleRate {-1};
+    int mPerfettoBufferSizeKb {-1};
+    int mPerfettoFlushPeriodMs {-1};
+    int mPerfettoFileWritePeriodMs {-1};
+    std::map<SenderChannel, SendPriority> mSendPriorities {};
     int mOverrideNoPmuSlots {-1};
     int port {DEFAULT_PORT};
     GPUTimelineEnablement mGPUTimelineEnablement {GPUTimelineEnablement::automatic};
@@ -79,6 +87,7 @@ public:
     bool mDisableKernelAnnotations {false};
     bool mExcludeKernelEvents {false};
     bool mEnableOffCpuSampling {false};
+    bool mMaliRawCounters {false};
     bool mLogToFile {false};
     bool mHasProbeReportFlag {false};
 
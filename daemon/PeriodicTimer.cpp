@@ -0,0 +1,116 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+// Define to get format macros from inttypes.h
+#define __STDC_FORMAT_MACROS
+// must be before includes
+
+#include "PeriodicTimer.h"
+
+#include "Logging.h"
+#include "Time.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdint>
+#include <ctime>
+
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace {
+    timespec to_timespec(std::uint64_t ns)
+    {
+        return {static_cast<time_t>(ns / NS_PER_S), static_cast<long>(ns % NS_PER_S)};
+    }
+}
+
+bool PeriodicTimer::start(std::uint64_t periodNs)
+{
+    // timerfd does not support CLOCK_MONOTONIC_RAW, so the deadlines are in CLOCK_MONOTONIC. The two only
+    // differ by NTP slewing which is negligible over one period; the sample timestamps remain CLOCK_MONOTONIC_RAW.
+    mFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (!mFd) {
+        LOG_ERROR("timerfd_create failed (%d)", errno);
+        return false;
+    }
+
+    mPeriod = periodNs;
+    mNextDeadline = getClockMonotonicTime() + mPeriod;
+    mStats = {};
+
+    itimerspec spec {};
+    spec.it_interval = to_timespec(mPeriod);
+    spec.it_value = to_timespec(mNextDeadline);
+    if (timerfd_settime(*mFd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+        LOG_ERROR("timerfd_settime failed (%d)", errno);
+        mFd.close();
+        return false;
+    }
+
+    return true;
+}
+
+std::uint64_t PeriodicTimer::wait()
+{
+    std::uint64_t expirations = 0;
+    for (;;) {
+        const ssize_t bytes = ::read(*mFd, &expirations, sizeof(expirations));
+        if (bytes == sizeof(expirations)) {
+            break;
+        }
+        if ((bytes < 0) && (errno == EINTR)) {
+            continue;
+        }
+        return 0;
+    }
+
+    // jitter is measured against the most recent deadline that expired
+    const std::uint64_t now = getClockMonotonicTime();
+    const std::uint64_t deadline = mNextDeadline + (expirations - 1) * mPeriod;
+    const std::uint64_t jitter = (now > deadline ? now - deadline : 0);
+    mNextDeadline = deadline + mPeriod;
+
+    std::size_t bucket = 0;
+    while ((bucket + 1 < NUM_JITTER_BUCKETS) && (jitter >= bucketLimitUs(bucket) * NS_PER_US)) {
+        ++bucket;
+    }
+
+    mStats.buckets[bucket] += 1;
+    mStats.wakeups += 1;
+    mStats.missed += expirations - 1;
+    mStats.minNs = std::min(mStats.minNs, jitter);
+    mStats.maxNs = std::max(mStats.maxNs, jitter);
+    mStats.totalNs += jitter;
+
+    return expirations;
+}
+
+void PeriodicTimer::logStats(const char * name) const
+{
+    if (mStats.wakeups == 0) {
+        return;
+    }
+
+    LOG_INFO("%s timer jitter: period=%" PRIu64 "ns wakeups=%" PRIu64 " missed=%" PRIu64 " min=%" PRIu64
+             "ns mean=%" PRIu64 "ns max=%" PRIu64 "ns",
+             name,
+             mPeriod,
+             mStats.wakeups,
+             mStats.missed,
+             mStats.minNs,
+             mStats.totalNs / mStats.wakeups,
+             mStats.maxNs);
+
+    for (std::size_t bucket = 0; bucket < NUM_JITTER_BUCKETS; ++bucket) {
+        if (mStats.buckets[bucket] == 0) {
+            continue;
+        }
+        if (bucket + 1 < NUM_JITTER_BUCKETS) {
+            LOG_INFO("    < %" PRIu64 "us: %" PRIu64, bucketLimitUs(bucket), mStats.buckets[bucket]);
+        }
+        else {
+            LOG_INFO("    >= %" PRIu64 "us: %" PRIu64, bucketLimitUs(bucket - 1), mStats.buckets[bucket]);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#ifndef PERIODIC_TIMER_H
+#define PERIODIC_TIMER_H
+
+#include "lib/AutoClosingFd.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A periodic timer backed by a timerfd armed with absolute deadlines, so that sampling does not drift and
+ * late wakeups do not accumulate. Records the wakeup jitter (how late each wakeup is relative to its deadline)
+ * so that the distribution can be reported at the end of the capture.
+ */
+class PeriodicTimer {
+public:
+    /** Jitter buckets are powers of two in microseconds; the last bucket holds everything larger */
+    static constexpr std::size_t NUM_JITTER_BUCKETS = 21;
+
+    struct Stats {
+        std::array<std::uint64_t, NUM_JITTER_BUCKETS> buckets {};
+        std::uint64_t wakeups {0};
+        std::uint64_t missed {0};
+        std::uint64_t minNs {UINT64_MAX};
+        std::uint64_t maxNs {0};
+        std::uint64_t totalNs {0};
+    };
+
+    /** Returns the upper bound (exclusive) of some jitter bucket, in microseconds */
+    static constexpr std::uint64_t bucketLimitUs(std::size_t bucket) { return std::uint64_t(1) << bucket; }
+
+    /**
+     * Create and arm the timer
+     *
+     * @param periodNs The period between deadlines
+     * @return True if the timer was created, false otherwise
+     */
+    bool start(std::uint64_t periodNs);
+
+    /**
+     * Block until the next deadline expires
+     *
+     * @return The number of periods that elapsed since the last call (greater than 1 if some deadlines were
+     * missed), or 0 on error
+     */
+    std::uint64_t wait();
+
+    /** Explicitly stop the timer */
+    void stop() { mFd.close(); }
+
+    [[nodiscard]] const Stats & getStats() const { return mStats; }
+
+    /** Log the jitter distribution */
+    void logStats(const char * name) const;
+
+private:
+    lib::AutoClosingFd mFd {};
+    std::uint64_t mPeriod {0};
+    std::uint64_t mNextDeadline {0};
+    Stats mStats {};
+};
+
+#endif // PERIODIC_TIMER_H
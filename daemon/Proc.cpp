@@ -1,4 +1,4 @@
-/* Copyright (C) 2013-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #include "Proc.h"
 
@@ -53,11 +53,13 @@ namespace {
 
     private:
         IPerfAttrsConsumer & buffer;
+        // reused for each of the maps files
+        std::string mapsContents {};
 
         void onProcessDirectory(int pid, const lib::FsEntry & path) override
         {
             const lib::FsEntry mapsFile = lib::FsEntry::create(path, "maps");
-            const std::string mapsContents = lib::readFileContents(mapsFile);
+            (void) mapsFile.readFileInto(mapsContents);
 
             buffer.marshalMaps(pid, pid, mapsContents.c_str());
         }
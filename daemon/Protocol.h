@@ -1,4 +1,4 @@
-/* Copyright (C) 2013-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #ifndef PROTOCOL_H
 #define PROTOCOL_H
@@ -20,6 +20,7 @@ enum class FrameType : char {
     PERF_SYNC = 15,
     // METADATA = 16,
     // ARMNN = 17, not released
+    GPU_RAW_COUNTERS = 18,
 };
 
 // PERF_ATTR messages
@@ -1,5 +1,8 @@
-/* Copyright (C) 2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2024-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 /* Define the product protocol version */
 #define PROTOCOL_VERSION 950
+
+/* The protocol version that adds GPU_RAW_COUNTERS frames; only announced when those frames are enabled */
+#define PROTOCOL_VERSION_GPU_RAW_COUNTERS 951
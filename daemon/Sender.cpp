@@ -1,13 +1,13 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 #include "Sender.h"
 
 #include "BufferUtils.h"
+#include "Configuration.h"
 #include "ISender.h"
 #include "Logging.h"
 #include "OlySocket.h"
 #include "ProductVersion.h"
-#include "ProtocolVersion.h"
 #include "SessionData.h"
 #include "Time.h"
 #include "lib/File.h"
@@ -19,13 +19,18 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 
-#include <pthread.h>
 #include <unistd.h>
 
-Sender::Sender(OlySocket * socket)
-    : mDataSocket(socket), mDataFile(nullptr, fclose), mDataFileName(nullptr), mSendMutex()
+Sender::Sender(OlySocket * socket) : mDataSocket(socket), mDataFile(nullptr, fclose), mDataFileName(nullptr)
 {
+    for (std::size_t n = 0; n < NUMBER_OF_CHANNELS; ++n) {
+        mChannels[n] = std::make_unique<Channel>(*this, getPriority(static_cast<SenderChannel>(n)));
+    }
+
     // Set up the socket connection
     if (socket != nullptr) {
         uint8_t streamline[64] = {0};
@@ -41,19 +46,13 @@ Sender::Sender(OlySocket * socket)
         }
 
         // Send magic sequence - must be done first, after which error messages can be sent
-        lib::printf_str_t<32> magic {"GATOR %i\n", PROTOCOL_VERSION};
+        lib::printf_str_t<32> magic {"GATOR %i\n", gSessionData.getProtocolVersion()};
         mDataSocket->send(reinterpret_cast<const uint8_t *>(magic.c_str()), strlen(magic));
 
         gSessionData.mWaitingOnCommand = true;
         LOG_DEBUG("Completed magic sequence");
     }
 
-    pthread_mutexattr_t attr;
-    if (pthread_mutexattr_init(&attr) != 0 || pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ERRORCHECK) != 0
-        || pthread_mutex_init(&mSendMutex, &attr) != 0 || pthread_mutexattr_destroy(&attr) != 0) {
-        LOG_ERROR("Unable to setup mutex");
-        handleException();
-    }
 }
 
 Sender::~Sender()
@@ -80,9 +79,104 @@ void Sender::createDataFile(const char * apcDir)
     }
 }
 
+SendPriority Sender::getPriority(SenderChannel channel)
+{
+    auto const it = gSessionData.mSendPriorities.find(channel);
+    if (it != gSessionData.mSendPriorities.end()) {
+        return it->second;
+    }
+
+    switch (channel) {
+        case SenderChannel::perf:
+            return SendPriority::bulk;
+        case SenderChannel::external:
+            return SendPriority::normal;
+        case SenderChannel::mali:
+        case SenderChannel::userspace:
+        case SenderChannel::armnn:
+            break;
+    }
+    return SendPriority::high;
+}
+
+bool Sender::isTurnOf(SendPriority priority) const
+{
+    if (mSending) {
+        return false;
+    }
+
+    auto const index = static_cast<std::size_t>(priority);
+
+    // once the lowest priority waiter has been passed over too often, it goes next; otherwise the highest does
+    if (mBypasses >= MAX_CONSECUTIVE_BYPASSES) {
+        for (std::size_t n = NUMBER_OF_PRIORITIES; n-- > index + 1;) {
+            if (mWaiting[n] > 0) {
+                return false;
+            }
+        }
+    }
+    else {
+        for (std::size_t n = 0; n < index; ++n) {
+            if (mWaiting[n] > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Sender::acquireTurn(SendPriority priority, bool ignoreLockErrors)
+{
+    std::unique_lock<std::mutex> lock {mTurnMutex};
+
+    // a thread that fails part way through sending may try to send the error
+    if (mSending && (mSendingThread == std::this_thread::get_id())) {
+        if (ignoreLockErrors) {
+            return false;
+        }
+        LOG_ERROR("Recursive send detected");
+        handleException();
+    }
+
+    auto const index = static_cast<std::size_t>(priority);
+
+    mWaiting[index] += 1;
+    mTurnChanged.wait(lock, [this, priority]() { return isTurnOf(priority); });
+    mWaiting[index] -= 1;
+
+    mSending = true;
+    mSendingThread = std::this_thread::get_id();
+
+    bool bypassedAny = false;
+    for (std::size_t n = index + 1; n < NUMBER_OF_PRIORITIES; ++n) {
+        bypassedAny |= (mWaiting[n] > 0);
+    }
+    mBypasses = (bypassedAny ? mBypasses + 1 : 0);
+
+    return true;
+}
+
+void Sender::releaseTurn()
+{
+    {
+        std::lock_guard<std::mutex> lock {mTurnMutex};
+        mSending = false;
+        mSendingThread = {};
+    }
+    mTurnChanged.notify_all();
+}
+
 void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataParts,
                             ResponseType type,
                             bool ignoreLockErrors)
+{
+    writeDataParts(dataParts, type, SendPriority::high, ignoreLockErrors);
+}
+
+void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataParts,
+                            ResponseType type,
+                            SendPriority priority,
+                            bool ignoreLockErrors)
 {
     int length = 0;
     for (const auto & data : dataParts) {
@@ -104,12 +198,8 @@ void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataP
     }
 
     // Multiple threads call writeData()
-    if (pthread_mutex_lock(&mSendMutex) != 0) {
-        if (ignoreLockErrors) {
-            return;
-        }
-        LOG_ERROR("pthread_mutex_lock failed");
-        handleException();
+    if (!acquireTurn(priority, ignoreLockErrors)) {
+        return;
     }
 
     // Send data over the socket connection
@@ -127,7 +217,9 @@ void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataP
             mDataSocket->send(header, sizeof(header));
         }
 
-        auto const startTime = getTime();
+        // the bandwidth is only needed for the debug log
+        auto const log_bandwidth = LOG_LEVEL_ENABLED(::logging::log_level_t::debug);
+        auto const startTime = (log_bandwidth ? getTime() : 0);
         auto totalSize = 0ULL;
 
         // 1MiB/sec * alarmDuration sec
@@ -151,11 +243,13 @@ void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataP
         // Stop alarm
         alarm(0);
 
-        auto const endTime = getTime();
-        auto const duration = endTime - startTime;
-        auto const bandwidth = (totalSize * 1000000000ULL) / duration;
+        if (log_bandwidth) {
+            auto const endTime = getTime();
+            auto const duration = endTime - startTime;
+            auto const bandwidth = (totalSize * 1000000000ULL) / duration;
 
-        LOG_DEBUG("Sender bandwidth %lluB/s", static_cast<unsigned long long>(bandwidth));
+            LOG_DEBUG("Sender bandwidth %lluB/s", static_cast<unsigned long long>(bandwidth));
+        }
     }
 
     // Write data to disk as long as it is not meta data
@@ -175,7 +269,9 @@ void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataP
             writeData(header);
         }
 
-        auto const startTime = getTime();
+        // the bandwidth is only needed for the debug log
+        auto const log_bandwidth = LOG_LEVEL_ENABLED(::logging::log_level_t::debug);
+        auto const startTime = (log_bandwidth ? getTime() : 0);
         auto totalSize = 0ULL;
 
         for (const auto & data : dataParts) {
@@ -183,15 +279,14 @@ void Sender::writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataP
             writeData(data);
         }
 
-        auto const endTime = getTime();
-        auto const duration = endTime - startTime;
-        auto const bandwidth = (totalSize * 1000000000ULL) / duration;
+        if (log_bandwidth) {
+            auto const endTime = getTime();
+            auto const duration = endTime - startTime;
+            auto const bandwidth = (totalSize * 1000000000ULL) / duration;
 
-        LOG_DEBUG("Disk write bandwidth %lluB/s", static_cast<unsigned long long>(bandwidth));
+            LOG_DEBUG("Disk write bandwidth %lluB/s", static_cast<unsigned long long>(bandwidth));
+        }
     }
 
-    if (pthread_mutex_unlock(&mSendMutex) != 0) {
-        LOG_ERROR("pthread_mutex_unlock failed");
-        handleException();
-    }
+    releaseTurn();
 }
@@ -1,18 +1,51 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 #ifndef __SENDER_H__
 #define __SENDER_H__
 
+#include "Configuration.h"
 #include "ISender.h"
 
+#include <array>
+#include <condition_variable>
 #include <cstdio>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 class OlySocket;
 
+/**
+ * Sends the responses to Streamline.
+ *
+ * Streamline reads all of the data from one connection, so each source writes through its own Channel instead,
+ * and when several channels are waiting to send, the one with the highest priority goes next. This stops the
+ * low volume, latency sensitive sources from being held up behind bulk data such as SPE.
+ */
 class Sender : public ISender {
 public:
+    /** The sender for one source */
+    class Channel : public ISender {
+    public:
+        Channel(Sender & sender, SendPriority priority) : mSender(sender), mPriority(priority) {}
+
+        void writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataParts,
+                            ResponseType type,
+                            bool ignoreLockErrors = false) override
+        {
+            mSender.writeDataParts(dataParts, type, mPriority, ignoreLockErrors);
+        }
+
+        [[nodiscard]] SendPriority getPriority() const { return mPriority; }
+
+    private:
+        Sender & mSender;
+        SendPriority mPriority;
+    };
+
+    /** The number of turns a waiting channel may be passed over by higher priority channels before it goes next */
+    static constexpr int MAX_CONSECUTIVE_BYPASSES = 8;
+
     Sender(OlySocket * socket);
     ~Sender() override;
 
@@ -22,16 +55,42 @@ public:
     Sender(Sender &&) = delete;
     Sender & operator=(Sender &&) = delete;
 
+    /** @return The priority of the source's channel, either as set by --send-priority or the default */
+    [[nodiscard]] static SendPriority getPriority(SenderChannel channel);
+
+    /** @return The channel for some source */
+    [[nodiscard]] Channel & getChannel(SenderChannel channel) { return *mChannels[static_cast<std::size_t>(channel)]; }
+
+    /** Writes a response that is not from any source (control responses, errors and the log) at high priority */
     void writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataParts,
                         ResponseType type,
                         bool ignoreLockErrors = false) override;
+    void writeDataParts(lib::Span<const lib::Span<const uint8_t, int>> dataParts,
+                        ResponseType type,
+                        SendPriority priority,
+                        bool ignoreLockErrors);
     void createDataFile(const char * apcDir);
 
 private:
+    static constexpr std::size_t NUMBER_OF_PRIORITIES = static_cast<std::size_t>(SendPriority::bulk) + 1;
+    static constexpr std::size_t NUMBER_OF_CHANNELS = static_cast<std::size_t>(SenderChannel::armnn) + 1;
+
     OlySocket * mDataSocket;
+    std::array<std::unique_ptr<Channel>, NUMBER_OF_CHANNELS> mChannels {};
     std::unique_ptr<FILE, int (*)(FILE *)> mDataFile;
     std::unique_ptr<char[]> mDataFileName;
-    pthread_mutex_t mSendMutex;
+
+    // Multiple threads call writeData(); these decide whose turn it is to send
+    std::mutex mTurnMutex {};
+    std::condition_variable mTurnChanged {};
+    std::array<int, NUMBER_OF_PRIORITIES> mWaiting {};
+    std::thread::id mSendingThread {};
+    bool mSending {false};
+    int mBypasses {0};
+
+    [[nodiscard]] bool isTurnOf(SendPriority priority) const;
+    [[nodiscard]] bool acquireTurn(SendPriority priority, bool ignoreLockErrors);
+    void releaseTurn();
 };
 
 #endif //__SENDER_H__
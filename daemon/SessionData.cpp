@@ -5,6 +5,7 @@
 #include "Configuration.h"
 #include "GatorCLIFlags.h"
 #include "Logging.h"
+#include "ProtocolVersion.h"
 #include "SessionXML.h"
 #include "lib/SharedMemory.h"
 
@@ -55,6 +56,12 @@ void SessionData::initialize()
     parameterSetFlag = 0;
 }
 
+int SessionData::getProtocolVersion() const
+{
+    // hosts that do not understand the raw Mali counter frames must not be sent them
+    return (mMaliRawCounters ? PROTOCOL_VERSION_GPU_RAW_COUNTERS : PROTOCOL_VERSION);
+}
+
 void SessionData::parseSessionXML(char * xmlString)
 {
     SessionXML session(xmlString);
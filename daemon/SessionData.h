@@ -6,11 +6,13 @@
 #include "Configuration.h"
 #include "Constant.h"
 #include "Counter.h"
+#include "agents/perf/spe_record_filter.hpp"
 #include "lib/SharedMemory.h"
 #include "linux/smmu_identifier.h"
 
 #include <cstdint>
 #include <list>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -50,6 +52,9 @@ public:
     void initialize();
     void parseSessionXML(char * xmlString);
 
+    /** @return The protocol version to announce to the host, which depends on the frames that may be sent */
+    [[nodiscard]] int getProtocolVersion() const;
+
     shared_memory::unique_ptr<SharedData> mSharedData {};
 
     std::list<std::string> mImages {};
@@ -84,6 +89,18 @@ public:
     int mAnnotateStart {0};
     int mPerfMmapSizeInPages {0};
     int mSpeSampleRate {-1};
+    // the filters applied by the perf agent to the SPE records (--spe-filter)
+    agents::perf::spe_filter_config_t mSpeFilter {};
+    // rate in Hz of the polled (memory, network, disk) counters; <= 0 means use the default
+    int mPolledCounterRate {-1};
+    // rate in Hz of the Mali hardware counters, overriding mSampleRateGpu; <= 0 means not set
+    int mMaliSampleRate {-1};
+    // size in KiB of the perfetto trace buffer, and its flush and write periods in ms; <= 0 means use the default
+    int mPerfettoBufferSizeKb {-1};
+    int mPerfettoFlushPeriodMs {-1};
+    int mPerfettoFileWritePeriodMs {-1};
+    // the priorities set with --send-priority; any source not in the map uses its default priority
+    std::map<SenderChannel, SendPriority> mSendPriorities {};
     int mOverrideNoPmuSlots {-1};
 
     CaptureOperationMode mCaptureOperationMode = CaptureOperationMode::system_wide;
@@ -99,6 +116,8 @@ public:
     bool mFtraceRaw {false};
     bool mExcludeKernelEvents {false};
     bool mEnableOffCpuSampling {false};
+    // send the raw Mali hardware counter blocks rather than the enabled counter values
+    bool mMaliRawCounters {false};
     bool mLogToFile {false};
     GPUTimelineEnablement mUseGPUTimeline {GPUTimelineEnablement::automatic};
 };
@@ -1,8 +1,4 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
-
-// Define to get format macros from inttypes.h
-#define __STDC_FORMAT_MACROS
-// must be before includes
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 // Define to adjust Buffer.h interface,
 #define BUFFER_USE_SESSION_DATA
@@ -13,6 +9,7 @@
 #include "BlockCounterFrameBuilder.h"
 #include "Buffer.h"
 #include "Logging.h"
+#include "PeriodicTimer.h"
 #include "PolledDriver.h"
 #include "SessionData.h"
 #include "Source.h"
@@ -21,7 +18,6 @@
 #include "monotonic_pair.h"
 
 #include <atomic>
-#include <cinttypes>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -29,7 +25,6 @@
 
 #include <semaphore.h>
 #include <sys/prctl.h>
-#include <unistd.h>
 
 class UserSpaceSource : public Source {
 public:
@@ -51,17 +46,20 @@ public:
             }
         }
 
-        constexpr uint64_t tenPerSecond = 10; // Sample ten times a second ignoring gSessionData.mSampleRate
-        uint64_t nextTime = 0;
+        // Sample ten times a second by default, ignoring gSessionData.mSampleRate
+        constexpr uint64_t tenPerSecond = 10;
+        const uint64_t rate =
+            (gSessionData.mPolledCounterRate > 0 ? uint64_t(gSessionData.mPolledCounterRate) : tenPerSecond);
+
+        PeriodicTimer timer {};
+        if (!timer.start(NS_PER_S / rate)) {
+            LOG_ERROR("Unable to start the polled counter timer");
+            handleException();
+        }
+
         while (mSessionIsActive) {
             const uint64_t currTime = getTime() - monotonicStart.monotonic_raw;
 
-            nextTime += NS_PER_S / tenPerSecond; //gSessionData.mSampleRate;
-            if (nextTime < currTime) {
-                LOG_WARNING("Too slow, currTime: %" PRIi64 " nextTime: %" PRIi64, currTime, nextTime);
-                nextTime = currTime;
-            }
-
             BlockCounterFrameBuilder builder {mBuffer, gSessionData.mLiveRate};
             if (builder.eventHeader(currTime)) {
                 for (PolledDriver * usDriver : allUserspaceDrivers) {
@@ -76,9 +74,15 @@ public:
                 endSession();
             }
 
-            usleep((nextTime - currTime) / NS_PER_US);
+            // the timer uses absolute deadlines so a slow iteration does not delay subsequent samples
+            if (timer.wait() == 0) {
+                LOG_ERROR("Failed to wait for the polled counter timer");
+                handleException();
+            }
         }
 
+        timer.logStats("Polled counter");
+
         mBuffer.setDone();
     }
 
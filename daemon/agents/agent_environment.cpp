@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #include "agents/agent_environment.h"
 
 #include "Logging.h"
@@ -96,6 +96,7 @@ namespace agents {
 
         logging::set_logger(agent_logging);
         set_log_enable_trace(args);
+        logging::set_log_module_filter_from_env();
 
         try {
             LOG_FINE("Bootstrapping agent process.");
@@ -126,17 +126,17 @@ namespace agents {
         /**
          * Add the 'armnn' agent worker
          *
-         * @param socket_consumer A reference to an object responsible for forming an armnn::Session from a ISocketIO
+         * @param connection_consumer A reference to the server that manages the armnn connections
          * @param token Some completion token, called asynchronously once the agent is ready
          * @return depends on completion token type
          */
         template<typename CompletionToken>
-        auto async_add_armnn_source(armnn::ISocketIOConsumer & socket_consumer, CompletionToken && token)
+        auto async_add_armnn_source(armnn::ISessionConnectionConsumer & connection_consumer, CompletionToken && token)
         {
             return worker_manager.template async_add_agent<armnn_agent_worker_t>(process_monitor,
                                                                                  agent_privilege_level_t::low,
                                                                                  std::forward<CompletionToken>(token),
-                                                                                 std::ref(socket_consumer));
+                                                                                 std::ref(connection_consumer));
         }
 #endif
 
@@ -146,17 +146,24 @@ namespace agents {
          * Add the 'perfetto' agent worker
          *
          * @param perfetto_souce A reference to the Perfetto class which receives data from the agent process
+         * @param config_msg The trace configuration to send to the agent
+         * @param overruns_observer Called with the total number of trace buffer overruns each time it changes
          * @param token Some completion token, called asynchronously once the agent is ready
          * @return depends on completion token type
          */
         template<typename Perfetto, typename CompletionToken>
-        auto async_add_perfetto_source(Perfetto & perfetto_souce, CompletionToken && token)
+        auto async_add_perfetto_source(Perfetto & perfetto_souce,
+                                       ipc::msg_perfetto_configuration_t config_msg,
+                                       perfetto_overruns_observer_t overruns_observer,
+                                       CompletionToken && token)
         {
             return worker_manager.template async_add_agent<perfetto_agent_worker_t<Perfetto>>(
                 process_monitor,
                 agent_privilege_level_t::high,
                 std::forward<CompletionToken>(token),
-                std::ref(perfetto_souce));
+                std::ref(perfetto_souce),
+                std::move(config_msg),
+                std::move(overruns_observer));
         }
 #endif
 
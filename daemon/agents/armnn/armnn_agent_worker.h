@@ -1,20 +1,21 @@
-/* Copyright (C) 2023-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2023-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "agents/agent_worker_base.h"
 #include "agents/spawn_agent.h"
-#include "armnn/ISocketIO.h"
-#include "armnn/ISocketIOConsumer.h"
-#include "armnn/SocketAcceptor.h"
+#include "armnn/ISender.h"
+#include "armnn/ISessionConnection.h"
+#include "armnn/ISessionConnectionConsumer.h"
 #include "async/continuations/continuation.h"
 #include "async/continuations/operations.h"
 #include "async/continuations/use_continuation.h"
 #include "ipc/messages.h"
 
-#include <cerrno>
-#include <list>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -24,7 +25,6 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/io_context_strand.hpp>
 #include <boost/asio/posix/stream_descriptor.hpp>
-#include <boost/asio/use_future.hpp>
 #include <boost/system/error_code.hpp>
 
 namespace agents {
@@ -43,52 +43,25 @@ namespace agents {
 
         class connection_impl_t;
 
-        class connection_socket_io_t : public armnn::ISocketIO {
+        /** Sends the session's packets to the connection, via the agent */
+        class connection_sender_t : public armnn::ISender {
         public:
-            explicit connection_socket_io_t(std::shared_ptr<connection_impl_t> connection)
+            explicit connection_sender_t(std::weak_ptr<connection_impl_t> connection)
                 : connection(std::move(connection))
             {
             }
 
-            void close() override { connection->close(); }
-
-            [[nodiscard]] bool isOpen() const override { return connection->isOpen(); }
-
-            [[nodiscard]] bool writeExact(lib::Span<const std::uint8_t> buffer) override
-            {
-                if (int const result = connection->send_message(buffer); result != 0) {
-                    if (result < 0) {
-                        errno = -result;
-                        return false;
-                    }
-                };
-                errno = 0;
-                return true;
-            }
-
-            [[nodiscard]] bool readExact(lib::Span<std::uint8_t> buffer) override
+            bool send(std::vector<std::uint8_t> && data) override
             {
-                if (buffer.empty()) {
-                    return true;
-                }
-
-                while (!buffer.empty()) {
-                    auto const n_written = connection->wait_bytes(buffer);
-                    //is the connection empty and closed?
-                    if (n_written == 0) {
-                        return false;
-                    }
-
-                    //move the write location forward, by the number of bytes written, this will adjust the size of the remaining span, and it will be empty when all bytes are written.
-                    buffer = buffer.subspan(n_written);
+                if (auto con = connection.lock()) {
+                    return con->send_message(std::move(data));
                 }
-                return true;
+                return false;
             }
 
-            void interrupt() override { connection->close(); }
-
         private:
-            std::shared_ptr<connection_impl_t> connection;
+            // weak, as the connection owns the session connection that owns this
+            std::weak_ptr<connection_impl_t> connection;
         };
 
         class connection_impl_t : public std::enable_shared_from_this<connection_impl_t> {
@@ -100,131 +73,79 @@ namespace agents {
 
             ~connection_impl_t() = default;
 
-            [[nodiscard]] static std::unique_ptr<armnn::ISocketIO> create_session_adapter(
-                std::shared_ptr<connection_impl_t> const & connection)
+            /** Hand the connection over to the session server */
+            void attach(armnn::ISessionConnectionConsumer & session_consumer)
             {
-                return std::make_unique<connection_socket_io_t>(connection);
+                session_connection = session_consumer.consumeConnection(
+                    std::make_unique<connection_sender_t>(this->weak_from_this()),
+                    [weak_this = this->weak_from_this()]() {
+                        if (auto con = weak_this.lock()) {
+                            con->close();
+                        }
+                    });
+
+                if (!session_connection) {
+                    LOG_DEBUG("armnn session server is stopped; closing connection %d", id);
+                    close();
+                }
             }
 
             /** Handle the 'recv' IPC message variant. The agent received data from a connection. */
             void on_recv_bytes(std::vector<std::uint8_t> && buffer)
             {
-                if (!buffer.empty()) {
-                    std::unique_lock<std::mutex> lock {list_mutex};
-
-                    list_of_received_buffers.emplace_back(std::move(buffer));
-
-                    // unlock before notifying, as the waiting thread will take the lock
-                    lock.unlock();
-
-                    list_notifier.notify_one();
-                }
-            }
-
-            [[nodiscard]] std::size_t wait_bytes(lib::Span<std::uint8_t> buffer)
-            {
-
-                runtime_assert(!buffer.empty(), "Shouldn't get an empty buffer");
-
-                //acquire lock that prevents concurrent access from different threads
-                std::unique_lock<std::mutex> lock {list_mutex};
-
-                //loop while the connection is still active and there are no buffers recieved
-                while (connection_open && list_of_received_buffers.empty()) {
-                    //wait for notification from the recv function that data is available
-                    list_notifier.wait(lock);
-                }
-
-                if (list_of_received_buffers.empty()) {
-                    return 0;
-                }
-
-                //copy out some of the buffer
-                auto & first_buffer = list_of_received_buffers.front();
-                auto const n_to_take = std::min(buffer.size(), first_buffer.size());
-                std::memcpy(buffer.data(), first_buffer.data(), n_to_take);
-
-                //trim bytes of the front buffer
-                if (n_to_take < first_buffer.size()) {
-                    first_buffer.erase(first_buffer.begin(), first_buffer.begin() + n_to_take);
-                }
-                else { //or if empty, remove
-                    list_of_received_buffers.pop_front();
+                if (session_connection && !buffer.empty()) {
+                    session_connection->receiveBytes(std::move(buffer));
                 }
-
-                //tell caller how many were written
-                return n_to_take;
             }
 
+            /** Ask the agent to close the connection, as it was closed by this end */
             void close();
 
+            /** The connection was closed by the agent (or the agent terminated) */
             void notify_terminated()
             {
-                {
-                    const std::lock_guard<std::mutex> lock {list_mutex};
-                    connection_open = false;
+                if (session_connection) {
+                    session_connection->close();
                 }
-                list_notifier.notify_one();
             }
 
-            int send_message(lib::Span<const std::uint8_t> buffer)
+            /** Queue some data to be sent to the connection, via the agent */
+            bool send_message(std::vector<std::uint8_t> && buffer)
             {
                 using namespace async::continuations;
 
-                int result = 0;
-                if (auto st = agent_worker.lock()) {
-                    // close the external source pipe
-                    const auto * p = static_cast<const unsigned char *>(buffer.data());
-                    std::vector<std::uint8_t> charBuffer(p, p + buffer.size());
-
-                    auto fut = async_initiate_cont(
-                        [this, &result, st, charBuffer = std::move(charBuffer)]() {
-                            return st->sink().async_send_message(
-                                       ipc::msg_annotation_send_bytes_t {this->id, charBuffer},
-                                       use_continuation)
-                                 | then([&result, st](auto const & ec,
-                                                      auto const & /*msg*/) -> polymorphic_continuation_t<> {
-                                       if (ec) {
-                                           result = ec.value();
-                                           // EOF means terminated
-                                           if (ec == boost::asio::error::eof) {
-                                               st->transition_state(state_t::terminated);
-                                               return {};
-                                           }
-                                           LOG_DEBUG("Failed to send IPC message due to %s", ec.message().c_str());
-                                       }
-                                       return {};
-                                   });
-                        },
-                        boost::asio::use_future);
-                    fut.get();
-                }
-                else {
-                    result = -ENOSYS;
+                auto st = agent_worker.lock();
+                if (!st) {
+                    return false;
                 }
 
-                return result;
-            }
-            [[nodiscard]] bool isOpen()
-            {
-                const std::lock_guard<std::mutex> lock {list_mutex};
-                return connection_open;
+                spawn("armnn send bytes",
+                      st->sink().async_send_message(ipc::msg_annotation_send_bytes_t {id, std::move(buffer)},
+                                                    use_continuation)
+                          | then([st](auto const & ec, auto const & /*msg*/) {
+                                if (ec) {
+                                    // EOF means terminated
+                                    if (ec == boost::asio::error::eof) {
+                                        st->transition_state(state_t::terminated);
+                                        return;
+                                    }
+                                    LOG_DEBUG("Failed to send IPC message due to %s", ec.message().c_str());
+                                }
+                            }));
+
+                return true;
             }
 
         private:
-            std::mutex list_mutex {};
-            std::condition_variable list_notifier {};
-            std::list<std::vector<std::uint8_t>> list_of_received_buffers {};
-
             weak_ptr_t agent_worker;
             ipc::annotation_uid_t id;
-            bool connection_open {true};
+            std::shared_ptr<armnn::ISessionConnection> session_connection {};
         };
 
         friend class connection_impl_t;
 
         boost::asio::io_context::strand strand;
-        armnn::ISocketIOConsumer & session_consumer;
+        armnn::ISessionConnectionConsumer & session_consumer;
         std::map<ipc::annotation_uid_t, std::shared_ptr<connection_impl_t>> armnn_connections {};
 
         /** @return A continuation that requests the remote target to shutdown */
@@ -343,15 +264,15 @@ namespace agents {
 
             auto con = std::make_shared<connection_impl_t>(this->weak_from_this(), message.header);
 
-            session_consumer.consumeSocket(connection_impl_t::create_session_adapter(con));
-            LOG_FINE("Handed over accepted socket %d", message.header);
-
-            auto inserted = armnn_connections.emplace(message.header, std::move(con)).second;
+            auto inserted = armnn_connections.emplace(message.header, con).second;
 
             if (!inserted) {
                 LOG_ERROR("Failed to create external data pipe, does the UID already exist?");
                 return;
             }
+
+            con->attach(session_consumer);
+            LOG_FINE("Handed over accepted connection %d", message.header);
         }
 
         /** Handle the 'recv' IPC message variant. The agent received data from a connection. */
@@ -427,7 +348,7 @@ namespace agents {
         armnn_agent_worker_t(boost::asio::io_context & io_context,
                              agent_process_t && agent_process,
                              state_change_observer_t && state_change_observer,
-                             armnn::ISocketIOConsumer & session_consumer)
+                             armnn::ISessionConnectionConsumer & session_consumer)
             : agent_worker_base_t(std::move(agent_process), std::move(state_change_observer)),
               strand(io_context),
               session_consumer(session_consumer)
@@ -486,13 +407,7 @@ namespace agents {
 
         if (auto ptr = agent_worker.lock()) {
             LOG_TRACE("Asking armnn agent to close connection %d", id);
-            auto fut =
-                async_initiate_cont([ptr](ipc::annotation_uid_t id) { return ptr->cont_close_annotation_uid(id); },
-                                    boost::asio::use_future,
-                                    id);
-            fut.get();
+            spawn("armnn close connection", ptr->cont_close_annotation_uid(id));
         }
-
-        notify_terminated();
     }
 }
@@ -5,6 +5,7 @@
 #include "agents/perf/events/perf_ringbuffer_mmap.hpp"
 #include "agents/perf/events/types.hpp"
 #include "agents/perf/record_types.h"
+#include "agents/perf/spe_record_filter.hpp"
 #include "async/continuations/async_initiate.h"
 #include "async/continuations/continuation.h"
 #include "async/continuations/operations.h"
@@ -55,11 +56,13 @@ namespace agents::perf {
                                         std::shared_ptr<ipc::raw_ipc_channel_sink_t> const & ipc_sink,
                                         std::shared_ptr<perf_activator_t> const & perf_activator,
                                         bool live_mode,
-                                        std::size_t one_shot_mode_limit)
+                                        std::size_t one_shot_mode_limit,
+                                        spe_filter_config_t const & spe_filter)
             : timer(context),
               strand(context),
               perf_activator(perf_activator),
-              perf_buffer_consumer(std::make_shared<perf_buffer_consumer_t>(context, ipc_sink, one_shot_mode_limit)),
+              perf_buffer_consumer(
+                  std::make_shared<perf_buffer_consumer_t>(context, ipc_sink, one_shot_mode_limit, spe_filter)),
               live_mode(live_mode)
         {
         }
@@ -8,6 +8,7 @@
 #include "agents/perf/events/event_configuration.hpp"
 #include "agents/perf/events/types.hpp"
 #include "agents/perf/record_types.h"
+#include "agents/perf/spe_record_filter.hpp"
 #include "ipc/messages.h"
 #include "k/perf_event.h"
 #include "lib/Assert.h"
@@ -331,6 +332,24 @@ namespace agents::perf {
             }
         }
 
+        void add_spe_filter(ipc::proto::shell::perf::capture_configuration_t::spe_filter_t & msg,
+                            spe_filter_config_t const & spe_filter)
+        {
+            if (spe_filter.pc_range) {
+                msg.set_has_pc_range(true);
+                msg.set_pc_start(spe_filter.pc_range->start);
+                msg.set_pc_end(spe_filter.pc_range->end);
+            }
+            if (spe_filter.data_address_range) {
+                msg.set_has_data_address_range(true);
+                msg.set_data_address_start(spe_filter.data_address_range->start);
+                msg.set_data_address_end(spe_filter.data_address_range->end);
+            }
+            for (auto context_id : spe_filter.context_ids) {
+                msg.add_context_ids(context_id);
+            }
+        }
+
         /// ------------------------------ deserializing
 
         void extract_session_data(ipc::proto::shell::perf::capture_configuration_t::session_data_t const & msg,
@@ -585,6 +604,21 @@ namespace agents::perf {
             ringbuffer_config.aux_buffer_size = msg.aux_size();
         }
 
+        void extract_spe_filter(ipc::proto::shell::perf::capture_configuration_t::spe_filter_t const & msg,
+                                spe_filter_config_t & spe_filter)
+        {
+            if (msg.has_pc_range()) {
+                spe_filter.pc_range = spe_filter_config_t::address_range_t {msg.pc_start(), msg.pc_end()};
+            }
+            if (msg.has_data_address_range()) {
+                spe_filter.data_address_range =
+                    spe_filter_config_t::address_range_t {msg.data_address_start(), msg.data_address_end()};
+            }
+            for (auto context_id : msg.context_ids()) {
+                spe_filter.context_ids.insert(context_id);
+            }
+        }
+
         std::vector<std::string> extract_args(google::protobuf::RepeatedPtrField<std::string> && args)
         {
             std::vector<std::string> result {};
@@ -670,6 +704,7 @@ namespace agents::perf {
         add_event_configuration(*result.suffix.mutable_event_configuration(), perf_groups, cpu_info, uncore_pmus);
         add_ringbuffer_config(*result.suffix.mutable_ringbuffer_config(), ringbuffer_config);
         add_perf_pmu_type_to_name(*result.suffix.mutable_perf_pmu_type_to_name(), perf_pmu_type_to_name);
+        add_spe_filter(*result.suffix.mutable_spe_filter(), session_data.mSpeFilter);
 
         result.suffix.set_num_cpu_cores(cpu_info.getNumberOfCores());
         result.suffix.set_enable_on_exec(enable_on_exec);
@@ -750,6 +785,7 @@ namespace agents::perf {
         extract_android_pkg(*msg.suffix.mutable_android_pkg(), result->android_pkg);
         extract_pids(msg.suffix.pids(), result->pids);
         extract_perf_pmu_type_to_name(*msg.suffix.mutable_perf_pmu_type_to_name(), result->perf_pmu_type_to_name);
+        extract_spe_filter(msg.suffix.spe_filter(), result->spe_filter);
 
         return result;
     }
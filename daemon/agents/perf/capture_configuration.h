@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -8,6 +8,7 @@
 #include "agents/perf/events/event_configuration.hpp"
 #include "agents/perf/events/types.hpp"
 #include "agents/perf/record_types.h"
+#include "agents/perf/spe_record_filter.hpp"
 #include "ipc/messages.h"
 #include "lib/midr.h"
 #include "linux/perf/PerfConfig.h"
@@ -61,6 +62,7 @@ namespace agents::perf {
         std::map<std::uint32_t, std::string> perf_pmu_type_to_name;
         event_configuration_t event_configuration {};
         buffer_config_t ringbuffer_config {};
+        spe_filter_config_t spe_filter {};
         std::optional<command_t> command;
         std::string wait_process;
         std::string android_pkg;
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "agents/agent_worker_base.h"
@@ -6,6 +6,11 @@
 #include "async/continuations/operations.h"
 #include "async/continuations/stored_continuation.h"
 #include "async/continuations/use_continuation.h"
+#include "lib/Assert.h"
+#include "lib/Span.h"
+
+#include <cstddef>
+#include <cstdint>
 
 #include <boost/asio/io_context.hpp>
 
@@ -81,7 +86,7 @@ namespace agents::perf {
      *
      *     // called when an APC frame message is received from the agent. the data
      *     // buffer is passed to the function.
-     *     void on_apc_frame_received(const std::vector<uint8_t>&);
+     *     void on_apc_frame_received(lib::Span<uint8_t const>);
      * };
      *
      */
@@ -212,9 +217,27 @@ namespace agents::perf {
             return async::continuations::start_with();
         }
 
-        auto co_receive_message(ipc::msg_apc_frame_data_t && msg)
+        auto co_receive_message(ipc::msg_apc_frame_data_t && msg) { observer->on_apc_frame_received(msg.suffix); }
+
+        auto co_receive_message(ipc::msg_apc_frame_data_list_t && msg)
         {
-            observer->on_apc_frame_received(std::move(msg.suffix));
+            static constexpr std::size_t length_size = sizeof(std::uint32_t);
+
+            lib::Span<uint8_t const> frames {msg.suffix};
+
+            // each frame is prefixed with its length as a little endian uint32
+            while (frames.size() >= length_size) {
+                std::uint32_t length = 0;
+                for (std::size_t n = 0; n < length_size; ++n) {
+                    length |= std::uint32_t(frames[n]) << (n * 8);
+                }
+                frames = frames.subspan(length_size);
+
+                runtime_assert(length <= frames.size(), "Truncated apc frame list received");
+
+                observer->on_apc_frame_received(frames.subspan(0, length));
+                frames = frames.subspan(length);
+            }
         }
 
         auto co_receive_message(ipc::msg_exec_target_app_t const & /*msg*/) { observer->exec_target_app(); }
@@ -247,6 +270,7 @@ namespace agents::perf {
                           return async_receive_one_of<msg_ready_t,
                                                       msg_capture_ready_t,
                                                       msg_apc_frame_data_t,
+                                                      msg_apc_frame_data_list_t,
                                                       msg_shutdown_t,
                                                       msg_capture_failed_t,
                                                       msg_capture_started_t,
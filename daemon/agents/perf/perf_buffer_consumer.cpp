@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #include "agents/perf/perf_buffer_consumer.h"
 
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cinttypes>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -41,10 +42,12 @@ namespace agents::perf {
         }
     }
 
+    template<typename MessageType>
     async::continuations::polymorphic_continuation_t<std::uint64_t, std::uint64_t, boost::system::error_code>
     perf_buffer_consumer_t::do_send_msg(std::shared_ptr<perf_buffer_consumer_t> const & st,
                                         int cpu,
-                                        std::vector<uint8_t> buffer,
+                                        MessageType message,
+                                        std::size_t size,
                                         std::uint64_t head,
                                         std::uint64_t tail)
     {
@@ -54,10 +57,10 @@ namespace agents::perf {
                   cpu,
                   head,
                   tail,
-                  buffer.size());
+                  size);
 
         // update the running total (for one-shot mode)
-        st->cumulative_bytes_sent_apc_frames.fetch_add(buffer.size(), std::memory_order_acq_rel);
+        st->cumulative_bytes_sent_apc_frames.fetch_add(size, std::memory_order_acq_rel);
 
         // send one-shot notification?
         if (st->is_one_shot_full()) {
@@ -67,10 +70,8 @@ namespace agents::perf {
             }
         }
 
-        runtime_assert(buffer.size() <= ISender::MAX_RESPONSE_LENGTH, "Too large APC frame created");
-
         // send the message
-        return st->ipc_sink->async_send_message(ipc::msg_apc_frame_data_t {std::move(buffer)}, use_continuation) //
+        return st->ipc_sink->async_send_message(std::move(message), use_continuation) //
              | then([head, tail](auto ec, auto /*msg*/) {
                    LOG_TRACE("... sent, ec=%s , head=%" PRIu64 " , tail=%" PRIu64, ec.message().c_str(), head, tail);
 
@@ -92,6 +93,7 @@ namespace agents::perf {
 
         std::uint64_t const head = atomic_load_field<HeadField>(header);
         std::uint64_t const tail = (header->*TailField);
+        std::uint64_t const initial_tail = tail;
 
         LOG_TRACE("... cpu=%d , head=%" PRIu64 " , tail=%" PRIu64, cpu, head, tail);
 
@@ -123,10 +125,12 @@ namespace agents::perf {
                                    return start_with(h, t, c);
                                });
                     })
-             | then([cpu, mmap](std::uint64_t head, std::uint64_t tail, boost::system::error_code ec) {
+             | then([cpu, mmap, initial_tail](std::uint64_t head, std::uint64_t tail, boost::system::error_code ec) {
                    LOG_TRACE("... completed, cpu=%d , head=%" PRIu64 " , tail=%" PRIu64, cpu, head, tail);
-                   atomic_store_field<TailField>(mmap->header(), std::min(head, tail));
-                   return start_with(ec, true);
+                   auto const new_tail = std::min(head, tail);
+                   atomic_store_field<TailField>(mmap->header(), new_tail);
+                   // the tail may not move if the SPE filter is waiting for the rest of a partially written record
+                   return start_with(ec, new_tail != initial_tail);
                });
     }
 
@@ -175,13 +179,44 @@ namespace agents::perf {
                 auto [first_span, second_span] =
                     extract_one_perf_aux_apc_frame_data_span_pair(aux_buffer, header_head, header_tail);
 
-                // encode the message
-                auto [new_tail, buffer] = encode_one_perf_aux_apc_frame(cpu, first_span, second_span, header_tail);
+                // only send the records that match the SPE filter; all of the runs of matching records in the chunk are
+                // sent in one message, each as its own frame so that its offset in the aux buffer is preserved
+                if (st->spe_filter.is_enabled()) {
+                    auto [new_tail, frames] =
+                        encode_filtered_perf_aux_apc_frames(cpu, st->spe_filter, first_span, second_span, header_tail);
+
+                    if (frames.empty()) {
+                        // nothing matched; skip what was decoded, or stop if all that is left is a partial record
+                        return start_with((new_tail != header_tail ? header_head : header_tail), new_tail, ec);
+                    }
+
+                    auto const size = frames.size();
+
+                    return do_send_msg(st,
+                                       cpu,
+                                       ipc::msg_apc_frame_data_list_t {std::move(frames)},
+                                       size,
+                                       header_head,
+                                       new_tail);
+                }
+
+                // encode the message; the aux data is sent from the mmap in place, which is safe as aux_tail is
+                // only moved past it once the send completes
+                auto [new_tail, body] = encode_one_perf_aux_apc_frame(cpu, first_span, second_span, header_tail);
 
-                runtime_assert(!buffer.empty(), "Expected some apc frame data");
+                runtime_assert(!body.prefix.empty(), "Expected some apc frame data");
+
+                auto const size = body.prefix.size() + first_span.size() + second_span.size();
+
+                runtime_assert(size <= ISender::MAX_RESPONSE_LENGTH, "Too large APC frame created");
 
                 // send it
-                return do_send_msg(st, cpu, std::move(buffer), header_head, new_tail);
+                return do_send_msg(st,
+                                   cpu,
+                                   ipc::msg_apc_frame_data_from_spans_t {std::move(body)},
+                                   size,
+                                   header_head,
+                                   new_tail);
             });
     }
 
@@ -218,8 +253,12 @@ namespace agents::perf {
 
                 runtime_assert(!buffer.empty(), "Expected some apc frame data");
 
+                auto const size = buffer.size();
+
+                runtime_assert(size <= ISender::MAX_RESPONSE_LENGTH, "Too large APC frame created");
+
                 // send it
-                return do_send_msg(st, cpu, std::move(buffer), header_head, new_tail);
+                return do_send_msg(st, cpu, ipc::msg_apc_frame_data_t {std::move(buffer)}, size, header_head, new_tail);
             });
     }
 
@@ -1,10 +1,11 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
 #include "Logging.h"
 #include "agents/perf/events/perf_ringbuffer_mmap.hpp"
 #include "agents/perf/record_types.h"
+#include "agents/perf/spe_record_filter.hpp"
 #include "async/continuations/async_initiate.h"
 #include "async/continuations/continuation.h"
 #include "async/continuations/continuation_of.h"
@@ -14,6 +15,7 @@
 #include "ipc/raw_ipc_channel_sink.h"
 
 #include <atomic>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <set>
@@ -33,8 +35,12 @@ namespace agents::perf {
     public:
         perf_buffer_consumer_t(boost::asio::io_context & context,
                                std::shared_ptr<ipc::raw_ipc_channel_sink_t> ipc_sink,
-                               std::size_t one_shot_mode_limit)
-            : one_shot_mode_limit(one_shot_mode_limit), ipc_sink(std::move(ipc_sink)), strand(context)
+                               std::size_t one_shot_mode_limit,
+                               spe_filter_config_t spe_filter)
+            : one_shot_mode_limit(one_shot_mode_limit),
+              spe_filter(std::move(spe_filter)),
+              ipc_sink(std::move(ipc_sink)),
+              strand(context)
         {
         }
 
@@ -249,17 +255,21 @@ namespace agents::perf {
         /**
          * Send one apc_frame IPC message, returns the head, new-tail and error code as required at the end of each send loop iteration
          *
+         * @tparam MessageType The apc_frame message type
          * @param st The this pointer for the perf_buffer_consumer_t that made the request
          * @param cpu The cpu associated with the request
-         * @param buffer The apc_frame data buffer
+         * @param message The apc_frame message
+         * @param size The size of the apc_frame data in the message
          * @param head The aux_head or data_head value
          * @param tail The new value for aux_tail or data_tail after the send completes
          * @return A continuation producing the head, new-tail and error code values
          */
+        template<typename MessageType>
         static async::continuations::polymorphic_continuation_t<std::uint64_t, std::uint64_t, boost::system::error_code>
         do_send_msg(std::shared_ptr<perf_buffer_consumer_t> const & st,
                     int cpu,
-                    std::vector<uint8_t> buffer,
+                    MessageType message,
+                    std::size_t size,
                     std::uint64_t head,
                     std::uint64_t tail);
 
@@ -313,6 +323,7 @@ namespace agents::perf {
 
         std::atomic_size_t cumulative_bytes_sent_apc_frames {0};
         std::size_t one_shot_mode_limit {0};
+        spe_filter_config_t spe_filter;
         std::set<int> busy_cpus {};
         std::set<int> removed_cpus {};
         std::map<int, std::shared_ptr<perf_ringbuffer_mmap_t>> per_cpu_mmaps {};
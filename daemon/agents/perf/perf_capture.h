@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -78,7 +78,8 @@ namespace agents::perf {
                       perf_activator,
                       configuration->session_data.live_rate,
                       (configuration->session_data.one_shot ? configuration->session_data.total_buffer_size * MEGABYTES
-                                                            : 0)),
+                                                            : 0),
+                      configuration->spe_filter),
                   perf_capture_events_helper_t(
                       configuration,
                       event_binding_manager_t(
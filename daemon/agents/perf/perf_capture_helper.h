@@ -30,7 +30,9 @@
 #include "lib/forked_process.h"
 #include "linux/proc/ProcessChildren.h"
 
+#include <cstddef>
 #include <memory>
+#include <string>
 
 #include <boost/asio.hpp>
 #include <boost/asio/buffer.hpp>
@@ -362,12 +364,12 @@ namespace agents::perf {
                 [st = this->shared_from_this()]() -> polymorphic_continuation_t<> {
                     auto kallsyms = lib::FsEntry::create("/proc/kallsyms");
 
-                    if ((!kallsyms.exists()) || (!kallsyms.canAccess(true, false, false))) {
-                        return {};
-                    }
+                    // kallsyms is typically several MiB, so skip the first few doublings of the buffer
+                    constexpr std::size_t kallsyms_initial_capacity = 4UL * 1024UL * 1024UL;
+                    std::string contents {};
+                    contents.reserve(kallsyms_initial_capacity);
 
-                    auto contents = kallsyms.readFileContents();
-                    if (contents.empty()) {
+                    if ((!kallsyms.readFileInto(contents)) || contents.empty()) {
                         return {};
                     }
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #include "agents/perf/perf_frame_packer.hpp"
 
@@ -8,6 +8,7 @@
 #include "Protocol.h"
 #include "agents/perf/async_buffer_builder.h"
 #include "k/perf_event.h"
+#include "lib/Assert.h"
 #include "lib/Span.h"
 
 #include <algorithm>
@@ -39,6 +40,22 @@ namespace agents::perf {
             std::min<std::size_t>(ISender::MAX_RESPONSE_LENGTH - max_aux_header_size,
                                   1024UL * 1024UL); // limit frame size
 
+        /** Extract part of a chunk of data that is split in two, as a pair of spans */
+        [[nodiscard]] std::pair<lib::Span<uint8_t const>, lib::Span<uint8_t const>> extract_span_pair_range(
+            lib::Span<uint8_t const> first_span,
+            lib::Span<uint8_t const> second_span,
+            std::size_t offset,
+            std::size_t length)
+        {
+            if (offset >= first_span.size()) {
+                return {second_span.subspan(offset - first_span.size(), length), {}};
+            }
+
+            auto const first_length = std::min(length, first_span.size() - offset);
+
+            return {first_span.subspan(offset, first_length), second_span.subspan(0, length - first_length)};
+        }
+
         [[nodiscard]] bool append_data_record(apc_buffer_builder_t<std::vector<uint8_t>> & builder,
                                               lib::Span<sample_word_type const> data)
         {
@@ -203,16 +220,17 @@ namespace agents::perf {
         return {{aux_mmap.data() + tail_masked, first_size}, {aux_mmap.data(), second_size}};
     }
 
-    std::pair<std::uint64_t, std::vector<uint8_t>> encode_one_perf_aux_apc_frame(int cpu,
-                                                                                 lib::Span<uint8_t const> first_span,
-                                                                                 lib::Span<uint8_t const> second_span,
-                                                                                 std::uint64_t const header_tail)
+    std::pair<std::uint64_t, ipc::gathered_byte_spans_t<2>> encode_one_perf_aux_apc_frame(
+        int cpu,
+        lib::Span<uint8_t const> first_span,
+        lib::Span<uint8_t const> second_span,
+        std::uint64_t const header_tail)
     {
         auto const combined_size = first_span.size() + second_span.size();
 
-        // create the message data
+        // create the frame header; the aux data itself is sent directly from the mmap
         std::vector<uint8_t> buffer {};
-        buffer.reserve(combined_size);
+        buffer.reserve(max_aux_header_size);
 
         apc_buffer_builder_t builder {buffer};
 
@@ -220,10 +238,67 @@ namespace agents::perf {
         builder.packInt(cpu);
         builder.packInt64(header_tail);
         builder.packIntSize(combined_size);
-        builder.writeBytes(first_span.data(), first_span.size());
-        builder.writeBytes(second_span.data(), second_span.size());
         builder.endFrame();
 
-        return {header_tail + combined_size, std::move(buffer)};
+        return {header_tail + combined_size, {std::move(buffer), {first_span, second_span}}};
+    }
+
+    std::pair<std::uint64_t, std::vector<uint8_t>> encode_filtered_perf_aux_apc_frames(
+        int cpu,
+        spe_filter_config_t const & filter,
+        lib::Span<uint8_t const> first_span,
+        lib::Span<uint8_t const> second_span,
+        std::uint64_t const header_tail)
+    {
+        auto const combined_size = first_span.size() + second_span.size();
+
+        std::vector<uint8_t> buffer {};
+        apc_buffer_builder_t builder {buffer};
+
+        std::size_t consumed = 0;
+
+        buffer.reserve(combined_size + 1024);
+
+        while (consumed < combined_size) {
+            auto const [remaining_first, remaining_second] =
+                extract_span_pair_range(first_span, second_span, consumed, combined_size - consumed);
+
+            auto const run = find_next_spe_record_run(filter, remaining_first, remaining_second);
+            if (run.length == 0) {
+                consumed += run.consumed;
+                break;
+            }
+
+            // stop before the list grows beyond what one message may hold; the rest is sent in the next message
+            auto const max_entry_size = sizeof(std::uint32_t) + max_aux_header_size + run.length;
+            if ((!buffer.empty()) && (buffer.size() + max_entry_size > ISender::MAX_RESPONSE_LENGTH)) {
+                break;
+            }
+
+            auto const [run_first, run_second] =
+                extract_span_pair_range(remaining_first, remaining_second, run.offset, run.length);
+
+            // leave space for the length prefix
+            auto const length_index = builder.getWriteIndex();
+            builder.advanceWrite(sizeof(std::uint32_t));
+
+            builder.beginFrame(FrameType::PERF_AUX);
+            builder.packInt(cpu);
+            builder.packInt64(header_tail + consumed + run.offset);
+            builder.packIntSize(run.length);
+            builder.writeBytes(run_first.data(), run_first.size());
+            builder.writeBytes(run_second.data(), run_second.size());
+            builder.endFrame();
+
+            auto const frame_size = builder.getWriteIndex() - (length_index + sizeof(std::uint32_t));
+
+            runtime_assert(frame_size <= ISender::MAX_RESPONSE_LENGTH, "Too large APC frame created");
+
+            builder.writeLeUint32At(length_index, frame_size);
+
+            consumed += run.consumed;
+        }
+
+        return {header_tail + consumed, std::move(buffer)};
     }
 }
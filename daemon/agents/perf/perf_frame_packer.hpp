@@ -1,7 +1,9 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
+#include "agents/perf/spe_record_filter.hpp"
+#include "ipc/message_traits.h"
 #include "lib/Span.h"
 #include "lib/error_code_or.hpp"
 
@@ -43,16 +45,43 @@ namespace agents::perf {
 
     /**
      * Given the pair of aux spans that were previously extracted by `extract_one_perf_aux_apc_frame_data_span_pair`,
-     * encode them into an apc_frame message
+     * encode them into an apc_frame message.
+     *
+     * Only the frame header is encoded; the message refers to the aux data in place, so the aux data is not copied
+     * and aux_tail must not be moved past it until the message has been sent.
+     *
+     * @param cpu The cpu associated with the mmap
+     * @param first_span The first span returned by extract_one_perf_aux_apc_frame_data_span_pair
+     * @param second_span The second span returned by extract_one_perf_aux_apc_frame_data_span_pair
+     * @param header_tail The value of header_tail that was passed to extract_one_perf_aux_apc_frame_data_span_pair
+     * @return A pair, being the new value for aux_tail, and the apc_frame message body
+     */
+    [[nodiscard]] std::pair<std::uint64_t, ipc::gathered_byte_spans_t<2>> encode_one_perf_aux_apc_frame(
+        int cpu,
+        lib::Span<uint8_t const> first_span,
+        lib::Span<uint8_t const> second_span,
+        std::uint64_t header_tail);
+
+    /**
+     * Given the pair of aux spans that were previously extracted by `extract_one_perf_aux_apc_frame_data_span_pair`,
+     * encode the SPE records that match some filter into a list of apc frames, for msg_apc_frame_data_list_t.
+     *
+     * Each run of consecutive matching records is encoded as its own PERF_AUX frame so that its offset in the aux
+     * buffer is preserved. The records are copied into the list, as the runs are typically small and scattered through
+     * the chunk, and this allows all of them to be sent in one message. The list is no larger than
+     * ISender::MAX_RESPONSE_LENGTH unless it holds a single frame; if the runs do not all fit, the returned aux_tail
+     * stops before the first run that did not fit.
      *
      * @param cpu The cpu associated with the mmap
+     * @param filter The filter to apply to the records
      * @param first_span The first span returned by extract_one_perf_aux_apc_frame_data_span_pair
      * @param second_span The second span returned by extract_one_perf_aux_apc_frame_data_span_pair
      * @param header_tail The value of header_tail that was passed to extract_one_perf_aux_apc_frame_data_span_pair
-     * @return A pair, being the new value for aux_tail, and the encoded apc_frame message
+     * @return A pair, being the new value for aux_tail, and the encoded frame list (which is empty if nothing matched)
      */
-    [[nodiscard]] std::pair<std::uint64_t, std::vector<uint8_t>> encode_one_perf_aux_apc_frame(
+    [[nodiscard]] std::pair<std::uint64_t, std::vector<uint8_t>> encode_filtered_perf_aux_apc_frames(
         int cpu,
+        spe_filter_config_t const & filter,
         lib::Span<uint8_t const> first_span,
         lib::Span<uint8_t const> second_span,
         std::uint64_t header_tail);
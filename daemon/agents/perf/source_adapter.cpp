@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #include "agents/perf/source_adapter.h"
 
 #include "ISender.h"
@@ -147,7 +147,7 @@ namespace agents::perf {
         }
     }
 
-    void perf_source_adapter_t::on_apc_frame_received(const std::vector<uint8_t> & frame)
+    void perf_source_adapter_t::on_apc_frame_received(lib::Span<uint8_t const> frame)
     {
         auto const length = frame.size();
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 // Define to adjust Buffer.h interface,
@@ -10,6 +10,7 @@
 #include "Source.h"
 #include "agents/perf/perf_agent_worker.h"
 #include "ipc/messages.h"
+#include "lib/Span.h"
 
 #include <atomic>
 #include <functional>
@@ -88,7 +89,7 @@ namespace agents::perf {
          *
          * CALLED FROM THE ASIO THREAD POOL
          */
-        void on_apc_frame_received(const std::vector<uint8_t> & frame);
+        void on_apc_frame_received(lib::Span<uint8_t const> frame);
 
         /**
          * Called by the worker when the capture fails
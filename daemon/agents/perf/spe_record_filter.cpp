@@ -0,0 +1,215 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#include "agents/perf/spe_record_filter.hpp"
+
+#include "lib/Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace agents::perf {
+    namespace {
+        // SPE packet headers, see the Arm ARM "Statistical Profiling Extension" packet formats
+        constexpr std::uint8_t header_pad = 0x00;
+        constexpr std::uint8_t header_end = 0x01;
+        constexpr std::uint8_t header_timestamp = 0x71;
+        constexpr std::uint8_t header_extended_mask = 0xfc;
+        constexpr std::uint8_t header_extended = 0x20;
+        constexpr std::uint8_t header_address_mask = 0xf8;
+        constexpr std::uint8_t header_address = 0xb0;
+        constexpr std::uint8_t header_context_mask = 0xfc;
+        constexpr std::uint8_t header_context = 0x64;
+
+        constexpr unsigned header_size_shift = 4;
+        constexpr unsigned header_size_mask = 0x3;
+        constexpr unsigned header_index_mask = 0x7;
+        constexpr unsigned header_extended_index_mask = 0x3;
+        constexpr unsigned header_extended_index_shift = 3;
+        constexpr unsigned context_index_mask = 0x3;
+
+        constexpr unsigned address_index_pc = 0;
+        constexpr unsigned address_index_data_virtual = 2;
+        constexpr unsigned context_index_el1 = 0;
+        constexpr unsigned context_index_el2 = 1;
+
+        // address packets hold a 56 bit address, the top byte holds other attributes
+        constexpr unsigned address_bits = 56;
+        constexpr std::uint64_t address_mask = (std::uint64_t(1) << address_bits) - 1;
+        constexpr std::uint64_t address_sign_bit = std::uint64_t(1) << (address_bits - 1);
+
+        constexpr unsigned bits_per_byte = 8;
+
+        /** Reads a chunk of aux data that may be split in two as though it were contiguous */
+        class aux_chunk_reader_t {
+        public:
+            aux_chunk_reader_t(lib::Span<uint8_t const> first_span, lib::Span<uint8_t const> second_span)
+                : first_span(first_span), second_span(second_span)
+            {
+            }
+
+            [[nodiscard]] std::size_t size() const { return first_span.size() + second_span.size(); }
+
+            [[nodiscard]] std::uint8_t byte_at(std::size_t offset) const
+            {
+                return (offset < first_span.size() ? first_span[offset] : second_span[offset - first_span.size()]);
+            }
+
+            /** Read a little endian value of up to 8 bytes */
+            [[nodiscard]] std::uint64_t value_at(std::size_t offset, std::size_t length) const
+            {
+                std::uint64_t result = 0;
+                for (std::size_t n = 0; n < length; ++n) {
+                    result |= std::uint64_t(byte_at(offset + n)) << (n * bits_per_byte);
+                }
+                return result;
+            }
+
+        private:
+            lib::Span<uint8_t const> first_span;
+            lib::Span<uint8_t const> second_span;
+        };
+
+        /** The fields of one SPE record that the filter is interested in */
+        struct spe_record_t {
+            std::optional<std::uint64_t> pc;
+            std::optional<std::uint64_t> data_address;
+            std::optional<std::uint32_t> context_id;
+        };
+
+        [[nodiscard]] constexpr std::uint64_t decode_address(std::uint64_t payload)
+        {
+            auto const address = (payload & address_mask);
+            return ((address & address_sign_bit) != 0 ? (address | ~address_mask) : address);
+        }
+
+        /**
+         * Decode the record that starts at some offset
+         *
+         * @return The offset of the end of the record, or nothing if the record is incomplete
+         */
+        [[nodiscard]] std::optional<std::size_t> decode_record(aux_chunk_reader_t const & reader,
+                                                               std::size_t offset,
+                                                               spe_record_t & record)
+        {
+            while (offset < reader.size()) {
+                auto const header0 = reader.byte_at(offset);
+
+                // single byte packets
+                if (header0 == header_pad) {
+                    offset += 1;
+                    continue;
+                }
+                if (header0 == header_end) {
+                    return offset + 1;
+                }
+
+                // everything else has a one or two byte header followed by a 1, 2, 4 or 8 byte payload
+                std::size_t header_size = 1;
+                std::uint8_t header = header0;
+                unsigned index = (header0 & header_index_mask);
+
+                if ((header0 & header_extended_mask) == header_extended) {
+                    if ((offset + 1) >= reader.size()) {
+                        return {};
+                    }
+                    header_size = 2;
+                    header = reader.byte_at(offset + 1);
+                    index = ((header0 & header_extended_index_mask) << header_extended_index_shift)
+                          | (header & header_index_mask);
+                }
+
+                std::size_t const payload_size = std::size_t(1) << ((header >> header_size_shift) & header_size_mask);
+                std::size_t const payload_offset = offset + header_size;
+
+                if ((payload_offset + payload_size) > reader.size()) {
+                    return {};
+                }
+
+                offset = payload_offset + payload_size;
+
+                if (header == header_timestamp) {
+                    // the timestamp is always the last packet in the record
+                    return offset;
+                }
+                if ((header & header_address_mask) == header_address) {
+                    if (index == address_index_pc) {
+                        record.pc = decode_address(reader.value_at(payload_offset, payload_size));
+                    }
+                    else if (index == address_index_data_virtual) {
+                        record.data_address = decode_address(reader.value_at(payload_offset, payload_size));
+                    }
+                }
+                else if ((header & header_context_mask) == header_context) {
+                    // the kernel writes the thread id to CONTEXTIDR_EL2 rather than CONTEXTIDR_EL1 when it runs at EL2 (VHE)
+                    auto const context_index = (header & context_index_mask);
+                    if ((context_index == context_index_el1) || (context_index == context_index_el2)) {
+                        record.context_id = std::uint32_t(reader.value_at(payload_offset, payload_size));
+                    }
+                }
+            }
+
+            return {};
+        }
+
+        [[nodiscard]] bool matches(spe_filter_config_t const & filter, spe_record_t const & record)
+        {
+            if (filter.pc_range && !(record.pc && filter.pc_range->contains(*record.pc))) {
+                return false;
+            }
+            if (filter.data_address_range
+                && !(record.data_address && filter.data_address_range->contains(*record.data_address))) {
+                return false;
+            }
+            if (!filter.context_ids.empty()
+                && !(record.context_id && (filter.context_ids.count(*record.context_id) > 0))) {
+                return false;
+            }
+            return true;
+        }
+    }
+
+    spe_record_run_t find_next_spe_record_run(spe_filter_config_t const & filter,
+                                              lib::Span<uint8_t const> first_span,
+                                              lib::Span<uint8_t const> second_span)
+    {
+        aux_chunk_reader_t const reader {first_span, second_span};
+
+        std::optional<std::size_t> run_start {};
+        std::size_t run_end = 0;
+        std::size_t consumed = 0;
+
+        while (consumed < reader.size()) {
+            // skip padding between records; if the run continues then the padding is sent as part of it
+            if (reader.byte_at(consumed) == header_pad) {
+                consumed += 1;
+                continue;
+            }
+
+            spe_record_t record {};
+            auto const record_end = decode_record(reader, consumed, record);
+            if (!record_end) {
+                break;
+            }
+
+            if (matches(filter, record)) {
+                if (!run_start) {
+                    run_start = consumed;
+                }
+                run_end = *record_end;
+            }
+            else if (run_start) {
+                // the run ends here
+                break;
+            }
+
+            consumed = *record_end;
+        }
+
+        if (!run_start) {
+            return {0, 0, consumed};
+        }
+
+        return {*run_start, run_end - *run_start, run_end};
+    }
+}
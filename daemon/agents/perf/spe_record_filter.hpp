@@ -0,0 +1,71 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include "lib/Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+
+namespace agents::perf {
+
+    /** The software filters that are applied to the SPE records in the aux buffer before they are sent (--spe-filter) */
+    struct spe_filter_config_t {
+        struct address_range_t {
+            /** The first address in the range */
+            std::uint64_t start;
+            /** The address after the last address in the range */
+            std::uint64_t end;
+
+            [[nodiscard]] constexpr bool contains(std::uint64_t address) const
+            {
+                return (address >= start) && (address < end);
+            }
+        };
+
+        /** Only keep records whose PC is in this range */
+        std::optional<address_range_t> pc_range;
+        /** Only keep records whose data virtual address is in this range */
+        std::optional<address_range_t> data_address_range;
+        /**
+         * Only keep records whose CONTEXTIDR_EL1 or CONTEXTIDR_EL2 (whichever the kernel uses, which holds the thread id
+         * with CONFIG_PID_IN_CONTEXTIDR) is one of these
+         */
+        std::set<std::uint32_t> context_ids;
+
+        /** @return True if any filter is set */
+        [[nodiscard]] bool is_enabled() const
+        {
+            return pc_range.has_value() || data_address_range.has_value() || !context_ids.empty();
+        }
+    };
+
+    /** A run of consecutive SPE records, as found by find_next_spe_record_run */
+    struct spe_record_run_t {
+        /** The offset of the first byte of the run */
+        std::size_t offset;
+        /** The length of the run, or zero if no record matched */
+        std::size_t length;
+        /** The number of bytes from the start of the data that no longer need to be read */
+        std::size_t consumed;
+    };
+
+    /**
+     * Decode the SPE records in some chunk of aux data, and find the first run of consecutive records that match the
+     * filter.
+     *
+     * Any padding and non-matching records before the run are skipped. The run ends at the first non-matching record
+     * after it. An incomplete record at the end of the data is not consumed, so that it can be decoded once the rest of
+     * it has been written.
+     *
+     * @param filter The filter to apply
+     * @param first_span The first part of the aux data chunk
+     * @param second_span The second part of the aux data chunk (if the ringbuffer wrapped), which follows on from first_span
+     * @return The run
+     */
+    [[nodiscard]] spe_record_run_t find_next_spe_record_run(spe_filter_config_t const & filter,
+                                                            lib::Span<uint8_t const> first_span,
+                                                            lib::Span<uint8_t const> second_span);
+}
@@ -1,47 +1,72 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
 #include "BufferUtils.h"
 #include "IRawFrameBuilder.h"
 #include "ISender.h"
+#include "Logging.h"
 #include "Protocol.h"
 #include "agents/perf/async_buffer_builder.h"
 #include "ipc/messages.h"
 #include "ipc/raw_ipc_channel_sink.h"
 #include "linux/perf/PerfSyncThread.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace agents::perf {
     /**
      * Collects the timing data from the owned sync thread, encodes into an
      * APC frame, and sends it via the IPC sink.
      *
+     * Only a single sync thread is needed as all cores share the same clock domain.
+     * Each sync point is still encoded as its own PERF_SYNC frame, but the frames
+     * are batched so that one IPC message is sent for every max_sync_frames_per_message
+     * sync points, rather than one message per point.
+     *
      * @tparam SyncThread Thread-owning type that produces the timing data
      * and peforms the thread renaming
      */
     template<typename SyncThread>
     class basic_sync_generator_t {
     public:
+        /** The maximum number of sync frames that are sent in one IPC message */
+        static constexpr std::size_t max_sync_frames_per_message = 2;
+
+        /**
+         * Check whether sync points are needed at all
+         *
+         * @param supports_clock_id True if the kernel perf API supports configuring clock_id
+         * @param has_spe_configuration True if the user selected at least one SPE configuration
+         * @return True unless the perf events are already timestamped with CLOCK_MONOTONIC_RAW and there is no SPE
+         * data that is timestamped with the arch timer
+         */
+        [[nodiscard]] static constexpr bool is_required(bool supports_clock_id, bool has_spe_configuration)
+        {
+            return has_spe_configuration || !supports_clock_id;
+        }
+
         /**
           * Factory method, creates appropriate number of sync thread objects
          *
          * @param supports_clock_id True if the kernel perf API supports configuring clock_id
          * @param has_spe_configuration True if the user selected at least one SPE configuration
          * @param sink IPC channel to write the resulting APC frame into
-         * @return sync_generator instance, or nullptr if supports_clock_id and !has_spe_configuration
+         * @return sync_generator instance, or nullptr if !is_required(supports_clock_id, has_spe_configuration)
          */
         static std::unique_ptr<basic_sync_generator_t> create(bool supports_clock_id,
                                                               bool has_spe_configuration,
                                                               std::shared_ptr<ipc::raw_ipc_channel_sink_t> sink)
         {
-            if (has_spe_configuration || !supports_clock_id) {
+            if (is_required(supports_clock_id, has_spe_configuration)) {
                 const bool enable_sync_thread_mode = (!supports_clock_id);
                 const bool read_timer = has_spe_configuration;
                 return std::make_unique<basic_sync_generator_t>(enable_sync_thread_mode, read_timer, std::move(sink));
             }
 
+            LOG_DEBUG("Sync thread not required as perf supports clock_id and there is no SPE configuration");
             return nullptr;
         }
 
@@ -68,9 +93,13 @@ namespace agents::perf {
         void start(std::uint64_t monotonic_raw_base) { thread.start(monotonic_raw_base); }
 
         /**
-         * Stop and join thread
+         * Stop and join thread, then send any sync points that are still pending
          */
-        void terminate() { thread.terminate(); }
+        void terminate()
+        {
+            thread.terminate();
+            flush();
+        }
 
     private:
         static constexpr std::size_t max_sync_buffer_size = IRawFrameBuilder::MAX_FRAME_HEADER_SIZE // Header
@@ -83,12 +112,15 @@ namespace agents::perf {
                                                           + buffer_utils::MAXSIZE_PACK64;           // vcnt
 
         std::shared_ptr<ipc::raw_ipc_channel_sink_t> sink;
-        std::vector<uint8_t> buffer;
+        // the pending frames are only accessed from the sync thread, or after it is joined
+        std::vector<uint8_t> pending_frames {};
+        std::size_t num_pending_frames = 0;
+        bool sent_first_sync_point = false;
         SyncThread thread;
 
         void write(pid_t pid, pid_t tid, std::uint64_t freq, std::uint64_t monotonic_raw, std::uint64_t vcnt)
         {
-            buffer.resize(max_sync_buffer_size);
+            std::vector<uint8_t> buffer(max_sync_buffer_size);
             auto builder = apc_buffer_builder_t(buffer);
 
             // Begin frame, the size field and other header data will be added
@@ -114,8 +146,33 @@ namespace agents::perf {
                       vcnt,
                       builder.getWriteIndex());
 
-            // Send frame
-            sink->async_send_message(ipc::msg_apc_frame_data_t {std::move(buffer)},
+            // Append to the pending list, prefixed with its length (see msg_apc_frame_data_list_t)
+            auto const length = std::uint32_t(buffer.size());
+            pending_frames.insert(
+                pending_frames.end(),
+                {uint8_t(length), uint8_t(length >> 8U), uint8_t(length >> 16U), uint8_t(length >> 24U)});
+            pending_frames.insert(pending_frames.end(), buffer.begin(), buffer.end());
+            num_pending_frames += 1;
+
+            // the first sync point is sent straight away so that the data can be decoded as soon as possible
+            if ((!sent_first_sync_point) || (num_pending_frames >= max_sync_frames_per_message)) {
+                sent_first_sync_point = true;
+                flush();
+            }
+        }
+
+        void flush()
+        {
+            if (num_pending_frames == 0) {
+                return;
+            }
+
+            auto frames = std::move(pending_frames);
+            pending_frames = {};
+            num_pending_frames = 0;
+
+            // Send frames
+            sink->async_send_message(ipc::msg_apc_frame_data_list_t {std::move(frames)},
                                      [](auto const & ec, auto const & /*msg*/) {
                                          // EOF means terminated
                                          if (ec && ec != boost::asio::error::eof) {
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "Logging.h"
@@ -20,6 +20,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <map>
 #include <memory>
@@ -29,7 +30,10 @@
 #include <variant>
 #include <vector>
 
+#include <boost/asio/error.hpp>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/system/error_code.hpp>
 
 namespace agents {
     /**
@@ -37,12 +41,15 @@ namespace agents {
      */
     template<typename PerfettoSdkHelper = agents::perfetto_sdk_helper_t>
     class perfetto_agent_t : public std::enable_shared_from_this<perfetto_agent_t<PerfettoSdkHelper>> {
-        static constexpr std::size_t buffer_sz = 4096;
+        static constexpr std::size_t buffer_sz = 64 * 1024;
+        static constexpr std::chrono::seconds stats_period {1};
         static constexpr std::array<char, 11> protocol_handshake_tag =
             {'P', 'E', 'R', 'F', 'E', 'T', 'T', 'O', '\n', '\x0A', '\0'};
 
     public:
-        using accepted_message_types = std::tuple<ipc::msg_perfetto_close_conn_t, ipc::msg_monitored_pids_t>;
+        using accepted_message_types = std::tuple<ipc::msg_perfetto_close_conn_t,
+                                                  ipc::msg_perfetto_configuration_t,
+                                                  ipc::msg_monitored_pids_t>;
 
         using perfetto_sdk_helper_t = PerfettoSdkHelper;
 
@@ -66,6 +73,7 @@ namespace agents {
               strand(io_context),
               ipc_sink(std::move(ipc_sink)),
               perfetto_sdk_helper(perfetto_sdk_helper),
+              stats_timer(io_context),
               buffer(buffer_sz, '\0')
         {
 #if defined(ANDROID) || defined(__ANDROID__)
@@ -112,11 +120,25 @@ namespace agents {
             using namespace async::continuations;
 
             return start_on(strand) | then([self = this->shared_from_this()]() mutable -> polymorphic_continuation_t<> {
+                       // there are no more stats to report once the session is stopped
+                       self->is_trace_stopped = true;
+                       self->stats_timer.cancel();
                        self->perfetto_sdk_helper->stop_sdk();
                        return {};
                    });
         }
 
+        async::continuations::polymorphic_continuation_t<> co_receive_message(
+            ipc::msg_perfetto_configuration_t msg)
+        {
+            using namespace async::continuations;
+
+            return start_on(strand)
+                 | then([self = this->shared_from_this(), configuration = msg.header]() mutable {
+                       self->perfetto_sdk_helper->set_configuration(configuration);
+                   });
+        }
+
         async::continuations::polymorphic_continuation_t<> co_receive_message(const ipc::msg_monitored_pids_t & /*msg*/)
         {
             LOG_DEBUG("Got monitored pids message");
@@ -127,6 +149,7 @@ namespace agents {
             }
 
             spawn("Perfetto Read Loop", co_send_initial_frame());
+            spawn("Perfetto Stats Loop", co_report_overruns());
             return {};
         }
 
@@ -135,9 +158,12 @@ namespace agents {
         boost::asio::io_context::strand strand;
         std::shared_ptr<ipc::raw_ipc_channel_sink_t> ipc_sink;
         bool is_shutdown {false};
+        bool is_trace_stopped {false};
         std::optional<std::string> graphics_property_value;
 
         std::shared_ptr<perfetto_sdk_helper_t> perfetto_sdk_helper {};
+        boost::asio::steady_timer stats_timer;
+        std::uint64_t last_reported_overruns {0};
 
         std::vector<uint8_t> buffer;
 
@@ -150,6 +176,8 @@ namespace agents {
             return start_on(strand) //
                  | then([self = this->shared_from_this()]() mutable {
                        self->is_shutdown = true;
+                       self->stats_timer.cancel();
+                       // the read loop continues until the remaining trace data is drained
                        self->perfetto_sdk_helper->stop_sdk();
                    });
         }
@@ -194,11 +222,6 @@ namespace agents {
                            return self->co_shutdown();
                        }
 
-                       if (self->is_shutdown) {
-                           LOG_TRACE("Shutdown requested - breaking out of perfetto read loop");
-                           return {};
-                       }
-
                        return self->co_read_perfetto_trace();
                    });
         }
@@ -208,22 +231,65 @@ namespace agents {
             using namespace async::continuations;
             auto self = this->shared_from_this();
 
+            // reads until the trace is stopped and fully drained, which is reported as eof
             return start_on(strand)
-                 | do_if([self]() { return !self->is_shutdown; },
-                         [self]() {
-                             return start_on(self->strand)
-                                  | self->perfetto_sdk_helper->async_read_trace(
-                                      {self->buffer.data(), self->buffer.size()},
-                                      use_continuation)
-                                  | then([self](auto err, auto size) {
-                                        if (err) {
-                                            LOG_ERROR("Received an error while trying to read perfetto data: %s",
-                                                      err.message().c_str());
-                                            return self->co_shutdown();
-                                        }
-                                        return self->co_forward_to_shell(size);
-                                    });
-                         });
+                 | self->perfetto_sdk_helper->async_read_trace({self->buffer.data(), self->buffer.size()},
+                                                               use_continuation)
+                 | then([self](auto err, auto size) -> polymorphic_continuation_t<> {
+                       if (err == boost::asio::error::eof) {
+                           LOG_DEBUG("Perfetto trace data fully read");
+                           return {};
+                       }
+                       if (err) {
+                           LOG_ERROR("Received an error while trying to read perfetto data: %s",
+                                     err.message().c_str());
+                           return self->co_shutdown();
+                       }
+                       return self->co_forward_to_shell(size);
+                   });
+        }
+
+        /** Periodically send the trace buffer overrun count to the shell, whenever it changes */
+        async::continuations::polymorphic_continuation_t<> co_report_overruns()
+        {
+            using namespace async::continuations;
+            auto self = this->shared_from_this();
+
+            return repeatedly(
+                [self]() {
+                    return start_on(self->strand) //
+                         | then([self]() { return !(self->is_shutdown || self->is_trace_stopped); });
+                },
+                [self]() {
+                    self->stats_timer.expires_after(stats_period);
+                    return self->stats_timer.async_wait(use_continuation) //
+                         | post_on(self->strand)                          //
+                         | then([self](boost::system::error_code const & ec) -> polymorphic_continuation_t<> {
+                               if (ec || self->is_shutdown || self->is_trace_stopped) {
+                                   return {};
+                               }
+                               return self->perfetto_sdk_helper->async_get_overruns(use_continuation) //
+                                    | post_on(self->strand)                                           //
+                                    | then([self](std::optional<std::uint64_t> overruns)
+                                               -> polymorphic_continuation_t<> {
+                                          // nothing to report if the stats were not available
+                                          if (!overruns
+                                              || (*overruns
+                                                  == std::exchange(self->last_reported_overruns, *overruns))) {
+                                              return {};
+                                          }
+                                          return self->ipc_sink->async_send_message(
+                                                     ipc::msg_perfetto_stats_t {{*overruns}},
+                                                     use_continuation)
+                                               | then([](auto const & ec, auto /*msg*/) {
+                                                     if (ec) {
+                                                         LOG_DEBUG("Could not send perfetto stats: %s",
+                                                                   ec.message().c_str());
+                                                     }
+                                                 });
+                                      });
+                           });
+                });
         }
     };
 };
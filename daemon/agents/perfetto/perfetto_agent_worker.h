@@ -1,4 +1,4 @@
-/* Copyright (C) 2021-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2021-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "agents/agent_worker_base.h"
@@ -10,6 +10,13 @@
 #include "ipc/messages.h"
 #include "lib/Assert.h"
 
+#include <cinttypes>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
 #include <boost/asio/bind_executor.hpp>
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/error.hpp>
@@ -20,6 +27,8 @@
 #include <boost/system/error_code.hpp>
 
 namespace agents {
+    /** Receives the total number of perfetto trace buffer overruns */
+    using perfetto_overruns_observer_t = std::function<void(std::uint64_t)>;
 
     template<typename PerfettoSource>
     class perfetto_agent_worker_t : public agent_worker_base_t,
@@ -52,6 +61,8 @@ namespace agents {
         boost::asio::io_context::strand strand;
         PerfettoSource & perfetto_source;
         std::optional<boost::asio::posix::stream_descriptor> perfetto_source_pipe;
+        ipc::msg_perfetto_configuration_t config_msg;
+        perfetto_overruns_observer_t overruns_observer;
 
         /** @return A continuation that requests the remote agent to shutdown */
         auto cont_shutdown()
@@ -106,14 +117,16 @@ namespace agents {
                    });
         }
 
-        /** Handle the 'ready' IPC message variant. The agent is ready. */
-        void cont_on_recv_message(ipc::msg_ready_t const & /*message*/)
+        /** Handle the 'ready' IPC message variant. The agent is ready, so send it the trace configuration. */
+        auto cont_on_recv_message(ipc::msg_ready_t const & /*message*/)
         {
+            using namespace async::continuations;
+
             LOG_FINE("Received ready message.");
 
             if (perfetto_source_pipe) {
                 LOG_ERROR("Perfetto external data pipe already created.");
-                return;
+                return polymorphic_continuation_t<> {};
             }
 
             auto con = std::make_unique<connection_impl_t>(this->weak_from_this());
@@ -121,14 +134,39 @@ namespace agents {
 
             if (!pipe) {
                 LOG_ERROR("Failed to create perfetto data pipe");
-                return;
+                return polymorphic_continuation_t<> {};
             }
 
             perfetto_source_pipe = boost::asio::posix::stream_descriptor {strand.context(), pipe.release()};
 
-            // transition state
-            if (transition_state(state_t::ready)) {
-                LOG_FINE("Perfetto agent is now ready");
+            // the configuration must be sent before the agent becomes ready, as it starts the trace once it
+            // receives the monitored pids
+            return polymorphic_continuation_t<> {
+                start_on(strand) //
+                | sink().async_send_message(config_msg, use_continuation)
+                | then([st = this->shared_from_this()](auto const & ec,
+                                                       auto const & /*msg*/) -> polymorphic_continuation_t<> {
+                      if (ec) {
+                          LOG_ERROR("Failed to send the configuration to the agent process: %s",
+                                    ec.message().c_str());
+                          return st->cont_shutdown();
+                      }
+
+                      // transition state
+                      if (st->transition_state(state_t::ready)) {
+                          LOG_FINE("Perfetto agent is now ready");
+                      }
+                      return {};
+                  })};
+        }
+
+        /** Handle the 'stats' IPC message variant. The agent is reporting the trace buffer statistics. */
+        void cont_on_recv_message(ipc::msg_perfetto_stats_t const & message)
+        {
+            LOG_DEBUG("Perfetto reported %" PRIu64 " overruns", message.header.overruns);
+
+            if (overruns_observer) {
+                overruns_observer(message.header.overruns);
             }
         }
 
@@ -161,9 +199,10 @@ namespace agents {
                     return true;
                 },
                 [st]() {
-                    return async_receive_one_of<msg_ready_t, msg_shutdown_t, msg_perfetto_recv_bytes_t>(
-                               st->source_shared(),
-                               use_continuation)
+                    return async_receive_one_of<msg_ready_t,
+                                                msg_shutdown_t,
+                                                msg_perfetto_recv_bytes_t,
+                                                msg_perfetto_stats_t>(st->source_shared(), use_continuation)
                          | map_error()         //
                          | post_on(st->strand) //
                          | unpack_variant([st](auto && message) {
@@ -179,10 +218,14 @@ namespace agents {
         perfetto_agent_worker_t(boost::asio::io_context & io_context,
                                 agent_process_t && agent_process,
                                 state_change_observer_t && state_change_observer,
-                                PerfettoSource & perfetto_source)
+                                PerfettoSource & perfetto_source,
+                                ipc::msg_perfetto_configuration_t config_msg,
+                                perfetto_overruns_observer_t overruns_observer)
             : agent_worker_base_t(std::move(agent_process), std::move(state_change_observer)),
               strand(io_context),
-              perfetto_source(perfetto_source)
+              perfetto_source(perfetto_source),
+              config_msg(config_msg),
+              overruns_observer(std::move(overruns_observer))
         {
         }
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #include "agents/perfetto/perfetto_driver.h"
 
 #include "Counter.h"
@@ -7,12 +7,47 @@
 #include "PolledDriver.h"
 #include "lib/perfetto_utils.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include <mxml.h>
+#include <strings.h>
 
 namespace agents::perfetto {
+    namespace {
+        class perfetto_overruns_counter_t : public DriverCounter {
+        public:
+            perfetto_overruns_counter_t(DriverCounter * next, const char * const name, perfetto_driver_t & driver)
+                : DriverCounter(next, name), driver(driver)
+            {
+            }
+
+            // Intentionally unimplemented
+            perfetto_overruns_counter_t(const perfetto_overruns_counter_t &) = delete;
+            perfetto_overruns_counter_t & operator=(const perfetto_overruns_counter_t &) = delete;
+            perfetto_overruns_counter_t(perfetto_overruns_counter_t &&) = delete;
+            perfetto_overruns_counter_t & operator=(perfetto_overruns_counter_t &&) = delete;
+
+            int64_t read() override
+            {
+                const std::uint64_t total = driver.getOverruns();
+
+                // the total never goes down during a capture, so ignore any value that does
+                if (total <= previous) {
+                    return 0;
+                }
+
+                const std::uint64_t delta = total - previous;
+                previous = total;
+                return static_cast<int64_t>(delta);
+            }
+
+        private:
+            perfetto_driver_t & driver;
+            std::uint64_t previous {0};
+        };
+    }
 
     perfetto_driver_t::perfetto_driver_t(const char * maliFamilyName) : PolledDriver("MaliTimeline")
     {
@@ -23,6 +58,12 @@ namespace agents::perfetto {
 
     void perfetto_driver_t::setupCounter(Counter & counter)
     {
+        // the overruns counter is an ordinary polled counter
+        if (strcasecmp(counter.getType(), PERFETTO_OVERRUNS_COUNTER.data()) == 0) {
+            PolledDriver::setupCounter(counter);
+            return;
+        }
+
         counter.setExcludeFromCapturedXml();
         perfetto_requested = true;
 
@@ -38,19 +79,32 @@ namespace agents::perfetto {
     // LiveContent.java has a filter in UNSAVED_SOURCES_TO_IGNORE which must be kept in sync with the counter alias here
     void perfetto_driver_t::writeEvents(mxml_node_t * root) const
     {
-        root = mxmlNewElement(root, "category");
-        mxmlElementSetAttr(root, "name", "Mali Timeline");
-        root = mxmlNewElement(root, "event");
-        mxmlElementSetAttr(root, "counter", "MaliTimeline_Perfetto");
-        mxmlElementSetAttr(root, "title", "Mali Timeline Events");
-        mxmlElementSetAttr(root, "name", "Perfetto");
+        mxml_node_t * const category = mxmlNewElement(root, "category");
+        mxmlElementSetAttr(category, "name", "Mali Timeline");
+
+        mxml_node_t * const event = mxmlNewElement(category, "event");
+        mxmlElementSetAttr(event, "counter", PERFETTO_COUNTER.data());
+        mxmlElementSetAttr(event, "title", "Mali Timeline Events");
+        mxmlElementSetAttr(event, "name", "Perfetto");
+
+        mxml_node_t * const overruns = mxmlNewElement(category, "event");
+        mxmlElementSetAttr(overruns, "counter", PERFETTO_OVERRUNS_COUNTER.data());
+        mxmlElementSetAttr(overruns, "title", "Mali Timeline");
+        mxmlElementSetAttr(overruns, "name", "Perfetto overruns");
+        mxmlElementSetAttr(overruns, "class", "delta");
+        mxmlElementSetAttr(overruns, "display", "accumulate");
+        mxmlElementSetAttr(overruns,
+                           "description",
+                           "The number of trace buffer chunks lost because perfetto's trace buffer overflowed");
+        mxmlElementSetAttr(overruns, "units", "chunks");
     }
 
     void perfetto_driver_t::readEvents(mxml_node_t * const /* unused */)
     {
         const bool traced_running = lib::check_traced_running();
         if (isMaliGpu() && traced_running) {
-            setCounters(new DriverCounter(getCounters(), "MaliTimeline_Perfetto"));
+            setCounters(new DriverCounter(getCounters(), PERFETTO_COUNTER.data()));
+            setCounters(new perfetto_overruns_counter_t(getCounters(), PERFETTO_OVERRUNS_COUNTER.data(), *this));
         }
     }
 
@@ -1,8 +1,14 @@
-/* Copyright (C) 2022-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "PolledDriver.h"
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace agents::perfetto {
 
     class perfetto_driver_t : public PolledDriver {
@@ -15,12 +21,22 @@ namespace agents::perfetto {
         void setupCounter(Counter & counter) override;
         bool perfettoEnabled() const;
 
+        /** Record the total number of trace buffer chunks that perfetto has lost so far */
+        void setOverruns(std::uint64_t total) { mOverruns.store(total, std::memory_order_relaxed); }
+
+        /** @return the total number of trace buffer chunks that perfetto has lost so far */
+        [[nodiscard]] std::uint64_t getOverruns() const { return mOverruns.load(std::memory_order_relaxed); }
+
     private:
+        static constexpr std::string_view PERFETTO_COUNTER = "MaliTimeline_Perfetto";
+        static constexpr std::string_view PERFETTO_OVERRUNS_COUNTER = "MaliTimeline_Perfetto_Overruns";
+
         std::string maliFamilyName;
         [[nodiscard]] bool isMaliGpu() const;
         [[nodiscard]] std::string get_error_message() const;
         bool perfetto_requested = false;
         bool perfetto_enabled = false;
+        std::atomic<std::uint64_t> mOverruns {0};
     };
 
 }
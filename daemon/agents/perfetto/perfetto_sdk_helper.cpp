@@ -2,42 +2,46 @@
 #include "agents/perfetto/perfetto_sdk_helper.h"
 
 #include "Logging.h"
+#include "ipc/messages.h"
 #include "lib/AutoClosingFd.h"
+#include "lib/Syscall.h"
 
-#include <array>
 #include <atomic>
+#include <cerrno>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
-#include <optional>
+#include <functional>
+#include <memory>
 #include <string>
 #include <thread>
 #include <utility>
 
-#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
 
 #include <fcntl.h>
+#include <linux/falloc.h>
+#include <linux/memfd.h>
 #include <unistd.h>
 
 namespace agents {
 
     namespace {
-        constexpr std::uint32_t perfetto_buffer_size = 2048;
-        constexpr std::uint32_t perfetto_flush_period = 100;
-        constexpr std::uint32_t perfetto_file_write_period = 100;
+        constexpr std::uint32_t default_perfetto_buffer_size_kb = 8192;
+        constexpr std::uint32_t default_perfetto_flush_period_ms = 100;
+        constexpr std::uint32_t default_perfetto_file_write_period_ms = 100;
         constexpr std::uint32_t traced_stop_timeout_ms = 10 * 1000;
         constexpr std::uint32_t traced_stop_thread_sleep_ms = 100;
 
-        std::optional<std::array<lib::AutoClosingFd, 2>> create_perfetto_pipe()
-        {
-            std::array<int, 2> fds;
-            if (auto result = ::pipe2(fds.data(), O_CLOEXEC); result != 0) {
-                LOG_ERROR("Failed to open perfetto data pipe. Result code was: %d", result);
-                return {};
-            }
+        /** Consumed pages of the trace memfd are released in blocks of at least this size */
+        constexpr std::uint64_t release_threshold = 1024 * 1024;
 
-            return {{lib::AutoClosingFd(fds[0]), lib::AutoClosingFd(fds[1])}};
+        constexpr std::uint32_t value_or_default(std::uint32_t value, std::uint32_t default_value)
+        {
+            return (value != 0 ? value : default_value);
         }
-
     }
 
     void perfetto_sdk_helper_t::initialize_sdk()
@@ -83,10 +87,23 @@ namespace agents {
                           traced_stop_timeout_ms / 1000);
             }
 
+            // make sure the final data is written into the memfd before the reader sees the session as stopped
+            tracing_session->StopBlocking();
+
             session_started = false;
         }
     }
 
+    void perfetto_sdk_helper_t::set_configuration(ipc::perfetto_configuration_t const & configuration)
+    {
+        if (session_started) {
+            LOG_WARNING("Ignoring perfetto configuration received after the trace was started");
+            return;
+        }
+
+        this->configuration = configuration;
+    }
+
     bool perfetto_sdk_helper_t::start_trace()
     {
         if (!tracing_session) {
@@ -99,21 +116,20 @@ namespace agents {
             return false;
         }
 
-        auto pipe_fds = create_perfetto_pipe();
-        if (!pipe_fds) {
+        // we need to own this even though we hand it to perfetto as it won't take ownership and close it for us.
+        trace_fd = lib::AutoClosingFd {lib::memfd_create("gator-perfetto", MFD_CLOEXEC)};
+        if (!trace_fd) {
+            LOG_ERROR("Failed to create perfetto trace memfd (%d)", errno);
             return false;
         }
 
-        fill_trace_configuration();
+        read_offset = 0;
+        released_offset = 0;
 
-        // we need to own this even though we hand the write fd to perfetto as it won't take ownership
-        // and close it for us.
-        perfetto_write_fd = std::move(pipe_fds.value()[1]);
-        // adapt the read end to something that asio can deal with
-        perfetto_read_stream = boost::asio::posix::stream_descriptor {ctx, pipe_fds.value()[0].release()};
+        fill_trace_configuration();
 
         // now tell perfetto to configure itself and start tracing
-        tracing_session->Setup(trace_config, perfetto_write_fd.get());
+        tracing_session->Setup(trace_config, trace_fd.get());
         tracing_session->Start();
 
         session_started = true;
@@ -122,12 +138,109 @@ namespace agents {
 
     void perfetto_sdk_helper_t::fill_trace_configuration()
     {
-        trace_config.add_buffers()->set_size_kb(perfetto_buffer_size);
-        trace_config.set_flush_period_ms(perfetto_flush_period);
-        trace_config.set_file_write_period_ms(perfetto_file_write_period);
+        auto const buffer_size_kb = value_or_default(configuration.buffer_size_kb, default_perfetto_buffer_size_kb);
+        auto const flush_period_ms = value_or_default(configuration.flush_period_ms, default_perfetto_flush_period_ms);
+
+        LOG_DEBUG("Perfetto trace buffer is %u KiB, flushed every %u ms, written every %u ms",
+                  buffer_size_kb,
+                  flush_period_ms,
+                  get_file_write_period_ms());
+
+        trace_config.add_buffers()->set_size_kb(buffer_size_kb);
+        trace_config.set_flush_period_ms(flush_period_ms);
+        trace_config.set_file_write_period_ms(get_file_write_period_ms());
         trace_config.set_write_into_file(true);
 
         auto * data_source = trace_config.add_data_sources()->mutable_config();
         data_source->set_name(std::string(GPU_RENDERSTAGES_DATASOURCE));
     }
+
+    std::uint32_t perfetto_sdk_helper_t::get_file_write_period_ms() const
+    {
+        return value_or_default(configuration.file_write_period_ms, default_perfetto_file_write_period_ms);
+    }
+
+    std::pair<boost::system::error_code, std::size_t> perfetto_sdk_helper_t::read_trace_data(
+        boost::asio::mutable_buffer buffer)
+    {
+        if (!trace_fd) {
+            return {boost::asio::error::make_error_code(boost::asio::error::not_connected), 0};
+        }
+
+        // sample this before reading so that any data written before the session was stopped is not missed
+        auto const is_started = session_started.load();
+
+        auto const n = ::pread(trace_fd.get(), buffer.data(), buffer.size(), off_t(read_offset));
+        if (n < 0) {
+            if (errno == EINTR) {
+                return {{}, 0};
+            }
+            return {boost::system::error_code(errno, boost::system::generic_category()), 0};
+        }
+
+        if (n == 0) {
+            if (!is_started) {
+                return {boost::asio::error::make_error_code(boost::asio::error::eof), 0};
+            }
+            return {{}, 0};
+        }
+
+        read_offset += n;
+        release_read_pages();
+
+        return {{}, std::size_t(n)};
+    }
+
+    void perfetto_sdk_helper_t::release_read_pages()
+    {
+        static const auto page_size = std::uint64_t(::sysconf(_SC_PAGESIZE));
+
+        auto const release_to = read_offset - (read_offset % page_size);
+        if ((release_to - released_offset) < release_threshold) {
+            return;
+        }
+
+        // the file size is kept, so perfetto continues to append at the same offset
+        if (::fallocate(trace_fd.get(),
+                        FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                        off_t(released_offset),
+                        off_t(release_to - released_offset))
+            != 0) {
+            LOG_DEBUG("Could not release consumed perfetto trace data (%d)", errno);
+            return;
+        }
+
+        released_offset = release_to;
+    }
+
+    void perfetto_sdk_helper_t::query_overruns(std::function<void(std::optional<std::uint64_t>)> callback)
+    {
+        if (!tracing_session || !session_started) {
+            callback({});
+            return;
+        }
+
+        tracing_session->GetTraceStats(
+            [callback = std::move(callback)](perfetto::TracingSession::GetTraceStatsCallbackArgs args) {
+                if (!args.success) {
+                    LOG_DEBUG("Failed to read perfetto trace stats");
+                    callback({});
+                    return;
+                }
+
+                perfetto::protos::gen::TraceStats stats {};
+                if (!stats.ParseFromArray(args.trace_stats_data.data(), args.trace_stats_data.size())) {
+                    LOG_DEBUG("Failed to decode perfetto trace stats");
+                    callback({});
+                    return;
+                }
+
+                std::uint64_t overruns = 0;
+                for (auto const & buffer_stats : stats.buffer_stats()) {
+                    overruns += buffer_stats.chunks_overwritten() + buffer_stats.chunks_discarded();
+                }
+
+                callback(overruns);
+            });
+    }
 }
@@ -1,32 +1,42 @@
-/* Copyright (C) 2022 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "Logging.h"
-#include "async/continuations/async_initiate.h"
-#include "async/continuations/continuation.h"
-#include "async/continuations/operations.h"
-#include "async/continuations/stored_continuation.h"
-#include "async/continuations/use_continuation.h"
+#include "ipc/messages.h"
 #include "lib/AutoClosingFd.h"
 #include "lib/Utils.h"
 #include "perfetto/sdk/perfetto.h"
 
-#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
-#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <boost/asio/bind_executor.hpp>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/io_context_strand.hpp>
-#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/system/error_code.hpp>
 
 namespace agents {
     /**
     * A handler for the connection between Perfetto SDK and perfetto agent and a wrapper for the SDK functions
+    *
+    * Perfetto writes the trace into a memfd (rather than a pipe) so that it never blocks on, or is limited by the
+    * capacity of, the agent's reader. The memfd is polled at the file write period, and the pages that have been
+    * read are released so that it does not grow without bound.
     */
 
     class perfetto_sdk_helper_t : public std::enable_shared_from_this<perfetto_sdk_helper_t> {
@@ -34,47 +44,119 @@ namespace agents {
     public:
         using data_source_list_t = std::unordered_map<int, std::vector<std::string>>;
 
-        explicit perfetto_sdk_helper_t(boost::asio::io_context & context) : ctx(context), strand(context) {}
+        explicit perfetto_sdk_helper_t(boost::asio::io_context & context)
+            : ctx(context), strand(context), poll_timer(context)
+        {
+        }
 
         void initialize_sdk();
 
         void stop_sdk();
 
+        /** Set the trace configuration. Must be called before start_trace, otherwise the defaults are used. */
+        void set_configuration(ipc::perfetto_configuration_t const & configuration);
+
         bool start_trace();
 
+        /**
+         * Read the next block of trace data, waiting until there is some.
+         *
+         * Completes with `eof` once the trace has been stopped and all of its data has been read.
+         */
         template<typename CompletionToken>
         [[nodiscard]] auto async_read_trace(boost::asio::mutable_buffer buffer, CompletionToken && token)
         {
-            using namespace async::continuations;
-
             return boost::asio::async_initiate<CompletionToken, void(boost::system::error_code, std::size_t)>(
                 [self = this->shared_from_this()](auto && handler, auto buffer) {
-                    using handler_type = decltype(handler);
+                    using handler_type = std::decay_t<decltype(handler)>;
 
-                    if (!self->session_started) {
-                        auto err = boost::asio::error::make_error_code(boost::asio::error::not_connected);
-                        handler(err, 0);
-                    }
+                    auto h = handler_type(std::forward<decltype(handler)>(handler));
 
-                    self->perfetto_read_stream.value().async_read_some(buffer, std::forward<handler_type>(handler));
+                    boost::asio::post(self->strand, [self, buffer, h = std::move(h)]() mutable {
+                        self->do_read_trace(buffer, std::move(h));
+                    });
                 },
                 std::forward<CompletionToken>(token),
                 buffer);
         }
 
+        /**
+         * Query perfetto for the total number of trace buffer chunks lost so far.
+         *
+         * Completes with no value if the trace is not running or the stats could not be read.
+         */
+        template<typename CompletionToken>
+        [[nodiscard]] auto async_get_overruns(CompletionToken && token)
+        {
+            return boost::asio::async_initiate<CompletionToken, void(std::optional<std::uint64_t>)>(
+                [self = this->shared_from_this()](auto && handler) {
+                    using handler_type = std::decay_t<decltype(handler)>;
+
+                    // the perfetto callback must be copyable
+                    auto shared_handler = std::make_shared<handler_type>(std::forward<decltype(handler)>(handler));
+
+                    self->query_overruns([self, shared_handler](std::optional<std::uint64_t> overruns) {
+                        boost::asio::post(self->strand,
+                                          [shared_handler, overruns]() { (*shared_handler)(overruns); });
+                    });
+                },
+                std::forward<CompletionToken>(token));
+        }
+
     private:
         static constexpr std::string_view GPU_RENDERSTAGES_DATASOURCE = "gpu.renderstages";
 
         boost::asio::io_context & ctx;
         boost::asio::io_context::strand strand;
+        boost::asio::steady_timer poll_timer;
 
         std::unique_ptr<perfetto::TracingSession> tracing_session = nullptr;
         perfetto::TraceConfig trace_config;
-        bool session_started {false};
-
-        lib::AutoClosingFd perfetto_write_fd;
-        std::optional<boost::asio::posix::stream_descriptor> perfetto_read_stream;
+        ipc::perfetto_configuration_t configuration {};
+        std::atomic_bool session_started {false};
+
+        /** The memfd that perfetto writes the trace into */
+        lib::AutoClosingFd trace_fd;
+        /** The offset of the next byte to read from trace_fd */
+        std::uint64_t read_offset {0};
+        /** The offset up to which the pages of trace_fd have been released */
+        std::uint64_t released_offset {0};
+
+        template<typename Handler>
+        void do_read_trace(boost::asio::mutable_buffer buffer, Handler && handler)
+        {
+            auto const [ec, n] = read_trace_data(buffer);
+
+            if (ec || (n > 0)) {
+                handler(ec, n);
+                return;
+            }
+
+            // nothing yet; wait for perfetto's next write
+            poll_timer.expires_after(std::chrono::milliseconds(get_file_write_period_ms()));
+            poll_timer.async_wait(boost::asio::bind_executor(
+                strand,
+                [self = this->shared_from_this(), buffer, handler = std::forward<Handler>(handler)](
+                    boost::system::error_code const & ec) mutable {
+                    if (ec) {
+                        handler(ec, 0);
+                        return;
+                    }
+                    self->do_read_trace(buffer, std::move(handler));
+                }));
+        }
 
         void fill_trace_configuration();
+
+        [[nodiscard]] std::uint32_t get_file_write_period_ms() const;
+
+        /** Read whatever is available from trace_fd; an empty result with no error means there is nothing yet */
+        [[nodiscard]] std::pair<boost::system::error_code, std::size_t> read_trace_data(
+            boost::asio::mutable_buffer buffer);
+
+        /** Release the pages of trace_fd that have been read */
+        void release_read_pages();
+
+        void query_overruns(std::function<void(std::optional<std::uint64_t>)> callback);
     };
 };
@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #include "armnn/ArmNNDriver.h"
 
@@ -7,8 +7,6 @@
 #include "Driver.h"
 #include "Events.h"
 #include "GetEventKey.h"
-#include "armnn/IAcceptor.h"
-#include "armnn/SocketAcceptor.h"
 #include "armnn/SocketIO.h"
 #include "xml/EventsXMLProcessor.h"
 
@@ -24,16 +22,14 @@ namespace armnn {
           mGlobalState {&getEventKey},
 
 #if !CONFIG_ARMNN_AGENT
-          mAcceptingSocket {SocketIO::udsServerListen("\0gatord_namespace", true)},
-          mSessionManager {std::unique_ptr<IAcceptor> {new SocketAcceptor {mAcceptingSocket, createSession}}},
+          mSessionManager {createSession, SocketIO::udsServerListen("\0gatord_namespace", true).releaseFd()},
 #else
-          mAcceptedSocketQueue {},
-          mSessionManager {std::unique_ptr<IAcceptor> {new SocketAcceptor {mAcceptedSocketQueue, createSession}}},
+          mSessionManager {createSession},
 #endif
           mDriverSourceConn {mSessionManager}
     {
 #if defined(__SANITIZE_THREAD__) || defined(__SANITIZE_ADDRESS__)
-        // mSessionManager starts threads that cause undefined behaviour and leaks when we fork
+        // mSessionManager starts a thread pool that causes undefined behaviour and leaks when we fork
         // but as these threads will be in a steady state (unless we get a connection exactly when we fork),
         // there shouldn't be any threading issues, just a small memory leak.
         mSessionManager.stop();
@@ -1,24 +1,25 @@
-/* Copyright (C) 2019-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
 #include "Config.h"
 #include "Driver.h"
 #include "armnn/GlobalState.h"
-#include "armnn/ISessionConsumer.h"
+#include "armnn/ISender.h"
+#include "armnn/ISession.h"
 #include "armnn/Session.h"
+#include "armnn/SessionConnection.h"
+#include "armnn/SessionServer.h"
 #include "armnn/SessionStateTracker.h"
-#include "armnn/SocketAcceptor.h"
-#include "armnn/SocketIO.h"
-#include "armnn/ThreadManagementServer.h"
 
 #if CONFIG_ARMNN_AGENT
-#include "armnn/AcceptedSocketQueue.h"
 #include "armnn/DriverSourceWithAgent.h"
-#include "armnn/ISocketIOConsumer.h"
+#include "armnn/ISessionConnectionConsumer.h"
 #else
 #include "armnn/DriverSourceIpc.h"
 #endif
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 namespace armnn {
@@ -55,26 +56,26 @@ namespace armnn {
         void startAcceptingThread() { mSessionManager.start(); }
 
 #if CONFIG_ARMNN_AGENT
-        [[nodiscard]] ISocketIOConsumer & getAcceptedSocketConsumer() { return mAcceptedSocketQueue; }
+        [[nodiscard]] ISessionConnectionConsumer & getConnectionConsumer() { return mSessionManager; }
 #endif
 
     private:
-        std::uint32_t mSessionCount {0};
+        /// Sessions are created concurrently, on the connections' strands
+        std::atomic<std::uint32_t> mSessionCount {0};
 
-        SessionSupplier createSession = [&](std::unique_ptr<ISocketIO> connection) {
+        SessionSupplier createSession = [&](HeaderPacket && headerPacket, std::unique_ptr<ISender> sender) {
             const std::uint32_t uniqueSessionID = mSessionCount++;
 
-            return Session::create(std::move(connection), mGlobalState, mDriverSourceConn, uniqueSessionID);
+            return Session::create(std::move(headerPacket),
+                                   std::move(sender),
+                                   mGlobalState,
+                                   mDriverSourceConn,
+                                   uniqueSessionID);
         };
 
         GlobalState mGlobalState;
 
-#if !CONFIG_ARMNN_AGENT
-        SocketIO mAcceptingSocket;
-#else
-        AcceptedSocketQueue mAcceptedSocketQueue;
-#endif
-        ThreadManagementServer mSessionManager;
+        SessionServer mSessionManager;
 
 #if !CONFIG_ARMNN_AGENT
         DriverSourceIpc mDriverSourceConn;
@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 #include "armnn/DecoderUtility.h"
 
 #include "Logging.h"
@@ -9,7 +9,7 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <map>
+#include <cstring>
 #include <optional>
 #include <set>
 #include <sstream>
@@ -240,36 +240,57 @@ namespace armnn {
         return true;
     }
 
-    /**
-     *@param startPosition startPosition after reading bytes array as a 32bit data.
-     *Returns true if was able to decode the  counterIndexValues, if there are any malformed packets decoding
-     * is not started and returns false
-     */
-    bool addCounterIndexValues(int startPosition,
-                               const ByteOrder byteOrder,
-                               const Bytes & bytes,
-                               std::map<std::uint16_t, std::uint32_t> & counterIndexValues)
-    {
-        std::uint32_t size = sizeof(std::uint16_t) + sizeof(std::uint32_t);
+    namespace {
+        /** Decode the packed (uid, value) pairs in one pass; the byte order is resolved once, not per field */
+        template<bool swap>
+        void decodeCounterIndexValueArray(const std::uint8_t * data, std::size_t count, CounterIndexValue * out)
+        {
+            for (std::size_t n = 0; n < count; ++n, data += COUNTERINDEX_VALUE_SIZE) {
+                std::uint16_t index;
+                std::uint32_t value;
+                std::memcpy(&index, data, sizeof(index));
+                std::memcpy(&value, data + sizeof(index), sizeof(value));
+                if constexpr (swap) {
+                    index = __builtin_bswap16(index);
+                    value = __builtin_bswap32(value);
+                }
+                out[n] = {index, value};
+            }
+        }
 
-        std::uint32_t position = startPosition * UINT32_SIZE;
-        int remaningBytes = bytes.size() - position;
+        /**
+         * Decode the counter values that follow the packet header, reusing the storage of `counterIndexValues`
+         *
+         * @param offset The offset of the first (uid, value) pair
+         * @return false if the packet is malformed
+         */
+        bool decodeCounterIndexValues(std::size_t offset,
+                                      const ByteOrder byteOrder,
+                                      const Bytes & bytes,
+                                      std::vector<CounterIndexValue> & counterIndexValues)
+        {
+            if ((bytes.size() < offset) || (((bytes.size() - offset) % COUNTERINDEX_VALUE_SIZE) != 0)) {
+                LOG_ERROR("Malformed bytes received for counter ids");
+                return false;
+            }
 
-        if (remaningBytes > 0 && ((remaningBytes % size) != 0)) {
-            LOG_ERROR("Malformed bytes received for counter ids");
-            return false;
-        }
-        for (; (position + size) <= bytes.size(); position += size) {
-            const std::uint16_t index = byte_order::get_16(byteOrder, bytes, position);
-            const std::uint32_t value = byte_order::get_32(byteOrder, bytes, position + sizeof(std::uint16_t));
-            counterIndexValues.insert({index, value});
+            const std::size_t count = (bytes.size() - offset) / COUNTERINDEX_VALUE_SIZE;
+            counterIndexValues.resize(count);
+
+            if (byteOrder == byte_order::SYSTEM) {
+                decodeCounterIndexValueArray<false>(bytes.data() + offset, count, counterIndexValues.data());
+            }
+            else {
+                decodeCounterIndexValueArray<true>(bytes.data() + offset, count, counterIndexValues.data());
+            }
+            return true;
         }
-        return true;
     }
 
     bool decodeAndConsumePeriodicCounterCapturePkt(const Bytes & bytes,
                                                    const ByteOrder byteOrder,
-                                                   IPacketConsumer & consumer)
+                                                   IPacketConsumer & consumer,
+                                                   std::vector<CounterIndexValue> & counterIndexValues)
     {
         std::size_t timestampSize = sizeof(std::uint64_t);
 
@@ -279,12 +300,11 @@ namespace armnn {
         }
 
         const std::uint64_t timeStamp = byte_order::get_64(byteOrder, bytes, 0);
-        std::map<std::uint16_t, std::uint32_t> counterIndexValueMap;
 
-        if (!addCounterIndexValues(2, byteOrder, bytes, counterIndexValueMap)) {
+        if (!decodeCounterIndexValues(timestampSize, byteOrder, bytes, counterIndexValues)) {
             return false;
         }
-        if (!consumer.onPeriodicCounterCapture(timeStamp, counterIndexValueMap)) {
+        if (!consumer.onPeriodicCounterCapture(timeStamp, counterIndexValues)) {
             return false;
         }
         return true;
@@ -293,7 +313,8 @@ namespace armnn {
     bool decodeAndConsumePerJobCounterCapturePkt(bool isPreJob,
                                                  const Bytes & bytes,
                                                  const ByteOrder byteOrder,
-                                                 IPacketConsumer & consumer)
+                                                 IPacketConsumer & consumer,
+                                                 std::vector<CounterIndexValue> & counterIndexValues)
     {
         std::size_t timestampAndObjectRefSize = 2 * sizeof(std::uint64_t);
 
@@ -304,11 +325,10 @@ namespace armnn {
         }
         const std::uint64_t timeStamp = byte_order::get_64(byteOrder, bytes, 0);
         const std::uint64_t objectRef = byte_order::get_64(byteOrder, bytes, 2 * UINT32_SIZE);
-        std::map<std::uint16_t, std::uint32_t> counterIndexValueMap;
-        if (!addCounterIndexValues(4, byteOrder, bytes, counterIndexValueMap)) {
+        if (!decodeCounterIndexValues(timestampAndObjectRefSize, byteOrder, bytes, counterIndexValues)) {
             return false;
         }
-        if (!consumer.onPerJobCounterCapture(isPreJob, timeStamp, objectRef, counterIndexValueMap)) {
+        if (!consumer.onPerJobCounterCapture(isPreJob, timeStamp, objectRef, counterIndexValues)) {
             return false;
         }
         return true;
@@ -1,4 +1,4 @@
-/* Copyright (C) 2019-2021 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 #ifndef ARMNN_DECODERUTILITY_H_
 #define ARMNN_DECODERUTILITY_H_
 
@@ -7,6 +7,7 @@
 #include "armnn/PacketUtilityModels.h"
 
 #include <optional>
+#include <vector>
 
 namespace armnn {
 
@@ -23,14 +24,18 @@ namespace armnn {
 
     bool decodeAndConsumePerJobCounterSelectionPkt(Bytes bytes, ByteOrder byteOrder, IPacketConsumer & consumer);
 
+    /** @param counterIndexValues Scratch storage for the decoded values, reused between packets */
     bool decodeAndConsumePeriodicCounterCapturePkt(const Bytes & bytes,
                                                    ByteOrder byteOrder,
-                                                   IPacketConsumer & consumer);
+                                                   IPacketConsumer & consumer,
+                                                   std::vector<CounterIndexValue> & counterIndexValues);
 
+    /** @param counterIndexValues Scratch storage for the decoded values, reused between packets */
     bool decodeAndConsumePerJobCounterCapturePkt(bool isPreJob,
                                                  const Bytes & bytes,
                                                  ByteOrder byteOrder,
-                                                 IPacketConsumer & consumer);
+                                                 IPacketConsumer & consumer,
+                                                 std::vector<CounterIndexValue> & counterIndexValues);
 
 }
 #endif // end of ARMNN_DECODERUTILITY_H_
@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #include "armnn/DriverSourceIpc.h"
 
@@ -104,6 +104,7 @@ namespace armnn {
         constexpr const uint8_t INTERRUPT_MSG = 13;
         constexpr const uint8_t COUNTERS_MSG = 14;
         constexpr const uint8_t PACKET_MSG = 15;
+        constexpr const uint8_t COUNTER_VALUES_MSG = 16;
     }
 
     ChildToParentController::ChildToParentController() : mChildToParent {createPipe()}
@@ -211,6 +212,8 @@ namespace armnn {
                     return false;
                 case COUNTERS_MSG:
                     return readCounterStruct(destination);
+                case COUNTER_VALUES_MSG:
+                    return readCounterValues(destination);
                 case PACKET_MSG:
                     return readPacket(destination, isOneShot, getBufferBytesAvailable);
                 default:
@@ -255,6 +258,54 @@ namespace armnn {
         return mToChild.writeAll(asBytes(msg));
     }
 
+    struct CounterValuesHeader {
+        std::uint64_t timestamp;
+        std::uint32_t count;
+    } __attribute__((packed));
+
+    bool ParentToChildCounterConsumer::readCounterValues(ICounterConsumer & destination)
+    {
+        CounterValuesHeader header {};
+        if (!mToChild.readAll(asBytes(header))) {
+            LOG_ERROR("Failed to read counters from gator-main");
+            return false;
+        }
+
+        // the child is forked from the parent, so the values are sent as is
+        mCounterValues.resize(header.count);
+        const MutBytes values {reinterpret_cast<std::uint8_t *>(mCounterValues.data()),
+                               mCounterValues.size() * sizeof(ApcCounterValue)};
+        if (!mToChild.readAll(values)) {
+            LOG_ERROR("Failed to read counters from gator-main");
+            return false;
+        }
+
+        destination.consumeCounterValues(header.timestamp, mCounterValues);
+        return true;
+    }
+
+    bool ParentToChildCounterConsumer::consumeCounterValues(std::uint64_t timestamp,
+                                                            lib::Span<const ApcCounterValue> counterValues)
+    {
+        static_assert(std::is_trivially_copyable_v<ApcCounterValue>, "must be a trivially copyable type");
+
+        CounterValuesHeader header {};
+        header.timestamp = timestamp;
+        header.count = counterValues.size();
+
+        const std::uint8_t msgtype[1] = {COUNTER_VALUES_MSG};
+        const auto headerBytes = asBytes(header);
+        const auto * valueBytes = reinterpret_cast<const std::uint8_t *>(counterValues.data());
+
+        // write the whole message at once, so the sample costs one write rather than two per value
+        mSendBuffer.clear();
+        mSendBuffer.insert(mSendBuffer.end(), std::begin(msgtype), std::end(msgtype));
+        mSendBuffer.insert(mSendBuffer.end(), headerBytes.begin(), headerBytes.end());
+        mSendBuffer.insert(mSendBuffer.end(), valueBytes, valueBytes + counterValues.size() * sizeof(ApcCounterValue));
+
+        return mToChild.writeAll(mSendBuffer);
+    }
+
     struct TimelineHeader {
         std::uint32_t sessionId;
         std::size_t dataLength;
@@ -345,6 +396,15 @@ namespace armnn {
         return true;
     }
 
+    bool DriverSourceIpc::consumeCounterValues(std::uint64_t timestamp, lib::Span<const ApcCounterValue> counterValues)
+    {
+        std::lock_guard<std::mutex> guard(mParentMutex);
+        if (mCountersChannel) {
+            return mCountersChannel->consumeCounterValues(timestamp, counterValues);
+        }
+        return true;
+    }
+
     bool DriverSourceIpc::consumePacket(std::uint32_t sessionId, lib::Span<const std::uint8_t> data)
     {
         std::lock_guard<std::mutex> guard(mParentMutex);
@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -8,11 +8,13 @@
 #include "lib/AutoClosingFd.h"
 #include "lib/Span.h"
 
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace armnn {
 
@@ -77,6 +79,7 @@ namespace armnn {
         bool consumeCounterValue(std::uint64_t timestamp,
                                  ApcCounterKeyAndCoreNumber keyAndCore,
                                  std::uint32_t counterValue);
+        bool consumeCounterValues(std::uint64_t timestamp, lib::Span<const ApcCounterValue> counterValues);
         bool consumePacket(std::uint32_t sessionId, lib::Span<const std::uint8_t> data);
 
         /**
@@ -88,7 +91,12 @@ namespace armnn {
     private:
         Pipe mToChild;
         bool mOneShotModeEnabledAndEnded;
+        /// Reused between samples by the sending (parent) side
+        std::vector<std::uint8_t> mSendBuffer {};
+        /// Reused between samples by the receiving (child) side
+        std::vector<ApcCounterValue> mCounterValues {};
         bool readCounterStruct(ICounterConsumer & destination);
+        bool readCounterValues(ICounterConsumer & destination);
         bool readPacket(ICounterConsumer & destination,
                         bool isOneShot,
                         const std::function<unsigned int()> & getBufferBytesAvailable);
@@ -140,6 +148,11 @@ namespace armnn {
                                  ApcCounterKeyAndCoreNumber keyAndCore,
                                  std::uint32_t counterValue) override;
 
+        /**
+         * Transmits all of the values from one sample with a single write
+         */
+        bool consumeCounterValues(std::uint64_t timestamp, lib::Span<const ApcCounterValue> counterValues) override;
+
         /**
          * @return whether the data was successfully consumed
          */
@@ -1,4 +1,4 @@
-/* Copyright (C) 2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2023-2025 by Arm Limited. All rights reserved. */
 
 #include "armnn/DriverSourceWithAgent.h"
 
@@ -55,6 +55,27 @@ namespace armnn {
         return false;
     }
 
+    bool DriverSourceWithAgent::consumeCounterValues(std::uint64_t timestamp,
+                                                     lib::Span<const ApcCounterValue> counterValues)
+    {
+        const std::unique_lock<std::mutex> guard {mSessionMutex};
+
+        if (mSessionCounterConsumer == nullptr) {
+            return true;
+        }
+
+        // send the data
+        if (mSessionCounterConsumer->consumeCounterValues(timestamp, counterValues)) {
+            return true;
+        }
+
+        // after sending, notify, so that the run function can check for buffer full
+        mBufferFull = true;
+        mSessionNotify.notify_one();
+
+        return false;
+    }
+
     bool DriverSourceWithAgent::consumePacket(std::uint32_t sessionId, lib::Span<const std::uint8_t> data)
     {
         const std::unique_lock<std::mutex> guard {mSessionMutex};
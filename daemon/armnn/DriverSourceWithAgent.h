@@ -1,4 +1,4 @@
-/* Copyright (C) 2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2023-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -56,6 +56,11 @@ namespace armnn {
                                  ApcCounterKeyAndCoreNumber keyAndCore,
                                  std::uint32_t counterValue) override;
 
+        /**
+         * Transmits all of the values from one sample, taking the session lock once
+         */
+        bool consumeCounterValues(std::uint64_t timestamp, lib::Span<const ApcCounterValue> counterValues) override;
+
         /**
          * @return whether the data was successfully consumed
          */
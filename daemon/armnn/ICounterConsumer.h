@@ -1,4 +1,4 @@
-/* Copyright (C) 2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -18,6 +18,12 @@ namespace armnn {
         }
     };
 
+    /** A counter value along with the APC counter it belongs to */
+    struct ApcCounterValue {
+        ApcCounterKeyAndCoreNumber keyAndCore;
+        std::uint32_t value;
+    };
+
     class ICounterConsumer {
     public:
         virtual ~ICounterConsumer() = default;
@@ -29,6 +35,22 @@ namespace armnn {
                                          ApcCounterKeyAndCoreNumber keyAndCore,
                                          std::uint32_t counterValue) = 0;
 
+        /**
+         * Consume all of the counter values sampled at the same timestamp. Implementations should override this
+         * where they can handle the batch more cheaply than one value at a time.
+         *
+         * @return whether the values were successfully consumed
+         */
+        virtual bool consumeCounterValues(std::uint64_t timestamp, lib::Span<const ApcCounterValue> counterValues)
+        {
+            for (auto const & counterValue : counterValues) {
+                if (!consumeCounterValue(timestamp, counterValue.keyAndCore, counterValue.value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         /**
          * @return whether the data was successfully consumed
          */
@@ -1,10 +1,12 @@
-/* Copyright (C) 2019-2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 
 #ifndef ARMNN_IPERJOBCOUNTERCAPTURECONSUMER_H_
 #define ARMNN_IPERJOBCOUNTERCAPTURECONSUMER_H_
 
+#include "armnn/IPeriodicCounterCaptureConsumer.h"
+#include "lib/Span.h"
+
 #include <cstdint>
-#include <map>
 
 namespace armnn {
     class IPerJobCounterCaptureConsumer {
@@ -14,7 +16,7 @@ namespace armnn {
         virtual bool onPerJobCounterCapture(bool isPre,
                                             std::uint64_t timeStamp,
                                             std::uint64_t objectRef,
-                                            std::map<std::uint16_t, std::uint32_t> counterIndexValues) = 0;
+                                            lib::Span<const CounterIndexValue> counterIndexValues) = 0;
     };
 }
 
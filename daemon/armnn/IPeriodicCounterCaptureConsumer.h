@@ -1,18 +1,28 @@
-/* Copyright (C) 2019-2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 
 #ifndef ARMNN_IPERIODICCOUNTERCAPTURECONSUMER_H_
 #define ARMNN_IPERIODICCOUNTERCAPTURECONSUMER_H_
 
+#include "lib/Span.h"
+
 #include <cstdint>
-#include <map>
 
 namespace armnn {
+    /** A (counter uid, value) pair decoded from a counter capture packet */
+    struct CounterIndexValue {
+        std::uint16_t index;
+        std::uint32_t value;
+    };
+
     class IPeriodicCounterCaptureConsumer {
 
     public:
         virtual ~IPeriodicCounterCaptureConsumer() = default;
+        /**
+         * @param counterIndexValues The decoded values, in packet order. Only valid for the duration of the call.
+         */
         virtual bool onPeriodicCounterCapture(std::uint64_t timeStamp,
-                                              std::map<std::uint16_t, std::uint32_t> counterIndexValues) = 0;
+                                              lib::Span<const CounterIndexValue> counterIndexValues) = 0;
     };
 }
 
@@ -1,23 +1,27 @@
-/* Copyright (C) 2019-2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 #pragma once
 
+#include "lib/Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
 namespace armnn {
     class ISession {
     public:
         /**
-         * An object which reads and writes to a socket.
+         * An object which decodes the packets received from, and sends packets to, a connection.
          **/
         virtual ~ISession() = default;
 
         /**
-         * Closes the ISession object (interupting the sender and reciever threads)
-         **/
-        virtual void close() = 0;
-
-        /**
-         * Run the recieve thread. This function should be called in a thread outside of the ISession object
+         * Decode as many complete packets as are available at the start of `bytes`. The packets are decoded in place.
+         *
+         * @return The number of bytes consumed (zero if no complete packet is available yet), or empty if an invalid
+         * packet was received and the connection should be closed
          **/
-        virtual void runReadLoop() = 0;
+        [[nodiscard]] virtual std::optional<std::size_t> receivePackets(lib::Span<const std::uint8_t> bytes) = 0;
 
         /**
          * Write a packet to the sender queue requesting to start the capture
@@ -29,4 +33,4 @@ namespace armnn {
          **/
         virtual bool disableCapture() = 0;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,27 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace armnn {
+    /**
+     * A connection from an ArmNN process, whose data arrives from some other transport (such as the armnn agent)
+     */
+    class ISessionConnection {
+    public:
+        virtual ~ISessionConnection() noexcept = default;
+
+        /**
+         * Receive the next block of bytes from the connection. Returns immediately, the bytes are decoded
+         * asynchronously and in the order received.
+         */
+        virtual void receiveBytes(std::vector<std::uint8_t> && bytes) = 0;
+
+        /**
+         * Close the connection, for example because the remote end disconnected
+         */
+        virtual void close() = 0;
+    };
+}
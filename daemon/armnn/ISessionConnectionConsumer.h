@@ -0,0 +1,31 @@
+/* Copyright (C) 2023-2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include "armnn/ISender.h"
+#include "armnn/ISessionConnection.h"
+
+#include <functional>
+#include <memory>
+
+namespace armnn {
+
+    /**
+     * Interface for something that manages newly accepted connections
+     */
+    class ISessionConnectionConsumer {
+    public:
+        virtual ~ISessionConnectionConsumer() noexcept = default;
+
+        /**
+         * Start managing a newly accepted connection
+         *
+         * @param sender Used to send data to the remote end of the connection
+         * @param onClosed Called once, when the connection is closed by this end
+         * @return The connection object, which should be passed the data received from the remote end
+         */
+        [[nodiscard]] virtual std::shared_ptr<ISessionConnection> consumeConnection(std::unique_ptr<ISender> sender,
+                                                                                    std::function<void()> onClosed) = 0;
+    };
+
+}
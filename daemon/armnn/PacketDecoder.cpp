@@ -1,4 +1,4 @@
-/* Copyright (C) 2019-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 #include "armnn/PacketDecoder.h"
 
 #include "Logging.h"
@@ -54,7 +54,10 @@ namespace armnn {
             case lib::toEnumValue(PacketType::PeriodicCounterCapturePkt): //
             {
                 //1.x.x
-                if (!armnn::decodeAndConsumePeriodicCounterCapturePkt(payload, byteOrder, consumer)) {
+                if (!armnn::decodeAndConsumePeriodicCounterCapturePkt(payload,
+                                                                      byteOrder,
+                                                                      consumer,
+                                                                      counterIndexValues)) {
                     LOG_ERROR("Decode and consume of periodic counter capture failed");
                     return DecodingStatus::Failed;
                 }
@@ -63,7 +66,11 @@ namespace armnn {
             case lib::toEnumValue(PacketType::PrePerJobCounterCapturePkt): //
             {
                 //1.x.x
-                if (!armnn::decodeAndConsumePerJobCounterCapturePkt(true, payload, byteOrder, consumer)) {
+                if (!armnn::decodeAndConsumePerJobCounterCapturePkt(true,
+                                                                    payload,
+                                                                    byteOrder,
+                                                                    consumer,
+                                                                    counterIndexValues)) {
                     LOG_ERROR("Decode and consume of pre per job counter capture failed");
                     return DecodingStatus::Failed;
                 }
@@ -72,7 +79,11 @@ namespace armnn {
             case lib::toEnumValue(PacketType::PostPerJobCounterCapturePkt): //
             {
                 //1.x.x
-                if (!armnn::decodeAndConsumePerJobCounterCapturePkt(false, payload, byteOrder, consumer)) {
+                if (!armnn::decodeAndConsumePerJobCounterCapturePkt(false,
+                                                                    payload,
+                                                                    byteOrder,
+                                                                    consumer,
+                                                                    counterIndexValues)) {
                     LOG_ERROR("Decode and consume of post per job counter capture failed");
                     return DecodingStatus::Failed;
                 }
@@ -1,4 +1,4 @@
-/* Copyright (C) 2019-2021 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 
 #ifndef ARMNN_PACKETDECODER_H_
 #define ARMNN_PACKETDECODER_H_
@@ -11,6 +11,7 @@
 #include "armnn/PacketUtilityModels.h"
 
 #include <optional>
+#include <vector>
 
 namespace armnn {
 
@@ -34,6 +35,8 @@ namespace armnn {
     private:
         ByteOrder byteOrder;
         IPacketConsumer & consumer;
+        /// Reused for each counter capture packet, so decoding them does not allocate
+        std::vector<CounterIndexValue> counterIndexValues {};
     };
 }
 
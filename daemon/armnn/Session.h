@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2020-2023 by Arm Limited. All rights reserved.
+ * Copyright (C) 2020-2025 by Arm Limited. All rights reserved.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License version 2 as
@@ -14,14 +14,15 @@
 #include "armnn/ISender.h"
 #include "armnn/ISession.h"
 #include "armnn/ISessionPacketSender.h"
-#include "armnn/ISocketIO.h"
 #include "armnn/SessionStateTracker.h"
+#include "lib/Span.h"
 
-#include <functional>
-#include <mutex>
-#include <queue>
-#include <thread>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace armnn {
     // Struct to store the metadata for the connection
@@ -32,32 +33,33 @@ namespace armnn {
 
     class Session : public ISession {
     public:
-        /** Creates a unique pointer to a Session object **/
-        static std::unique_ptr<Session> create(std::unique_ptr<ISocketIO> connection,
+        /**
+         * Creates a unique pointer to a Session object, and acknowledges the connection
+         * @param headerPacket The connection's metadata packet, as decoded by decodeHeaderPacket
+         * @param sender Used to send packets to the connection
+         **/
+        static std::unique_ptr<Session> create(HeaderPacket && headerPacket,
+                                               std::unique_ptr<ISender> sender,
                                                IGlobalState & globalState,
                                                ICounterConsumer & counterConsumer,
                                                const std::uint32_t sessionID);
 
         /**
-         * Initialises the connection.
-         * @param connection connection to be initialised
+         * Decodes the metadata packet that starts the connection.
+         * @param bytes The bytes received so far
          * @param headerPacket out parameter for a HeaderPacket
-         * @return true if connection has been initialised, false if not
+         * @return The size of the packet if it was decoded, zero if more bytes are needed, or empty if it is invalid
          **/
-        static bool initialiseConnection(ISocketIO & connection, HeaderPacket & headerPacket);
+        static std::optional<std::size_t> decodeHeaderPacket(lib::Span<const std::uint8_t> bytes,
+                                                             HeaderPacket & headerPacket);
 
         /**
-         * @param connection will need to be initialised prior
          * @param decoder will outlive sst
-         * @param sst will outlive socket
          */
-        Session(std::unique_ptr<ISocketIO> connection,
-                ByteOrder byteOrder,
-                std::unique_ptr<IPacketDecoder> decoder,
-                std::unique_ptr<SessionStateTracker> sst);
+        Session(ByteOrder byteOrder, std::unique_ptr<IPacketDecoder> decoder, std::unique_ptr<SessionStateTracker> sst);
 
         Session() = delete;
-        ~Session() override;
+        ~Session() override = default;
 
         // No copying
         Session(const Session &) = delete;
@@ -67,13 +69,8 @@ namespace armnn {
         Session(Session && that) = delete;
         Session & operator=(Session && that) = delete;
 
-        /** Run the read loop.
-         *  Will loop until an invalid packet is recieved
-         **/
-        void runReadLoop() override;
-
-        /** Closes the connection **/
-        void close() override;
+        /** Decode the complete packets at the start of bytes **/
+        [[nodiscard]] std::optional<std::size_t> receivePackets(lib::Span<const std::uint8_t> bytes) override;
 
         /** Enable the capture **/
         bool enableCapture() override { return mSessionStateTracker->doEnableCapture(); }
@@ -82,13 +79,11 @@ namespace armnn {
         bool disableCapture() override { return mSessionStateTracker->doDisableCapture(); }
 
     private:
-        static const std::size_t TIMEOUT = 3000;
         const ByteOrder mEndianness;
         // the order of these is important because they hold references to each other
-        std::unique_ptr<ISocketIO> mConnection;
         std::unique_ptr<SessionStateTracker> mSessionStateTracker;
         std::unique_ptr<IPacketDecoder> mDecoder;
 
-        bool receiveNextPacket();
+        bool receivePacket(std::uint32_t type, lib::Span<const std::uint8_t> packet);
     };
 }
@@ -0,0 +1,187 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#include "armnn/SessionConnection.h"
+
+#include "Logging.h"
+#include "armnn/ISender.h"
+#include "armnn/ISession.h"
+#include "armnn/Session.h"
+#include "lib/Span.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/post.hpp>
+
+namespace armnn {
+    SessionConnection::SessionConnection(boost::asio::io_context::strand strand,
+                                         std::unique_ptr<ISender> sender,
+                                         SessionSupplier supplier,
+                                         bool captureEnabled,
+                                         OnClosed onClosed)
+        : mStrand {std::move(strand)},
+          mSupplier {std::move(supplier)},
+          mOnClosed {std::move(onClosed)},
+          mSender {std::move(sender)},
+          mCaptureEnabled {captureEnabled}
+    {
+    }
+
+    void SessionConnection::receiveBytes(std::vector<std::uint8_t> && bytes)
+    {
+        boost::asio::post(mStrand, [self = shared_from_this(), bytes = std::move(bytes)]() mutable {
+            if (self->mClosed || bytes.empty()) {
+                return;
+            }
+
+            if (self->mBegin == self->mEnd) {
+                // nothing is pending, so decode directly from the received block rather than copying it
+                self->mBuffer = std::move(bytes);
+                self->mBegin = 0;
+                self->mEnd = self->mBuffer.size();
+            }
+            else {
+                if ((self->mBuffer.size() - self->mEnd) < bytes.size()) {
+                    self->mBuffer.resize(self->mEnd + bytes.size());
+                }
+                std::memcpy(self->mBuffer.data() + self->mEnd, bytes.data(), bytes.size());
+                self->mEnd += bytes.size();
+            }
+
+            (void) self->processReceived();
+        });
+    }
+
+    void SessionConnection::close()
+    {
+        boost::asio::post(mStrand, [self = shared_from_this()]() { self->doClose(); });
+    }
+
+    lib::Span<std::uint8_t> SessionConnection::prepareReceive()
+    {
+        if (mBuffer.size() < INITIAL_BUFFER_SIZE) {
+            mBuffer.resize(INITIAL_BUFFER_SIZE);
+        }
+
+        if (mEnd == mBuffer.size()) {
+            if (mBegin > 0) {
+                // move the partial packet to the front to make space
+                std::memmove(mBuffer.data(), mBuffer.data() + mBegin, mEnd - mBegin);
+                mEnd -= mBegin;
+                mBegin = 0;
+            }
+            else {
+                // the buffer holds only part of a single packet
+                mBuffer.resize(mBuffer.size() * 2);
+            }
+        }
+
+        return {mBuffer.data() + mEnd, mBuffer.size() - mEnd};
+    }
+
+    bool SessionConnection::commitReceive(std::size_t n)
+    {
+        if (mClosed) {
+            return false;
+        }
+
+        mEnd = std::min(mEnd + n, mBuffer.size());
+        return processReceived();
+    }
+
+    void SessionConnection::setCaptureEnabled(bool enabled)
+    {
+        const std::lock_guard<std::mutex> lock {mSessionMutex};
+
+        mCaptureEnabled = enabled;
+
+        if (mSession != nullptr) {
+            if (enabled) {
+                mSession->enableCapture();
+            }
+            else {
+                mSession->disableCapture();
+            }
+        }
+    }
+
+    bool SessionConnection::processReceived()
+    {
+        while (mBegin < mEnd) {
+            const lib::Span<const std::uint8_t> bytes {mBuffer.data() + mBegin, mEnd - mBegin};
+
+            const auto consumed = (mSession != nullptr ? mSession->receivePackets(bytes) //
+                                                       : receiveHeaderPacket(bytes));
+            if (!consumed) {
+                doClose();
+                return false;
+            }
+
+            if (*consumed == 0) {
+                break;
+            }
+
+            mBegin += *consumed;
+        }
+
+        if (mBegin == mEnd) {
+            mBegin = 0;
+            mEnd = 0;
+        }
+
+        return true;
+    }
+
+    std::optional<std::size_t> SessionConnection::receiveHeaderPacket(lib::Span<const std::uint8_t> bytes)
+    {
+        HeaderPacket headerPacket {};
+
+        const auto consumed = Session::decodeHeaderPacket(bytes, headerPacket);
+        if (!consumed || (*consumed == 0)) {
+            return consumed;
+        }
+
+        auto session = mSupplier(std::move(headerPacket), std::move(mSender));
+        if (session == nullptr) {
+            return {};
+        }
+
+        const std::lock_guard<std::mutex> lock {mSessionMutex};
+
+        if (mCaptureEnabled) {
+            session->enableCapture();
+        }
+        else {
+            session->disableCapture();
+        }
+
+        mSession = std::move(session);
+
+        return consumed;
+    }
+
+    void SessionConnection::doClose()
+    {
+        if (std::exchange(mClosed, true)) {
+            return;
+        }
+
+        LOG_DEBUG("Closing ArmNN session connection");
+
+        mBuffer = {};
+        mBegin = 0;
+        mEnd = 0;
+
+        if (mOnClosed) {
+            mOnClosed(*this);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include "armnn/ISender.h"
+#include "armnn/ISession.h"
+#include "armnn/ISessionConnection.h"
+#include "armnn/Session.h"
+#include "lib/Span.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <boost/asio/io_context_strand.hpp>
+
+namespace armnn {
+    /// Creates the session once the connection's metadata packet is received
+    /// May return nullptr if a session could not be created
+    using SessionSupplier =
+        std::function<std::unique_ptr<ISession>(HeaderPacket && headerPacket, std::unique_ptr<ISender> sender)>;
+
+    /**
+     * Receives the data for one ArmNN connection into a reusable buffer, from which the packets are decoded in place.
+     *
+     * All of the receive processing happens on the connection's strand, so separate connections are decoded
+     * concurrently but the packets of any one connection are decoded in order.
+     */
+    class SessionConnection : public ISessionConnection, public std::enable_shared_from_this<SessionConnection> {
+    public:
+        using OnClosed = std::function<void(SessionConnection const & connection)>;
+
+        static constexpr std::size_t INITIAL_BUFFER_SIZE = 64 * 1024;
+
+        /**
+         * @param strand The strand on which to process the received data
+         * @param sender Used to send packets to the connection
+         * @param supplier Creates the session once the metadata packet is received
+         * @param captureEnabled Whether the capture is initially enabled
+         * @param onClosed Called once, on the strand, when the connection is closed
+         */
+        SessionConnection(boost::asio::io_context::strand strand,
+                          std::unique_ptr<ISender> sender,
+                          SessionSupplier supplier,
+                          bool captureEnabled,
+                          OnClosed onClosed);
+
+        // No copying
+        SessionConnection(const SessionConnection &) = delete;
+        SessionConnection & operator=(const SessionConnection &) = delete;
+
+        // No moving
+        SessionConnection(SessionConnection && that) = delete;
+        SessionConnection & operator=(SessionConnection && that) = delete;
+
+        ~SessionConnection() noexcept override = default;
+
+        void receiveBytes(std::vector<std::uint8_t> && bytes) override;
+
+        void close() override;
+
+        /** @return The strand on which the received data is processed */
+        [[nodiscard]] boost::asio::io_context::strand & getStrand() { return mStrand; }
+
+        /**
+         * Get the space to read the next bytes into. Must be called on the strand.
+         * @return The free space at the end of the receive buffer, which is never empty
+         */
+        [[nodiscard]] lib::Span<std::uint8_t> prepareReceive();
+
+        /**
+         * Decode the bytes that were read into the space returned by prepareReceive. Must be called on the strand.
+         * @param n The number of bytes that were read
+         * @return false if the connection is now closed
+         */
+        [[nodiscard]] bool commitReceive(std::size_t n);
+
+        /** Enable or disable the capture on the session (or once the session is created) */
+        void setCaptureEnabled(bool enabled);
+
+    private:
+        boost::asio::io_context::strand mStrand;
+        SessionSupplier mSupplier;
+        OnClosed mOnClosed;
+        /// The sender, until it is handed to the session
+        std::unique_ptr<ISender> mSender;
+        /// The receive buffer; the bytes in [mBegin, mEnd) are yet to be decoded
+        std::vector<std::uint8_t> mBuffer {};
+        std::size_t mBegin {0};
+        std::size_t mEnd {0};
+        bool mClosed {false};
+
+        /// Protects mSession and mCaptureEnabled, which are also accessed from the capture controller
+        std::mutex mSessionMutex {};
+        /// Only ever set once, on the strand, so the strand may read it without the lock
+        std::unique_ptr<ISession> mSession {};
+        bool mCaptureEnabled;
+
+        [[nodiscard]] bool processReceived();
+        [[nodiscard]] std::optional<std::size_t> receiveHeaderPacket(lib::Span<const std::uint8_t> bytes);
+        void doClose();
+    };
+}
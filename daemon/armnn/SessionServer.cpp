@@ -0,0 +1,221 @@
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
+#include "armnn/SessionServer.h"
+
+#include "Logging.h"
+#include "OlySocket.h"
+#include "armnn/ISender.h"
+#include "armnn/ISessionConnection.h"
+#include "armnn/SessionConnection.h"
+#include "armnn/SessionSocket.h"
+#include "lib/AutoClosingFd.h"
+#include "lib/Error.h"
+
+#include <cassert>
+#include <cerrno>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context_strand.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <sys/prctl.h>
+
+namespace armnn {
+    SessionServer::SessionServer(SessionSupplier supplier)
+        : mSupplier {std::move(supplier)}, mWorkGuard {boost::asio::make_work_guard(mIoContext)}
+    {
+    }
+
+    SessionServer::SessionServer(SessionSupplier supplier, lib::AutoClosingFd listeningSocket)
+        : SessionServer {std::move(supplier)}
+    {
+        boost::system::error_code ec {};
+        mAcceptor.emplace(mIoContext);
+        mAcceptor->assign(boost::asio::local::stream_protocol(), listeningSocket.release(), ec);
+        if (ec) {
+            LOG_ERROR("Failed to listen for ArmNN connections due to %s", ec.message().c_str());
+            mAcceptor.reset();
+        }
+    }
+
+    void SessionServer::stop()
+    {
+        std::set<std::shared_ptr<SessionConnection>> connections {};
+        {
+            const std::lock_guard<std::mutex> lock {mMutex};
+
+            if (!mIsRunning) {
+                return;
+            }
+
+            // Ensure that stopCapture has been called
+            assert(!mEnabled);
+
+            mIsRunning = false;
+            std::swap(connections, mConnections);
+        }
+
+        if (mAcceptor) {
+            boost::asio::post(mAcceptorStrand, [this]() {
+                boost::system::error_code ignored {};
+                mAcceptor->close(ignored);
+            });
+        }
+
+        // Close the connections, the pool threads then exit once all of the outstanding work is done
+        for (auto const & connection : connections) {
+            connection->close();
+        }
+
+        mWorkGuard.reset();
+
+        for (auto & thread : mThreads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        mThreads.clear();
+    }
+
+    void SessionServer::start()
+    {
+        const std::lock_guard<std::mutex> lock {mMutex};
+
+        if ((!mIsRunning) || (!mThreads.empty())) {
+            return;
+        }
+
+        for (std::size_t n = 0; n < THREAD_POOL_SIZE; ++n) {
+            mThreads.emplace_back([this]() {
+                prctl(PR_SET_NAME, reinterpret_cast<unsigned long>(&"gatord-armnn"), 0, 0, 0);
+                mIoContext.run();
+            });
+        }
+
+        if (mAcceptor) {
+            boost::asio::post(mAcceptorStrand, [this]() { doAccept(); });
+        }
+    }
+
+    void SessionServer::startCapture()
+    {
+        const std::lock_guard<std::mutex> lock {mMutex};
+        for (auto const & connection : mConnections) {
+            connection->setCaptureEnabled(true);
+        }
+        mEnabled = true;
+    }
+
+    void SessionServer::stopCapture()
+    {
+        const std::lock_guard<std::mutex> lock {mMutex};
+        for (auto const & connection : mConnections) {
+            connection->setCaptureEnabled(false);
+        }
+        mEnabled = false;
+    }
+
+    std::shared_ptr<ISessionConnection> SessionServer::consumeConnection(std::unique_ptr<ISender> sender,
+                                                                         std::function<void()> onClosed)
+    {
+        return addConnection(boost::asio::io_context::strand {mIoContext}, std::move(sender), std::move(onClosed));
+    }
+
+    void SessionServer::doAccept()
+    {
+        mAcceptor->async_wait(
+            acceptor_type::wait_read,
+            boost::asio::bind_executor(mAcceptorStrand, [this](boost::system::error_code const & ec) {
+                if (ec) {
+                    if (ec != boost::asio::error::operation_aborted) {
+                        LOG_ERROR("Failed to accept ArmNN connection due to %s", ec.message().c_str());
+                    }
+                    return;
+                }
+
+                // accept manually, so that the socket is not inherited by any child process
+                lib::AutoClosingFd acceptedFd {::accept_cloexec(mAcceptor->native_handle(), nullptr, nullptr)};
+                if (acceptedFd) {
+                    acceptSocket(std::move(acceptedFd));
+                }
+                else if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)
+                         && (errno != ECONNABORTED)) {
+                    LOG_ERROR("Failed to accept socket due to %s (%d)", lib::strerror(), errno);
+                    return;
+                }
+
+                doAccept();
+            }));
+    }
+
+    void SessionServer::acceptSocket(lib::AutoClosingFd fd)
+    {
+        boost::asio::io_context::strand strand {mIoContext};
+
+        boost::system::error_code ec {};
+        SessionSocket::socket_type socket {mIoContext};
+        socket.assign(boost::asio::local::stream_protocol(), fd.get(), ec);
+        if (ec) {
+            LOG_ERROR("Failed to accept ArmNN connection due to %s", ec.message().c_str());
+            return;
+        }
+        (void) fd.release();
+
+        auto sessionSocket = std::make_shared<SessionSocket>(strand, std::move(socket));
+        auto connection = addConnection(strand,
+                                        SessionSocket::createSender(sessionSocket),
+                                        [sessionSocket]() { sessionSocket->close(); });
+        if (connection == nullptr) {
+            sessionSocket->close();
+            return;
+        }
+
+        sessionSocket->start(std::move(connection));
+    }
+
+    std::shared_ptr<SessionConnection> SessionServer::addConnection(boost::asio::io_context::strand strand,
+                                                                    std::unique_ptr<ISender> sender,
+                                                                    std::function<void()> onClosed)
+    {
+        const std::lock_guard<std::mutex> lock {mMutex};
+
+        if (!mIsRunning) {
+            return nullptr;
+        }
+
+        auto connection = std::make_shared<SessionConnection>(
+            std::move(strand),
+            std::move(sender),
+            mSupplier,
+            mEnabled,
+            [this, onClosed = std::move(onClosed)](SessionConnection const & connection) {
+                if (onClosed) {
+                    onClosed();
+                }
+                removeConnection(connection);
+            });
+
+        mConnections.insert(connection);
+
+        return connection;
+    }
+
+    void SessionServer::removeConnection(SessionConnection const & connection)
+    {
+        const std::lock_guard<std::mutex> lock {mMutex};
+
+        for (auto it = mConnections.begin(); it != mConnections.end(); ++it) {
+            if (it->get() == &connection) {
+                mConnections.erase(it);
+                return;
+            }
+        }
+    }
+}
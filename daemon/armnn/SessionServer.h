@@ -0,0 +1,90 @@
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
+#pragma once
+
+#include "armnn/ISender.h"
+#include "armnn/ISessionConnection.h"
+#include "armnn/ISessionConnectionConsumer.h"
+#include "armnn/IStartStopHandler.h"
+#include "armnn/SessionConnection.h"
+#include "lib/AutoClosingFd.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/io_context_strand.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+namespace armnn {
+    /**
+     * Serves all of the ArmNN connections from a small, fixed pool of threads, rather than a thread (or two) per
+     * connection.
+     **/
+    class SessionServer : public ICaptureStartStopHandler, public ISessionConnectionConsumer {
+    public:
+        static constexpr std::size_t THREAD_POOL_SIZE = 2;
+
+        /** Serves only the connections passed to consumeConnection */
+        explicit SessionServer(SessionSupplier supplier);
+
+        /** Also accepts connections from the listening socket, once started */
+        SessionServer(SessionSupplier supplier, lib::AutoClosingFd listeningSocket);
+
+        // No copying
+        SessionServer(const SessionServer &) = delete;
+        SessionServer & operator=(const SessionServer &) = delete;
+
+        // No moving
+        SessionServer(SessionServer && that) = delete;
+        SessionServer & operator=(SessionServer && that) = delete;
+
+        ~SessionServer() override { stop(); };
+
+        void stop();
+
+        void start();
+
+        /**
+         * Enables the capture on all capture sessions
+         **/
+        void startCapture() override;
+
+        /**
+         * Disables the capture on all capture sessions
+         **/
+        void stopCapture() override;
+
+        [[nodiscard]] std::shared_ptr<ISessionConnection> consumeConnection(std::unique_ptr<ISender> sender,
+                                                                            std::function<void()> onClosed) override;
+
+    private:
+        using acceptor_type = boost::asio::local::stream_protocol::acceptor;
+
+        SessionSupplier mSupplier;
+        boost::asio::io_context mIoContext {};
+        std::optional<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> mWorkGuard;
+        boost::asio::io_context::strand mAcceptorStrand {mIoContext};
+        std::optional<acceptor_type> mAcceptor {};
+
+        std::mutex mMutex {};
+        std::set<std::shared_ptr<SessionConnection>> mConnections {};
+        std::vector<std::thread> mThreads {};
+
+        bool mEnabled {false};
+        bool mIsRunning {true};
+
+        void doAccept();
+        void acceptSocket(lib::AutoClosingFd fd);
+        [[nodiscard]] std::shared_ptr<SessionConnection> addConnection(boost::asio::io_context::strand strand,
+                                                                       std::unique_ptr<ISender> sender,
+                                                                       std::function<void()> onClosed);
+        void removeConnection(SessionConnection const & connection);
+    };
+}
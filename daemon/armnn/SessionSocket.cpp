@@ -0,0 +1,143 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#include "armnn/SessionSocket.h"
+
+#include "Logging.h"
+#include "armnn/ISender.h"
+#include "armnn/SessionConnection.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/system/error_code.hpp>
+
+namespace armnn {
+    namespace {
+        class SocketSender : public ISender {
+        public:
+            explicit SocketSender(std::shared_ptr<SessionSocket> socket) : mSocket {std::move(socket)} {}
+
+            bool send(std::vector<std::uint8_t> && data) override { return mSocket->send(std::move(data)); }
+
+        private:
+            std::shared_ptr<SessionSocket> mSocket;
+        };
+    }
+
+    SessionSocket::SessionSocket(boost::asio::io_context::strand strand, socket_type socket)
+        : mStrand {std::move(strand)}, mSocket {std::move(socket)}
+    {
+    }
+
+    std::unique_ptr<ISender> SessionSocket::createSender(std::shared_ptr<SessionSocket> socket)
+    {
+        return std::make_unique<SocketSender>(std::move(socket));
+    }
+
+    void SessionSocket::start(std::shared_ptr<SessionConnection> connection)
+    {
+        boost::asio::post(mStrand, [self = shared_from_this(), connection = std::move(connection)]() mutable {
+            self->doRead(std::move(connection));
+        });
+    }
+
+    bool SessionSocket::send(std::vector<std::uint8_t> && data)
+    {
+        if (mClosed) {
+            return false;
+        }
+
+        boost::asio::post(mStrand, [self = shared_from_this(), data = std::move(data)]() mutable {
+            if (self->mClosed) {
+                return;
+            }
+
+            self->mSendQueue.push_back(std::move(data));
+
+            if (self->mWritingCount == 0) {
+                self->doWrite();
+            }
+        });
+
+        return true;
+    }
+
+    void SessionSocket::close()
+    {
+        boost::asio::post(mStrand, [self = shared_from_this()]() { self->doClose(); });
+    }
+
+    void SessionSocket::doRead(std::shared_ptr<SessionConnection> connection)
+    {
+        if (mClosed) {
+            return;
+        }
+
+        auto space = connection->prepareReceive();
+
+        mSocket.async_read_some(
+            boost::asio::buffer(space.data(), space.size()),
+            boost::asio::bind_executor(
+                mStrand,
+                [self = shared_from_this(), connection](boost::system::error_code const & ec, std::size_t n) mutable {
+                    if (ec) {
+                        if ((ec != boost::asio::error::eof) && (ec != boost::asio::error::operation_aborted)) {
+                            LOG_DEBUG("ArmNN session socket read failed with %s", ec.message().c_str());
+                        }
+                        connection->close();
+                        return;
+                    }
+
+                    if (connection->commitReceive(n)) {
+                        self->doRead(std::move(connection));
+                    }
+                }));
+    }
+
+    void SessionSocket::doWrite()
+    {
+        mWriteBuffers.clear();
+        for (auto const & packet : mSendQueue) {
+            mWriteBuffers.emplace_back(boost::asio::buffer(packet));
+        }
+        mWritingCount = mSendQueue.size();
+
+        auto onWritten = [self = shared_from_this()](boost::system::error_code const & ec, std::size_t /*n*/) {
+            if (ec) {
+                if (ec != boost::asio::error::operation_aborted) {
+                    LOG_ERROR("Unable to send packet");
+                }
+                self->doClose();
+                return;
+            }
+
+            self->mSendQueue.erase(self->mSendQueue.begin(), self->mSendQueue.begin() + self->mWritingCount);
+            self->mWritingCount = 0;
+
+            if (!self->mSendQueue.empty()) {
+                self->doWrite();
+            }
+        };
+
+        boost::asio::async_write(mSocket, mWriteBuffers, boost::asio::bind_executor(mStrand, std::move(onWritten)));
+    }
+
+    void SessionSocket::doClose()
+    {
+        if (mClosed.exchange(true)) {
+            return;
+        }
+
+        boost::system::error_code ignored {};
+        mSocket.shutdown(socket_type::shutdown_both, ignored);
+        mSocket.close(ignored);
+    }
+}
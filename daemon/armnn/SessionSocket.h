@@ -0,0 +1,71 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include "armnn/ISender.h"
+#include "armnn/SessionConnection.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context_strand.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+namespace armnn {
+    /**
+     * An accepted unix domain socket connection from an ArmNN process.
+     *
+     * The received data is read directly into the SessionConnection's receive buffer. Sent packets are queued on the
+     * connection's strand and all of the queued packets are written with a single (gathering) write, so no thread is
+     * needed for either direction.
+     */
+    class SessionSocket : public std::enable_shared_from_this<SessionSocket> {
+    public:
+        using socket_type = boost::asio::local::stream_protocol::socket;
+
+        SessionSocket(boost::asio::io_context::strand strand, socket_type socket);
+
+        // No copying
+        SessionSocket(const SessionSocket &) = delete;
+        SessionSocket & operator=(const SessionSocket &) = delete;
+
+        // No moving
+        SessionSocket(SessionSocket && that) = delete;
+        SessionSocket & operator=(SessionSocket && that) = delete;
+
+        ~SessionSocket() noexcept = default;
+
+        /** @return An ISender that sends via the socket */
+        [[nodiscard]] static std::unique_ptr<ISender> createSender(std::shared_ptr<SessionSocket> socket);
+
+        /** Start reading from the socket into the connection, until either end closes it */
+        void start(std::shared_ptr<SessionConnection> connection);
+
+        /**
+         * Queue a packet to send. May be called from any thread.
+         * @return false if the socket is closed
+         */
+        bool send(std::vector<std::uint8_t> && data);
+
+        /** Close the socket. May be called from any thread. */
+        void close();
+
+    private:
+        boost::asio::io_context::strand mStrand;
+        socket_type mSocket;
+        std::atomic_bool mClosed {false};
+        /// Packets queued to send; the first mWritingCount of them are being written
+        std::deque<std::vector<std::uint8_t>> mSendQueue {};
+        std::vector<boost::asio::const_buffer> mWriteBuffers {};
+        std::size_t mWritingCount {0};
+
+        void doRead(std::shared_ptr<SessionConnection> connection);
+        void doWrite();
+        void doClose();
+    };
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2019-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 
 #include "armnn/SessionStateTracker.h"
 
@@ -181,24 +181,30 @@ namespace armnn {
     }
 
     bool SessionStateTracker::onPeriodicCounterCapture(std::uint64_t timestamp,
-                                                       std::map<std::uint16_t, std::uint32_t> counterIndexValues)
+                                                       lib::Span<const CounterIndexValue> counterIndexValues)
     {
         std::lock_guard<std::mutex> lock {mutex};
+
+        capturedCounterValues.clear();
         for (const auto & uidAndValue : counterIndexValues) {
-            auto match = requestedEventUIDs.find(uidAndValue.first);
+            auto match = requestedEventUIDs.find(uidAndValue.index);
             if (match != requestedEventUIDs.end()) {
-                if (!counterConsumer.consumeCounterValue(timestamp, match->second, uidAndValue.second)) {
-                    return false;
-                }
+                capturedCounterValues.push_back({match->second, uidAndValue.value});
             }
         }
-        return true;
+
+        if (capturedCounterValues.empty()) {
+            return true;
+        }
+
+        // hand over the whole sample at once, rather than one value at a time
+        return counterConsumer.consumeCounterValues(timestamp, capturedCounterValues);
     }
 
     bool SessionStateTracker::onPerJobCounterCapture(bool /* isPre */,
                                                      std::uint64_t timestamp,
                                                      std::uint64_t /* objectRef */,
-                                                     std::map<std::uint16_t, std::uint32_t> counterIndexValues)
+                                                     lib::Span<const CounterIndexValue> counterIndexValues)
     {
         // ignore the job information for now
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2019-2021 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 
 #ifndef INCLUDE_ARMNN_SESSION_STATE_TRACKER_H
 #define INCLUDE_ARMNN_SESSION_STATE_TRACKER_H
@@ -9,6 +9,7 @@
 #include "armnn/IPacketConsumer.h"
 #include "armnn/IPeriodicCounterSelectionConsumer.h"
 #include "armnn/ISessionPacketSender.h"
+#include "lib/Span.h"
 
 #include <map>
 #include <mutex>
@@ -40,12 +41,12 @@ namespace armnn {
         bool onPerJobCounterSelection(std::uint64_t objectId, std::set<std::uint16_t> uids) override;
         // see IPeriodicCounterCaptureConsumer
         bool onPeriodicCounterCapture(std::uint64_t timestamp,
-                                      std::map<std::uint16_t, std::uint32_t> counterIndexValues) override;
+                                      lib::Span<const CounterIndexValue> counterIndexValues) override;
         // see IPerJobCounterCaptureConsumer
         bool onPerJobCounterCapture(bool isPre,
                                     std::uint64_t timestamp,
                                     std::uint64_t objectRef,
-                                    std::map<std::uint16_t, std::uint32_t> counterIndexValues) override;
+                                    lib::Span<const CounterIndexValue> counterIndexValues) override;
 
         /**
          * Consumes a raw packet sent from target
@@ -114,6 +115,9 @@ namespace armnn {
         // active event UIDs
         std::set<std::uint16_t> activeEventUIDs {};
 
+        // the requested values from the last counter capture packet, reused so that each packet does not allocate
+        std::vector<ApcCounterValue> capturedCounterValues {};
+
         // the current session
         const std::uint32_t sessionID;
 
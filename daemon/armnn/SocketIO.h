@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2020-2023 by Arm Limited. All rights reserved.
+ * Copyright (C) 2020-2025 by Arm Limited. All rights reserved.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License version 2 as
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 struct sockaddr;
@@ -72,6 +73,11 @@ namespace armnn {
          */
         [[nodiscard]] bool isOpen() const override { return !!fd; }
 
+        /**
+         * Release ownership of the socket, for example to hand it to an asio acceptor
+         */
+        [[nodiscard]] AutoClosingFd releaseFd() { return std::move(fd); }
+
         /**
          * Write exactly the number of bytes contained in the Span.
          * @param buffer The data to write to the socket.
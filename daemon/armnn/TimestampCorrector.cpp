@@ -1,4 +1,4 @@
-/* Copyright (C) 2020-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #include "armnn/TimestampCorrector.h"
 
@@ -32,6 +32,31 @@ namespace armnn {
         // The value was successfully consumed but has been dropped because the timestamp was too early
         return true;
     }
+
+    bool TimestampCorrector::consumeCounterValues(std::uint64_t timestamp,
+                                                  lib::Span<const ApcCounterValue> counterValues)
+    {
+        // Only pass on the counter values if they are from after monotonic start
+        if (timestamp < monotonicStarted) {
+            return true;
+        }
+
+        if (!counterConsumer) {
+            // begin a new block counter frame
+            counterConsumer = mFrameBuilderFactory.createBlockCounterFrame();
+        }
+
+        const std::uint64_t correctedTimestamp = timestamp - monotonicStarted;
+        for (auto const & counterValue : counterValues) {
+            if (!counterConsumer->counterMessage(correctedTimestamp,
+                                                 counterValue.keyAndCore.core,
+                                                 counterValue.keyAndCore.key,
+                                                 counterValue.value)) {
+                return false;
+            }
+        }
+        return true;
+    }
     bool TimestampCorrector::consumePacket(std::uint32_t sessionId, lib::Span<const std::uint8_t> data)
     {
         // finish any in progess frame before starting a new one
@@ -1,4 +1,4 @@
-/* Copyright (C) 2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2020-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -23,6 +23,8 @@ namespace armnn {
                                  ApcCounterKeyAndCoreNumber keyAndCore,
                                  std::uint32_t counterValue) override;
 
+        bool consumeCounterValues(std::uint64_t timestamp, lib::Span<const ApcCounterValue> counterValues) override;
+
         bool consumePacket(std::uint32_t sessionId, lib::Span<const std::uint8_t> data) override;
 
     private:
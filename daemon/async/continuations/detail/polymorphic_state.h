@@ -1,8 +1,9 @@
-/* Copyright (C) 2022 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
 #include "async/continuations/detail/initiation_chain.h"
+#include "async/continuations/detail/recycling_allocator.h"
 #include "async/continuations/detail/state_chain.h"
 #include "async/continuations/detail/trace.h"
 #include "lib/source_location.h"
@@ -103,7 +104,7 @@ namespace async::continuations::detail {
 
     /** Base type for wrapper around some NextInitiator that type erases it */
     template<typename... InputArgs>
-    class polymorphic_next_initiator_base_t {
+    class polymorphic_next_initiator_base_t : public recycled_allocation_t {
     public:
         virtual ~polymorphic_next_initiator_base_t() noexcept = default;
 
@@ -174,7 +175,7 @@ namespace async::continuations::detail {
 
     /** Base type for polymorphic state type */
     template<typename... OutputArgs>
-    class polymorphic_state_base_t {
+    class polymorphic_state_base_t : public recycled_allocation_t {
     public:
         virtual ~polymorphic_state_base_t() noexcept = default;
 
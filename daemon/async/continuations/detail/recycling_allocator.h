@@ -0,0 +1,121 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+namespace async::continuations::detail {
+    /**
+     * A per-thread cache of recently freed blocks, bucketed by size, used for the type erased continuation state.
+     *
+     * Each step of a polymorphic continuation chain allocates its state when it is created and frees it when it is
+     * initiated, so in a steady state (such as a loop) the same few block sizes are allocated and freed repeatedly on
+     * the same thread. Recycling them avoids going back to the heap each time.
+     *
+     * Blocks may be freed on a different thread to that which allocated them, in which case they are simply cached
+     * by the freeing thread instead.
+     */
+    class recycling_allocator_t {
+    public:
+        static constexpr std::size_t block_granule = 64;
+        static constexpr std::size_t max_recycled_size = 512;
+        static constexpr std::size_t max_cached_blocks = 16;
+
+        [[nodiscard]] static void * allocate(std::size_t size)
+        {
+            const auto index = bucket_index(size);
+            if (index < n_buckets) {
+                auto * cache = thread_cache();
+                if (cache != nullptr) {
+                    auto & bucket = cache->buckets[index];
+                    if (bucket.count > 0) {
+                        return bucket.blocks[--bucket.count];
+                    }
+                }
+                // always allocate the full bucket size so that the block can be reused for any size in the bucket
+                return ::operator new((index + 1) * block_granule);
+            }
+            return ::operator new(size);
+        }
+
+        static void deallocate(void * block, std::size_t size) noexcept
+        {
+            const auto index = bucket_index(size);
+            if (index < n_buckets) {
+                auto * cache = thread_cache();
+                if (cache != nullptr) {
+                    auto & bucket = cache->buckets[index];
+                    if (bucket.count < max_cached_blocks) {
+                        bucket.blocks[bucket.count++] = block;
+                        return;
+                    }
+                }
+            }
+            ::operator delete(block);
+        }
+
+    private:
+        static constexpr std::size_t n_buckets = max_recycled_size / block_granule;
+
+        struct bucket_t {
+            std::array<void *, max_cached_blocks> blocks {};
+            std::size_t count = 0;
+        };
+
+        struct thread_cache_t {
+            std::array<bucket_t, n_buckets> buckets {};
+
+            thread_cache_t() noexcept { thread_cache_state() = state_t::alive; }
+
+            // Intentionally unimplemented
+            thread_cache_t(thread_cache_t const &) = delete;
+            thread_cache_t & operator=(thread_cache_t const &) = delete;
+            thread_cache_t(thread_cache_t &&) = delete;
+            thread_cache_t & operator=(thread_cache_t &&) = delete;
+
+            ~thread_cache_t() noexcept
+            {
+                thread_cache_state() = state_t::destroyed;
+                for (auto & bucket : buckets) {
+                    for (std::size_t n = 0; n < bucket.count; ++n) {
+                        ::operator delete(bucket.blocks[n]);
+                    }
+                }
+            }
+        };
+
+        enum class state_t { unused, alive, destroyed };
+
+        static constexpr std::size_t bucket_index(std::size_t size) { return (size - 1) / block_granule; }
+
+        /** Tracks the lifetime of the thread cache, so that blocks freed during thread exit bypass it */
+        static state_t & thread_cache_state() noexcept
+        {
+            static thread_local state_t state = state_t::unused;
+            return state;
+        }
+
+        /** @return the cache for the calling thread, or nullptr if it was already destroyed */
+        static thread_cache_t * thread_cache() noexcept
+        {
+            if (thread_cache_state() == state_t::destroyed) {
+                return nullptr;
+            }
+            static thread_local thread_cache_t cache {};
+            return &cache;
+        }
+    };
+
+    /** Base class for continuation state types, makes them allocate from the recycling_allocator_t */
+    class recycled_allocation_t {
+    public:
+        [[nodiscard]] static void * operator new(std::size_t size) { return recycling_allocator_t::allocate(size); }
+
+        static void operator delete(void * block, std::size_t size) noexcept
+        {
+            recycling_allocator_t::deallocate(block, size);
+        }
+    };
+}
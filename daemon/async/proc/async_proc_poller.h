@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -9,96 +9,115 @@
 #include "async/continuations/use_continuation.h"
 #include "lib/FsEntry.h"
 #include "lib/Utils.h"
+#include "linux/proc/PidDirectoryReader.h"
+#include "linux/proc/ProcPidStatFileRecord.h"
+#include "linux/proc/ProcPidStatmFileRecord.h"
 #include "linux/proc/ProcessPollerBase.h"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/mp11/algorithm.hpp>
 #include <boost/mp11/bind.hpp>
 #include <boost/mp11/tuple.hpp>
 #include <boost/system/error_code.hpp>
 
+#include <fcntl.h>
+
 namespace async {
 
     namespace detail {
         /**
-         * Checks the name of the FsEntry to see if it is a number, and checks the type
-         * to see if it is a directory.
+         * Helper for asynchronously visiting the PID (or TID) subdirectories of some directory.
          *
-         * @return True if criteria are met, false otherwise
-         */
-        inline bool is_pid_directory(const lib::FsEntry & entry)
-        {
-            return lnx::isPidDirectory(entry);
-        }
-
-        /** @return The process exe path (or some estimation of it). Empty if the thread is a kernel thread, otherwise
-         * contains 'something'
+         * The ids are visited a batch at a time, with a single hop onto the executor per batch rather than per id.
          */
-        inline std::optional<std::string> get_process_exe_path(const lib::FsEntry & entry)
-        {
-            return lnx::getProcessExePath(entry);
-        }
-
-        /** Helper for iterating some directory asynchronously */
         template<typename Executor, typename Op>
-        class async_dir_iterator_t : public std::enable_shared_from_this<async_dir_iterator_t<Executor, Op>> {
+        class async_pid_dir_iterator_t
+            : public std::enable_shared_from_this<async_pid_dir_iterator_t<Executor, Op>> {
         public:
-            async_dir_iterator_t(Executor const & executor, lib::FsEntry const & dir, Op && op)
-                : executor(executor), dir(dir), iterator(dir.children()), op(std::forward<Op>(op))
+            async_pid_dir_iterator_t(Executor const & executor, int dir_fd, char const * path, Op && op)
+                : executor(executor), reader(dir_fd, path), op(std::forward<Op>(op))
             {
             }
 
+            [[nodiscard]] bool is_open() const { return reader.isOpen(); }
+
             [[nodiscard]] async::continuations::polymorphic_continuation_t<boost::system::error_code> async_run()
             {
                 using namespace async::continuations;
 
-                LOG_TRACE("SCAN DIR: %s", dir.path().c_str());
-
                 auto self = this->shared_from_this();
 
-                return start_with(iterator.next(), boost::system::error_code {}) //
+                return start_with(boost::system::error_code {}) //
                      | loop(
-                           // iterate while no error and has another value
-                           [self](std::optional<lib::FsEntry> entry, boost::system::error_code const & ec) {
-                               auto const valid = entry.has_value() && !ec;
-                               LOG_TRACE("LOOP DIR: '%s' = '%s' == %d",
-                                         self->dir.path().c_str(),
-                                         (entry ? entry->path().c_str() : ""),
-                                         valid);
-                               return start_with(valid, std::move(entry), ec);
+                           // iterate while no error and there is another batch
+                           [self](boost::system::error_code const & ec) {
+                               auto const valid = (!ec) && self->reader.readBatch(self->batch);
+                               LOG_TRACE("LOOP DIR: fd=%d, batch=%zu", self->reader.dirFd(), self->batch.size());
+                               return start_with(valid, ec);
                            },
-                           [self](std::optional<lib::FsEntry> entry, boost::system::error_code const & /*ec*/) {
-                               LOG_TRACE("EXEC DIR: '%s' = '%s'", self->dir.path().c_str(), entry->path().c_str());
-                               return start_on(self->executor)    //
-                                    | self->op(std::move(*entry)) //
-                                    | post_on(self->executor)     //
-                                    | then([self](boost::system::error_code const & ec) {
-                                          LOG_TRACE("... ec=%s", ec.message().c_str());
-                                          return start_with(self->iterator.next(), ec);
-                                      });
+                           [self](boost::system::error_code const & /*ec*/) {
+                               return start_on(self->executor) //
+                                    | self->visit_batch()      //
+                                    | post_on(self->executor);
                            }) //
-                     | then(
-                           [self](std::optional<lib::FsEntry> const & /*entry*/, boost::system::error_code const & ec) {
-                               LOG_TRACE("FINISHED DIR: '%s' = %s", self->dir.path().c_str(), ec.message().c_str());
-                               return ec;
-                           });
+                     | then([self](boost::system::error_code const & ec) {
+                           LOG_TRACE("FINISHED DIR: fd=%d = %s", self->reader.dirFd(), ec.message().c_str());
+                           return ec;
+                       });
             }
 
         private:
             Executor executor;
-            lib::FsEntry dir;
-            lib::FsEntryDirectoryIterator iterator;
+            lnx::PidDirectoryReader reader;
+            std::vector<int> batch {};
             Op op;
+
+            /** Visit each id in the current batch in turn, stopping at the first error */
+            [[nodiscard]] async::continuations::polymorphic_continuation_t<boost::system::error_code> visit_batch()
+            {
+                using namespace async::continuations;
+
+                auto self = this->shared_from_this();
+
+                return start_with(std::size_t {0}, boost::system::error_code {}) //
+                     | loop(
+                           [self](std::size_t index, boost::system::error_code const & ec) {
+                               auto const valid = (!ec) && (index < self->batch.size());
+                               return start_with(valid, index, ec);
+                           },
+                           [self](std::size_t index, boost::system::error_code const & /*ec*/) {
+                               return self->op(self->reader.dirFd(), self->batch[index]) //
+                                    | then([index](boost::system::error_code const & ec) {
+                                          return start_with(index + 1, ec);
+                                      });
+                           }) //
+                     | then([](std::size_t /*index*/, boost::system::error_code const & ec) { return ec; });
+            }
         };
 
         template<typename Executor, typename Op>
-        auto make_async_dir_iterator(Executor && executor, lib::FsEntry const & dir, Op && op)
+        auto make_async_pid_dir_iterator(Executor && executor, int dir_fd, char const * path, Op && op)
         {
-            return std::make_shared<async_dir_iterator_t<Executor, Op>>(std::forward<Executor>(executor),
-                                                                        dir,
-                                                                        std::forward<Op>(op));
+            return std::make_shared<async_pid_dir_iterator_t<std::decay_t<Executor>, Op>>(
+                std::forward<Executor>(executor),
+                dir_fd,
+                path,
+                std::forward<Op>(op));
         }
+
+        /** The stat and statm records for a thread, read ahead of the callbacks that receive them */
+        struct thread_stats_t {
+            bool valid = false;
+            lnx::ProcPidStatFileRecord stat_record {};
+            std::optional<lnx::ProcPidStatmFileRecord> statm_record {};
+        };
     }
 
     /**
@@ -195,13 +214,15 @@ namespace async {
             return async_initiate_cont<continuation_of_t<boost::system::error_code>>(
                 [self = this->shared_from_this(),
                  callbacks = std::make_shared<callbacks_t>(std::move(callbacks_wrapper))]() mutable {
-                    auto iterator = async::detail::make_async_dir_iterator(
+                    auto iterator = async::detail::make_async_pid_dir_iterator(
                         self->executor,
-                        self->procDir,
-                        [self, callbacks](lib::FsEntry entry) {
+                        AT_FDCWD,
+                        self->procDir.path().c_str(),
+                        [self, callbacks](int proc_dir_fd, int pid) {
                             return async_proc_poller_t::template process_pid_directory<want_threads, want_stats>(
                                 self,
-                                std::move(entry),
+                                proc_dir_fd,
+                                pid,
                                 callbacks);
                         });
 
@@ -220,65 +241,73 @@ namespace async {
 
         template<bool WantThreads, bool WantStats>
         static error_code_continuation_t process_pid_directory(std::shared_ptr<async_proc_poller_t> self,
-                                                               lib::FsEntry entry,
+                                                               int proc_dir_fd,
+                                                               int pid,
                                                                std::shared_ptr<callbacks_t> callbacks)
         {
             using namespace async::continuations;
 
-            // ignore non-pid directories
-            if (!async::detail::is_pid_directory(entry)) {
+            auto name = std::to_string(pid);
+
+            // the process may have exited since /proc was read
+            auto const pid_dir_fd = lnx::openDirectoryAt(proc_dir_fd, name.c_str());
+            if (!pid_dir_fd) {
                 return start_with(boost::system::error_code {});
             }
 
-            auto name = entry.name();
-            auto exe_path = async::detail::get_process_exe_path(entry);
-            // read the pid
-            auto pid = std::strtol(name.c_str(), nullptr, 0);
+            auto entry = lib::FsEntry::create(self->procDir, name);
+            auto exe_path = lnx::getProcessExePath(*pid_dir_fd, entry);
 
             // process threads?
             if constexpr (WantThreads || WantStats) {
+                // the /proc/[PID]/task directory
+                auto task_path = entry.path() + "/task/";
+                auto task_iterator = async::detail::make_async_pid_dir_iterator(
+                    self->executor,
+                    *pid_dir_fd,
+                    "task",
+                    [self, task_path, exe_path, callbacks, pid](int task_dir_fd, int tid) {
+                        auto task_entry = lib::FsEntry::create(task_path + std::to_string(tid));
+                        auto stats = read_thread_stats<WantStats>(self, task_dir_fd, tid);
+                        return process_tid_directory<WantStats>(pid,
+                                                                tid,
+                                                                std::move(task_entry),
+                                                                std::move(stats),
+                                                                exe_path,
+                                                                callbacks);
+                    });
+
+                // if for some reason the task directory does not exist, then use stat and statm in the procPid directory
+                // instead; these are read now, as proc_dir_fd is only valid for the duration of this call
+                auto const use_pid_directory = !task_iterator->is_open();
+                auto pid_stats = (use_pid_directory ? read_thread_stats<WantStats>(self, proc_dir_fd, pid)
+                                                    : async::detail::thread_stats_t {});
+
                 // call the receiver object
                 return callbacks->on_process_directory(pid, entry)
                      // then process the threads
                      | then([entry = std::move(entry),
-                             name = std::move(name),
                              exe_path = std::move(exe_path),
                              pid,
-                             self = std::move(self),
+                             use_pid_directory,
+                             pid_stats = std::move(pid_stats),
+                             task_iterator = std::move(task_iterator),
                              callbacks](boost::system::error_code const & ec) mutable -> error_code_continuation_t {
                            // forward error?
                            if (ec) {
                                return start_with(ec);
                            }
 
-                           // the /proc/[PID]/task directory
-                           const auto task_directory = lib::FsEntry::create(entry, "task");
-
-                           // the /proc/[PID]/task/[PID]/ directory
-                           const auto task_pid_directory = lib::FsEntry::create(task_directory, name);
-                           const auto task_pid_directory_stats = task_pid_directory.read_stats();
-
-                           // if for some reason taskPidDirectory does not exist, then use stat and statm in the procPid directory instead
-                           if ((!task_pid_directory_stats.exists())
-                               || (task_pid_directory_stats.type() != lib::FsEntry::Type::DIR)) {
+                           if (use_pid_directory) {
                                return process_tid_directory<WantStats>(pid,
+                                                                       pid,
                                                                        std::move(entry),
+                                                                       std::move(pid_stats),
                                                                        std::move(exe_path),
                                                                        std::move(callbacks));
                            }
 
                            // scan all the TIDs in the task directory
-                           auto task_iterator = async::detail::make_async_dir_iterator(
-                               self->executor,
-                               task_directory,
-                               [exe_path, callbacks, pid](lib::FsEntry entry) {
-                                   return async_proc_poller_t::template process_tid_directory<WantStats>(
-                                       pid,
-                                       std::move(entry),
-                                       exe_path,
-                                       callbacks);
-                               });
-
                            return task_iterator->async_run();
                        });
             }
@@ -288,65 +317,55 @@ namespace async {
             }
         }
 
+        template<bool WantStats>
+        static async::detail::thread_stats_t read_thread_stats(std::shared_ptr<async_proc_poller_t> const & self,
+                                                               int dir_fd,
+                                                               int tid)
+        {
+            async::detail::thread_stats_t result {};
+
+            if constexpr (WantStats) {
+                result.valid = lnx::readThreadStatFiles(dir_fd,
+                                                        tid,
+                                                        self->file_buffer,
+                                                        result.stat_record,
+                                                        result.statm_record);
+            }
+
+            return result;
+        }
+
         template<bool WantStats>
         static error_code_continuation_t process_tid_directory(int pid,
+                                                               int tid,
                                                                lib::FsEntry entry,
+                                                               async::detail::thread_stats_t stats,
                                                                std::optional<std::string> exe,
                                                                std::shared_ptr<callbacks_t> callbacks)
         {
             using namespace async::continuations;
 
-            const long tid = std::strtol(entry.name().c_str(), nullptr, 0);
-
             // process stats?
             if constexpr (WantStats) {
                 // call the receiver object
                 return callbacks->on_thread_directory(pid, tid, entry)
                      // then call the stats handler
-                     | then([entry, callbacks, pid, tid, exe = std::move(exe)](
+                     | then([callbacks, pid, tid, stats = std::move(stats), exe = std::move(exe)](
                                 boost::system::error_code const & ec) mutable -> error_code_continuation_t {
                            // forward error?
                            if (ec) {
                                return start_with(ec);
                            }
 
-                           std::optional<lnx::ProcPidStatmFileRecord> statm_file_record {lnx::ProcPidStatmFileRecord()};
-
-                           // open /proc/[PID]/statm
-                           {
-                               const lib::FsEntry statm_file = lib::FsEntry::create(entry, "statm");
-                               const lib::FsEntry::Stats statm_file_stats = statm_file.read_stats();
-
-                               if (statm_file_stats.exists() && statm_file_stats.type() == lib::FsEntry::Type::FILE) {
-                                   const std::string statm_file_contents = lib::readFileContents(statm_file);
-
-                                   if (!lnx::ProcPidStatmFileRecord::parseStatmFile(*statm_file_record,
-                                                                                    statm_file_contents.c_str())) {
-                                       statm_file_record.reset();
-                                   }
-                               }
-                           }
-
-                           // open /proc/[PID]/stat
-                           {
-                               const lib::FsEntry stat_file = lib::FsEntry::create(entry, "stat");
-                               const lib::FsEntry::Stats stat_file_stats = stat_file.read_stats();
-
-                               if (stat_file_stats.exists() && stat_file_stats.type() == lib::FsEntry::Type::FILE) {
-                                   const std::string stat_file_contents = lib::readFileContents(stat_file);
-                                   lnx::ProcPidStatFileRecord stat_file_record;
-                                   if (lnx::ProcPidStatFileRecord::parseStatFile(stat_file_record,
-                                                                                 stat_file_contents.c_str())) {
-                                       return callbacks->on_thread_details(pid,
-                                                                           tid,
-                                                                           stat_file_record,
-                                                                           statm_file_record,
-                                                                           exe);
-                                   }
-                               }
+                           if (!stats.valid) {
+                               return start_with(boost::system::error_code {});
                            }
 
-                           return start_with(boost::system::error_code {});
+                           return callbacks->on_thread_details(pid,
+                                                               tid,
+                                                               stats.stat_record,
+                                                               stats.statm_record,
+                                                               exe);
                        });
             }
             else {
@@ -357,6 +376,8 @@ namespace async {
 
         Executor executor;
         lib::FsEntry procDir;
+        // reused to read each of the stat and statm files
+        std::string file_buffer {};
     };
 
     template<typename Executor, std::enable_if_t<is_asio_executor_v<Executor>, bool> = false>
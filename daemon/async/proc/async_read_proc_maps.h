@@ -1,4 +1,4 @@
-/* Copyright (C) 2022-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2022-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -9,6 +9,8 @@
 #include "async/proc/async_proc_poller.h"
 
 #include <memory>
+#include <string>
+#include <utility>
 
 #include <boost/asio/error.hpp>
 #include <boost/system/error_code.hpp>
@@ -50,18 +52,15 @@ namespace async {
                                               // missing or inaccessible file is not an error
                                               const lib::FsEntry mapsFile = lib::FsEntry::create(entry, "maps");
 
-                                              if (!mapsFile.exists()) {
-                                                  return start_with(boost::system::error_code {});
-                                              }
-
-                                              if (!mapsFile.canAccess(true, false, false)) {
+                                              std::string contents {};
+                                              if (!mapsFile.readFileInto(contents)) {
                                                   return start_with(boost::system::error_code {});
                                               }
 
                                               // send the contents
                                               return sender->async_send_maps_frame(pid,
                                                                                    pid,
-                                                                                   lib::readFileContents(mapsFile),
+                                                                                   std::move(contents),
                                                                                    use_continuation);
                                           });
             },
@@ -1,4 +1,4 @@
-/* Copyright (C) 2021-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2021-2025 by Arm Limited. All rights reserved. */
 
 /**
  * Encode/Decode related functions for preparing IPC messages for transmit/receive.
@@ -222,6 +222,60 @@ namespace ipc {
     struct blob_codec_t<lib::Span<T const>, U, std::enable_if_t<std::is_integral_v<T>>>
         : byte_span_blob_codec_t<lib::Span<T const>, U> {};
 
+    /** Specialization for gathered byte spans; these are send only so there is no read support */
+    template<std::size_t N, typename U>
+    struct blob_codec_t<gathered_byte_spans_t<N>, U> {
+        /** The blob type */
+        using value_type = gathered_byte_spans_t<N>;
+
+        /** The scatter-gather helper object which stores the length and buffers so that the length field may be scatter-gathered */
+        struct sg_write_helper_type {
+            std::size_t length = 0;
+            std::array<boost::asio::const_buffer, N + 1> buffers {};
+        };
+
+        /** The scatter-gather helper object used for reading the suffix */
+        struct sg_read_helper_type {};
+
+        /** The number of buffers required to perform a scatter gather based write of the length + prefix + spans */
+        static constexpr std::size_t sg_writer_buffers_count = N + 2;
+
+        /** The size of the length field */
+        static constexpr std::size_t length_size = sizeof(U);
+
+        /** Fill the sg_write_helper_type value */
+        static constexpr sg_write_helper_type fill_sg_write_helper_type(value_type const & value)
+        {
+            sg_write_helper_type helper {};
+
+            helper.buffers[0] = {value.prefix.data(), value.prefix.size()};
+            helper.length = value.prefix.size();
+
+            for (std::size_t n = 0; n < N; ++n) {
+                helper.buffers[n + 1] = {value.spans[n].data(), value.spans[n].size()};
+                helper.length += value.spans[n].size();
+            }
+
+            return helper;
+        }
+
+        /** The total size required to store the encoded suffix buffer + length field */
+        static constexpr std::size_t suffix_write_size(sg_write_helper_type const & helper)
+        {
+            return length_size + helper.length;
+        }
+
+        /** Fill a scatter-gather buffer list for writing out the header */
+        static constexpr void fill_sg_buffer(lib::Span<boost::asio::const_buffer> sg_list,
+                                             sg_write_helper_type const & helper)
+        {
+            sg_list[0] = {reinterpret_cast<char const *>(&helper.length), length_size};
+            for (std::size_t n = 0; n < (N + 1); ++n) {
+                sg_list[n + 1] = helper.buffers[n];
+            }
+        }
+    };
+
     /** Specialization for protobuf messages */
     template<typename T, typename U>
     struct blob_codec_t<T, U, std::enable_if_t<is_protobuf_message_v<T>>> {
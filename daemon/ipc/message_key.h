@@ -30,11 +30,14 @@ namespace ipc {
         perfetto_recv_bytes,
         perfetto_send_bytes,
         perfetto_close_conn,
+        perfetto_configuration,
+        perfetto_stats,
 
         // perf
         perf_capture_configuration,
         capture_ready,
         apc_frame_data,
+        apc_frame_data_list,
         exec_target_app,
         cpu_state_change,
         capture_failed,
@@ -1,4 +1,4 @@
-/* Copyright (C) 2021-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2021-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -26,6 +26,18 @@ namespace ipc {
         || std::is_enum_v<T>                                      //
         || (std::is_array_v<T> && is_valid_message_header_v<std::remove_all_extents_t<T>>);
 
+    /**
+     * A send only blob formed from a small owned prefix followed by some externally owned spans, which are gathered
+     * directly into the IPC channel rather than first being copied into one contiguous buffer.
+     *
+     * The spans must remain valid until the send completes.
+     */
+    template<std::size_t N>
+    struct gathered_byte_spans_t {
+        std::vector<uint8_t> prefix;
+        std::array<lib::Span<uint8_t const>, N> spans;
+    };
+
     /** True if @a T is a Protobuf message. */
     template<typename T>
     constexpr bool is_protobuf_message_v = std::is_base_of_v<google::protobuf::MessageLite, T>;
@@ -9,6 +9,7 @@
 #include "message_key.h"
 #include "monotonic_pair.h"
 
+#include <cstdint>
 #include <string_view>
 #include <variant>
 
@@ -39,6 +40,37 @@ namespace ipc {
         wait_for_cores_ready_failed,
     };
 
+    /** The perfetto trace settings; a value of zero means use the agent's default */
+    struct perfetto_configuration_t {
+        std::uint32_t buffer_size_kb;
+        std::uint32_t flush_period_ms;
+        std::uint32_t file_write_period_ms;
+
+        friend constexpr bool operator==(perfetto_configuration_t const & a, perfetto_configuration_t const & b)
+        {
+            return (a.buffer_size_kb == b.buffer_size_kb) && (a.flush_period_ms == b.flush_period_ms)
+                && (a.file_write_period_ms == b.file_write_period_ms);
+        }
+
+        friend constexpr bool operator!=(perfetto_configuration_t const & a, perfetto_configuration_t const & b)
+        {
+            return !(a == b);
+        }
+    };
+
+    /** The perfetto trace buffer statistics */
+    struct perfetto_stats_t {
+        /** The total number of chunks lost because the trace buffer was full */
+        std::uint64_t overruns;
+
+        friend constexpr bool operator==(perfetto_stats_t const & a, perfetto_stats_t const & b)
+        {
+            return (a.overruns == b.overruns);
+        }
+
+        friend constexpr bool operator!=(perfetto_stats_t const & a, perfetto_stats_t const & b) { return !(a == b); }
+    };
+
     /**
      * Helper template that associates a type name with a type so that it can be used at
      * runtime - e.g. to aid troubleshooting with log messages.
@@ -120,6 +152,15 @@ namespace ipc {
     using msg_perfetto_recv_bytes_t = message_t<message_key_t::perfetto_recv_bytes, void, std::vector<uint8_t>>;
     DEFINE_NAMED_MESSAGE(msg_perfetto_recv_bytes_t);
 
+    /** Sent from shell to perfetto agent to configure the trace, before the trace is started */
+    using msg_perfetto_configuration_t =
+        message_t<message_key_t::perfetto_configuration, perfetto_configuration_t, void>;
+    DEFINE_NAMED_MESSAGE(msg_perfetto_configuration_t);
+
+    /** Sent from perfetto agent to shell to report the trace buffer statistics */
+    using msg_perfetto_stats_t = message_t<message_key_t::perfetto_stats, perfetto_stats_t, void>;
+    DEFINE_NAMED_MESSAGE(msg_perfetto_stats_t);
+
     /** Sent by the shell to configure the perf capture */
     using msg_capture_configuration_t =
         message_t<message_key_t::perf_capture_configuration, void, proto::shell::perf::capture_configuration_t>;
@@ -144,6 +185,19 @@ namespace ipc {
     using msg_apc_frame_data_from_span_t = message_t<message_key_t::apc_frame_data, void, lib::Span<uint8_t const>>;
     DEFINE_NAMED_MESSAGE(msg_apc_frame_data_from_span_t);
 
+    // R/O send only object for an apc frame whose body is in up to two externally owned spans (e.g. the perf aux
+    // ringbuffer, which may wrap), so that the body is written to the channel without being copied first
+    using msg_apc_frame_data_from_spans_t = message_t<message_key_t::apc_frame_data, void, gathered_byte_spans_t<2>>;
+    DEFINE_NAMED_MESSAGE(msg_apc_frame_data_from_spans_t);
+
+    /**
+     * A list of raw APC frames sent by the perf agent, so that several small frames can be sent in one message.
+     *
+     * Each frame is prefixed with its length as a little endian uint32, and is otherwise as for msg_apc_frame_data_t.
+     */
+    using msg_apc_frame_data_list_t = message_t<message_key_t::apc_frame_data_list, void, std::vector<uint8_t>>;
+    DEFINE_NAMED_MESSAGE(msg_apc_frame_data_list_t);
+
     /** Sent by the perf agent to the shell once it is ready to capture the newly exec-d process */
     using msg_exec_target_app_t = message_t<message_key_t::exec_target_app, void, void>;
     DEFINE_NAMED_MESSAGE(msg_exec_target_app_t);
@@ -185,9 +239,12 @@ namespace ipc {
                                                      msg_perfetto_new_conn_t,
                                                      msg_perfetto_close_conn_t,
                                                      msg_perfetto_recv_bytes_t,
+                                                     msg_perfetto_configuration_t,
+                                                     msg_perfetto_stats_t,
                                                      msg_capture_configuration_t,
                                                      msg_capture_ready_t,
                                                      msg_apc_frame_data_t,
+                                                     msg_apc_frame_data_list_t,
                                                      msg_exec_target_app_t,
                                                      msg_cpu_state_change_t,
                                                      msg_capture_failed_t,
@@ -1,4 +1,4 @@
-/* Copyright (C) 2021-2022 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2021-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -11,10 +11,19 @@
 #include "ipc/responses.h"
 #include "lib/Assert.h"
 #include "lib/AutoClosingFd.h"
+#include "lib/Span.h"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <deque>
+#include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <boost/asio/bind_executor.hpp>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/error.hpp>
@@ -39,7 +48,18 @@ namespace ipc {
         static std::shared_ptr<raw_ipc_channel_sink_t> create(boost::asio::io_context & io_context,
                                                               lib::AutoClosingFd && out)
         {
-            return std::make_shared<raw_ipc_channel_sink_t>(raw_ipc_channel_sink_t {io_context, std::move(out)});
+            return std::shared_ptr<raw_ipc_channel_sink_t>(new raw_ipc_channel_sink_t {io_context, std::move(out)});
+        }
+
+        // Intentionally unimplemented
+        raw_ipc_channel_sink_t(const raw_ipc_channel_sink_t &) = delete;
+        raw_ipc_channel_sink_t & operator=(const raw_ipc_channel_sink_t &) = delete;
+        raw_ipc_channel_sink_t(raw_ipc_channel_sink_t &&) = delete;
+        raw_ipc_channel_sink_t & operator=(raw_ipc_channel_sink_t &&) = delete;
+
+        ~raw_ipc_channel_sink_t() noexcept
+        {
+            LOG_DEBUG("(%p) IPC sink closed, max queue depth was %zu", this, max_queue_depth());
         }
 
         /**
@@ -78,17 +98,111 @@ namespace ipc {
                 std::forward<CompletionToken>(token));
         }
 
+        /** @return the number of messages that have been accepted for sending but not yet written */
+        [[nodiscard]] std::size_t queue_depth() const { return current_queue_depth.load(std::memory_order_relaxed); }
+
+        /** @return the largest value of queue_depth() seen so far */
+        [[nodiscard]] std::size_t max_queue_depth() const { return peak_queue_depth.load(std::memory_order_relaxed); }
+
     private:
+        /** The most bytes that will be coalesced into a single write (the default pipe capacity) */
+        static constexpr std::size_t max_coalesced_bytes = 64 * 1024;
+        /** The most buffers that will be coalesced into a single write (the most asio will pass to one writev) */
+        static constexpr std::size_t max_coalesced_buffers = 64;
+
+        /**
+         * A free list of queue item storage, bucketed by size, so that queue items are recycled rather than
+         * allocated and freed per message. Only accessed from the strand.
+         */
+        class queue_item_pool_t {
+        public:
+            static constexpr std::size_t block_granule = 64;
+            static constexpr std::size_t max_pooled_size = 1024;
+            static constexpr std::size_t max_blocks_per_bucket = 64;
+
+            queue_item_pool_t() = default;
+
+            // Intentionally unimplemented
+            queue_item_pool_t(const queue_item_pool_t &) = delete;
+            queue_item_pool_t & operator=(const queue_item_pool_t &) = delete;
+            queue_item_pool_t(queue_item_pool_t &&) = delete;
+            queue_item_pool_t & operator=(queue_item_pool_t &&) = delete;
+
+            ~queue_item_pool_t() noexcept
+            {
+                for (auto & bucket : buckets) {
+                    for (void * block : bucket) {
+                        ::operator delete(block);
+                    }
+                }
+            }
+
+            [[nodiscard]] void * allocate(std::size_t size)
+            {
+                const auto index = bucket_index(size);
+                if (index >= n_buckets) {
+                    return ::operator new(size);
+                }
+
+                auto & bucket = buckets[index];
+                if (bucket.empty()) {
+                    return ::operator new((index + 1) * block_granule);
+                }
+
+                void * block = bucket.back();
+                bucket.pop_back();
+                return block;
+            }
+
+            void deallocate(void * block, std::size_t size) noexcept
+            {
+                const auto index = bucket_index(size);
+                if ((index >= n_buckets) || (buckets[index].size() >= max_blocks_per_bucket)) {
+                    return ::operator delete(block);
+                }
+
+                // capacity was reserved up front so this will not throw
+                buckets[index].push_back(block);
+            }
+
+        private:
+            static constexpr std::size_t n_buckets = max_pooled_size / block_granule;
+
+            static constexpr std::size_t bucket_index(std::size_t size) { return (size - 1) / block_granule; }
+
+            std::array<std::vector<void *>, n_buckets> buckets = make_buckets();
+
+            static std::array<std::vector<void *>, n_buckets> make_buckets()
+            {
+                std::array<std::vector<void *>, n_buckets> result {};
+                for (auto & bucket : result) {
+                    bucket.reserve(max_blocks_per_bucket);
+                }
+                return result;
+            }
+        };
+
         /** Type erasing base class for queue items allowing any type of message or handler to be supported */
         class message_queue_item_base_t {
         public:
             virtual ~message_queue_item_base_t() noexcept = default;
             [[nodiscard]] virtual std::size_t expected_size() const = 0;
-            virtual void do_send(raw_ipc_channel_sink_t & parent,
-                                 std::shared_ptr<message_queue_item_base_t> shared_this) = 0;
+            [[nodiscard]] virtual std::size_t buffers_count() const = 0;
+            virtual void append_buffers(std::vector<boost::asio::const_buffer> & buffers) const = 0;
             virtual void call_handler(boost::asio::io_context & context, boost::system::error_code const & ec) = 0;
+            /** Destroy the item and return its storage to the pool */
+            virtual void recycle(queue_item_pool_t & pool) noexcept = 0;
         };
 
+        /** Returns queue items to the pool they were allocated from */
+        struct queue_item_deleter_t {
+            queue_item_pool_t * pool;
+
+            void operator()(message_queue_item_base_t * item) const noexcept { item->recycle(*pool); }
+        };
+
+        using queue_item_ptr_t = std::unique_ptr<message_queue_item_base_t, queue_item_deleter_t>;
+
         /** Default message queue item type, copies the message into a buffer object held in the queue item */
         template<typename MessageType, typename R, typename E>
         class message_queue_item_t : public message_queue_item_base_t {
@@ -100,6 +214,30 @@ namespace ipc {
             using sg_write_helper_type = typename suffix_codec_type::sg_write_helper_type;
             using stored_continuation_t = stored_message_continuation_t<R, E, message_type>;
 
+            static constexpr std::size_t sg_buffers_count = key_codec_type::sg_writer_buffers_count
+                                                          + header_codec_type::sg_writer_buffers_count
+                                                          + suffix_codec_type::sg_writer_buffers_count;
+
+            static_assert(sg_buffers_count <= max_coalesced_buffers);
+
+            /** Construct a new queue item using storage from the pool */
+            static queue_item_ptr_t create(queue_item_pool_t & pool,
+                                           message_type && message,
+                                           stored_continuation_t && sc)
+            {
+                static_assert(alignof(message_queue_item_t) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+                void * storage = pool.allocate(sizeof(message_queue_item_t));
+                try {
+                    return queue_item_ptr_t {new (storage) message_queue_item_t(std::move(message), std::move(sc)),
+                                             queue_item_deleter_t {&pool}};
+                }
+                catch (...) {
+                    pool.deallocate(storage, sizeof(message_queue_item_t));
+                    throw;
+                }
+            }
+
             constexpr message_queue_item_t(message_type && message, stored_continuation_t && sc)
                 : message(std::move(message)),
                   sg_helper(suffix_codec_type::fill_sg_write_helper_type(this->message)),
@@ -113,17 +251,14 @@ namespace ipc {
                      + suffix_codec_type::suffix_write_size(sg_helper);
             }
 
-            void do_send(raw_ipc_channel_sink_t & parent,
-                         std::shared_ptr<message_queue_item_base_t> shared_this) override
-            {
-                using sg_buffer_type =
-                    std::array<boost::asio::const_buffer,
-                               key_codec_type::sg_writer_buffers_count + header_codec_type::sg_writer_buffers_count
-                                   + suffix_codec_type::sg_writer_buffers_count>;
+            [[nodiscard]] std::size_t buffers_count() const override { return sg_buffers_count; }
 
+            void append_buffers(std::vector<boost::asio::const_buffer> & buffers) const override
+            {
                 // fill the scatter gather buffer list
-                sg_buffer_type buffers {};
-                lib::Span<boost::asio::const_buffer> buffers_span {buffers};
+                const auto offset = buffers.size();
+                buffers.resize(offset + sg_buffers_count);
+                lib::Span<boost::asio::const_buffer> buffers_span {buffers.data() + offset, sg_buffers_count};
 
                 key_codec_type::fill_sg_buffer(buffers_span.subspan(0, key_codec_type::sg_writer_buffers_count),
                                                message_type::key);
@@ -133,9 +268,6 @@ namespace ipc {
                 suffix_codec_type::fill_sg_buffer(buffers_span.subspan(key_codec_type::sg_writer_buffers_count
                                                                        + header_codec_type::sg_writer_buffers_count),
                                                   sg_helper);
-
-                // pass it  to the parent for sending
-                parent.do_send_item(std::move(shared_this), std::move(buffers));
             }
 
             void call_handler(boost::asio::io_context & context, boost::system::error_code const & ec) override
@@ -143,25 +275,36 @@ namespace ipc {
                 resume_continuation(context, std::move(sc), ec, std::move(message));
             }
 
+            void recycle(queue_item_pool_t & pool) noexcept override
+            {
+                this->~message_queue_item_t();
+                pool.deallocate(this, sizeof(message_queue_item_t));
+            }
+
         private:
             message_type message;
             sg_write_helper_type sg_helper;
             stored_continuation_t sc;
         };
 
-        // so it can call do_send_item
-        template<typename MessageType, typename R, typename E>
-        friend class message_queue_item_t;
-
         boost::asio::io_context::strand strand;
         boost::asio::posix::stream_descriptor out;
-        std::deque<std::shared_ptr<message_queue_item_base_t>> send_queue {};
+        // NB: must be declared before anything holding a queue_item_ptr_t so that it is destroyed after them
+        queue_item_pool_t item_pool {};
+        std::deque<queue_item_ptr_t> send_queue {};
+        std::vector<queue_item_ptr_t> in_flight {};
+        std::vector<boost::asio::const_buffer> write_buffers {};
+        std::size_t in_flight_size = 0;
+        std::atomic<std::size_t> current_queue_depth {0};
+        std::atomic<std::size_t> peak_queue_depth {0};
         bool consume_in_progress = false;
 
         /** Constructor is hidden to force the use of the factory method since the class is enable_shared_from_this */
         raw_ipc_channel_sink_t(boost::asio::io_context & io_context, lib::AutoClosingFd && out)
             : strand(io_context), out(io_context, out.release())
         {
+            in_flight.reserve(max_coalesced_buffers);
+            write_buffers.reserve(max_coalesced_buffers);
         }
 
         /** Insert the message and handler into the send queue */
@@ -174,24 +317,22 @@ namespace ipc {
 
             LOG_TRACE("(%p) New send request received with key %zu", this, std::size_t(message_type::key));
 
-            // run on the strand to serialize access to the queue
+            // run on the strand to serialize access to the queue and the item pool
             boost::asio::post(strand,
                               [st = shared_from_this(),
-                               queue_item = std::make_shared<queue_item_t>(std::forward<MessageType>(message),
-                                                                           std::move(sc))]() mutable {
-                                  st->strand_do_async_send_message(message_type::key, std::move(queue_item));
+                               message = message_type(std::forward<MessageType>(message)),
+                               sc = std::move(sc)]() mutable {
+                                  st->strand_do_async_send_message(
+                                      message_type::key,
+                                      queue_item_t::create(st->item_pool, std::move(message), std::move(sc)));
                               });
         }
 
         /** Insert the message and handler into the send queue */
         template<typename MessageType>
-        void strand_do_async_send_message(MessageType key, std::shared_ptr<message_queue_item_base_t> queue_item)
+        void strand_do_async_send_message(MessageType key, queue_item_ptr_t queue_item)
         {
-            // fast path for case that queue is already empty and consumer is waiting
             const auto cip = is_consume_in_progress();
-            if (send_queue.empty() && !cip) {
-                return strand_do_consume_item(std::move(queue_item));
-            }
 
             LOG_TRACE("(%p) Queueing new request %p with key %zu (empty=%u, busy=%u)",
                       this,
@@ -200,82 +341,89 @@ namespace ipc {
                       send_queue.empty(),
                       cip);
 
-            // stick it in the queue, the consumer will pick it up when its ready
+            // stick it in the queue, if a write is in progress it will be picked up (along with anything else that
+            // is queued in the mean time) once that write completes
             send_queue.emplace_back(std::move(queue_item));
+            update_queue_depth();
+
+            if (!cip) {
+                strand_do_send_batch();
+            }
         }
 
-        /** Consume data from the buffer and write to stream */
-        void strand_do_consume_item(std::shared_ptr<message_queue_item_base_t> && queue_item)
+        /** Move as many queued items as will fit within the coalescing budget into a single write */
+        void strand_do_send_batch()
         {
             // NB: must already be on the strand
-            runtime_assert(queue_item != nullptr, "Invalid queue item");
+            runtime_assert(!send_queue.empty(), "Invalid queue state");
+            runtime_assert(in_flight.empty(), "Invalid in flight state");
 
-            // mark busy to prevent another send request from enqueueing up in parallel
+            // mark busy to prevent another send request from starting another write in parallel
             const auto cip = set_consume_in_progress(true);
-            LOG_TRACE("(%p) Consuming queue item %p (empty=%u, busy=%u)",
-                      this,
-                      queue_item.get(),
-                      send_queue.empty(),
-                      cip);
-
             runtime_assert(!cip, "Invalid state");
 
-            // call the do_send method, which will then invoke the do_send_item with one or more buffers to actually send
-            queue_item->do_send(*this, queue_item);
-        }
-
-        /** Called by the message queue item to send the actual data */
-        template<std::size_t N>
-        void do_send_item(std::shared_ptr<message_queue_item_base_t> && queue_item,
-                          std::array<boost::asio::const_buffer, N> buffers)
-        {
-            // NB: must already be on the strand
-
-            LOG_TRACE("(%p) Sending queue item %p (n_buffers=%zu)", this, queue_item.get(), N);
+            write_buffers.clear();
+            in_flight_size = 0;
+
+            while (!send_queue.empty()) {
+                auto & queue_item = send_queue.front();
+                const auto size = queue_item->expected_size();
+                const auto n_buffers = queue_item->buffers_count();
+
+                // always send at least one item, regardless of its size
+                if ((!in_flight.empty())
+                    && (((in_flight_size + size) > max_coalesced_bytes)
+                        || ((write_buffers.size() + n_buffers) > max_coalesced_buffers))) {
+                    break;
+                }
+
+                queue_item->append_buffers(write_buffers);
+                in_flight_size += size;
+                in_flight.emplace_back(std::move(queue_item));
+                send_queue.pop_front();
+            }
 
-            // perform the actual write
-            boost::asio::async_write(out,
-                                     buffers,
-                                     [st = shared_from_this(), queue_item = std::move(queue_item)](
-                                         boost::system::error_code const & ec,
-                                         std::size_t n) mutable { st->on_sent_result(queue_item, ec, n); });
+            LOG_TRACE("(%p) Sending %zu queue items (n_buffers=%zu, size=%zu, remaining=%zu)",
+                      this,
+                      in_flight.size(),
+                      write_buffers.size(),
+                      in_flight_size,
+                      send_queue.size());
+
+            // perform the actual write, the queue items own the data referenced by write_buffers
+            boost::asio::async_write(
+                out,
+                write_buffers,
+                boost::asio::bind_executor(
+                    strand,
+                    [st = shared_from_this()](boost::system::error_code const & ec, std::size_t n) {
+                        st->strand_on_sent_result(ec, n);
+                    }));
         }
 
-        /** Handle the send result */
-        void on_sent_result(std::shared_ptr<message_queue_item_base_t> const & queue_item,
-                            boost::system::error_code const & ec,
-                            std::size_t n)
+        /** Handle the send result (running on the strand) */
+        void strand_on_sent_result(boost::system::error_code const & ec, std::size_t n)
         {
             //  error
             if (ec) {
-                LOG_DEBUG("(%p) Sending queue item %p failed with error=%s",
+                LOG_DEBUG("(%p) Sending %zu queue items failed with error=%s",
                           this,
-                          queue_item.get(),
+                          in_flight.size(),
                           ec.message().c_str());
-                // notify the handler (which happens asynchronously)
-                return queue_item->call_handler(strand.context(), ec);
+                // notify the handlers (which happens asynchronously)
+                return strand_complete_in_flight(ec);
             }
 
             //  short write error
-            if (n != queue_item->expected_size()) {
-                LOG_DEBUG("(%p) Sending queue item %p failed with short write %zu", this, queue_item.get(), n);
-                // notify the handler (which happens asynchronously)
-                return queue_item->call_handler(
-                    strand.context(),
+            if (n != in_flight_size) {
+                LOG_DEBUG("(%p) Sending %zu queue items failed with short write %zu", this, in_flight.size(), n);
+                // notify the handlers (which happens asynchronously)
+                return strand_complete_in_flight(
                     boost::asio::error::make_error_code(boost::asio::error::misc_errors::eof));
             }
 
-            // notify the handler (which happens asynchronously)
-            queue_item->call_handler(strand.context(), {});
-
-            // consume the next item (but from the stand as it will modify state)
-            return boost::asio::post(strand, [st = shared_from_this()]() { st->strand_do_consume_next(); });
-        }
-
-        /** Consume the next item (running on the strand) */
-        void strand_do_consume_next()
-        {
-            LOG_TRACE("(%p) Request to process next queue item", this);
+            // notify the handlers (which happens asynchronously)
+            strand_complete_in_flight({});
 
             // send is complete
             auto cip = set_consume_in_progress(false);
@@ -287,12 +435,28 @@ namespace ipc {
                 return;
             }
 
-            // remove the head of the senq queue
-            auto next_item = std::move(send_queue.front());
-            send_queue.pop_front();
+            // send the next batch
+            return strand_do_send_batch();
+        }
 
-            // and send it
-            return strand_do_consume_item(std::move(next_item));
+        /** Notify the handlers of all the in flight items and return them to the pool */
+        void strand_complete_in_flight(boost::system::error_code const & ec)
+        {
+            for (auto & queue_item : in_flight) {
+                queue_item->call_handler(strand.context(), ec);
+            }
+            in_flight.clear();
+            update_queue_depth();
+        }
+
+        /** Update the queue depth counters */
+        void update_queue_depth()
+        {
+            const auto depth = send_queue.size() + in_flight.size();
+            current_queue_depth.store(depth, std::memory_order_relaxed);
+            if (depth > peak_queue_depth.load(std::memory_order_relaxed)) {
+                peak_queue_depth.store(depth, std::memory_order_relaxed);
+            }
         }
 
         /** Check if consume in progress */
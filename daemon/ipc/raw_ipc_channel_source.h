@@ -1,4 +1,4 @@
-/* Copyright (C) 2021-2022 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2021-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
@@ -12,13 +12,18 @@
 #include "ipc/messages.h"
 #include "lib/Assert.h"
 #include "lib/AutoClosingFd.h"
+#include "lib/Span.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstddef>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <tuple>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/dispatch.hpp>
@@ -151,14 +156,22 @@ namespace ipc {
         template<typename... MessageTypes>
         friend struct detail::message_types_trait_finder_t;
 
+        /**
+         * The size of the receive buffer. Messages are decoded directly from here, so as many messages as fit are
+         * read with a single syscall. Only message suffixes too large to fit are read into their own allocation.
+         */
+        static constexpr std::size_t receive_buffer_size = 64 * 1024;
+
         boost::asio::io_context::strand strand;
         boost::asio::posix::stream_descriptor in;
-        message_key_t message_key_buffer = message_key_t::unknown;
+        std::vector<char> receive_buffer;
+        std::size_t receive_begin = 0;
+        std::size_t receive_end = 0;
         bool recv_in_progress = false;
 
         /** Constructor is hidden to force the use of the factory method since the class is enable_shared_from_this */
         raw_ipc_channel_source_t(boost::asio::io_context & io_context, lib::AutoClosingFd && in)
-            : strand(io_context), in(io_context, in.release())
+            : strand(io_context), in(io_context, in.release()), receive_buffer(receive_buffer_size)
         {
         }
 
@@ -182,8 +195,6 @@ namespace ipc {
             async::continuations::
                 raw_stored_continuation_t<R, E, boost::system::error_code, all_message_types_variant_t> && sc)
         {
-            using unknown_message = message_t<message_key_t::unknown, void, void>;
-            using key_codec_type = key_codec_t<unknown_message>;
             using sc_wrapper_type = sc_wrapper_t<R, E>;
 
             // should not already be pending...
@@ -196,35 +207,80 @@ namespace ipc {
                                            {});
             }
 
-            LOG_TRACE("(%p) Reading next key from stream", this);
+            return do_decode_next(sc_wrapper_type(std::move(sc)));
+        }
 
-            // read the key
-            boost::asio::async_read(
-                in,
-                key_codec_type::mutable_buffer(message_key_buffer),
-                [st = shared_from_this(), scw = sc_wrapper_type(std::move(sc))](auto ec, auto n) mutable {
+        /** @return the bytes that have been received but not yet decoded */
+        [[nodiscard]] lib::Span<char const> received_bytes() const
+        {
+            return {receive_buffer.data() + receive_begin, receive_end - receive_begin};
+        }
+
+        /** Mark some number of received bytes as decoded */
+        void consume_received_bytes(std::size_t n)
+        {
+            receive_begin += n;
+            if (receive_begin == receive_end) {
+                receive_begin = 0;
+                receive_end = 0;
+            }
+        }
+
+        /** Decode the next message from the receive buffer, reading more data first if required */
+        template<typename R, typename E>
+        void do_decode_next(sc_wrapper_t<R, E> && scw)
+        {
+            using unknown_message = message_t<message_key_t::unknown, void, void>;
+            using key_codec_type = key_codec_t<unknown_message>;
+
+            auto bytes = received_bytes();
+            if (bytes.size() < key_codec_type::key_size) {
+                return do_receive_more(std::move(scw));
+            }
+
+            // decode the key, but don't consume it until the whole message is available
+            message_key_t key = message_key_t::unknown;
+            key_codec_type::read_key(bytes, key);
+
+            LOG_TRACE("(%p) Decoding message with key %zu", this, std::size_t(key));
+
+            // find the matching traits type
+            return message_types_trait_finder_type::visit(key, *this, std::move(scw));
+        }
+
+        /** Read as many bytes as are available (up to the free space in the receive buffer) then resume decoding */
+        template<typename R, typename E>
+        void do_receive_more(sc_wrapper_t<R, E> && scw)
+        {
+            // move any partial message to the start of the buffer to make as much room as possible
+            if (receive_begin > 0) {
+                std::memmove(receive_buffer.data(), receive_buffer.data() + receive_begin, receive_end - receive_begin);
+                receive_end -= receive_begin;
+                receive_begin = 0;
+            }
+
+            LOG_TRACE("(%p) Reading more data from stream (have %zu bytes)", this, receive_end);
+
+            in.async_read_some(
+                boost::asio::buffer(receive_buffer.data() + receive_end, receive_buffer.size() - receive_end),
+                [st = shared_from_this(), scw = std::move(scw)](auto ec, auto n) mutable {
                     // validate error
                     if (ec) {
-                        LOG_TRACE("(%p) Reading next key failed with error=%s", st.get(), ec.message().c_str());
+                        LOG_TRACE("(%p) Reading from stream failed with error=%s", st.get(), ec.message().c_str());
                         return st->invoke_handler(std::move(scw), ec, {});
                     }
 
-                    // validate size
-                    if (n != key_codec_type::key_size) {
-                        LOG_TRACE("(%p) Reading next key failed with due to short read (n=%zu)", st.get(), n);
+                    if (n == 0) {
+                        LOG_TRACE("(%p) Reading from stream failed due to end of stream", st.get());
                         return st->invoke_handler(
                             std::move(scw),
                             boost::asio::error::make_error_code(boost::asio::error::misc_errors::eof),
                             {});
                     }
 
-                    // decode the key
-                    message_key_t key = st->message_key_buffer;
-
-                    LOG_TRACE("(%p) Reading next key succeeded with new key %zu", st.get(), std::size_t(key));
+                    st->receive_end += n;
 
-                    // find the matching traits type
-                    return message_types_trait_finder_type::visit(key, *st, std::move(scw));
+                    return st->do_decode_next(std::move(scw));
                 });
         }
 
@@ -238,150 +294,106 @@ namespace ipc {
             return invoke_handler(std::move(scw), errc::make_error_code(errc::operation_not_supported), {});
         }
 
-        /** Received a known key and have the type traits for it */
+        /** Received a known key and have the type traits for it; decode the rest of the message from the receive buffer */
         template<typename TraitsType, typename R, typename E>
         void do_recv_known(sc_wrapper_t<R, E> && scw)
         {
             using traits_type = TraitsType;
             using message_type = typename traits_type::message_type;
+            using key_codec_type = key_codec_t<message_type>;
             using header_codec_type = header_codec_t<message_type>;
             using suffix_codec_type = suffix_codec_t<message_type>;
-            using wrapper_type = message_wrapper_t<message_type, typename suffix_codec_type::sg_read_helper_type>;
-
-            // allocate the message wrapper
-            auto message_wrapper = std::make_shared<wrapper_type>();
-
-            // skip reading the header if it is zero length
-            if (header_codec_type::header_size == 0) {
-                LOG_TRACE("(%p) Skipping header read for key %zu due to zero length header",
-                          this,
-                          std::size_t(traits_type::key));
-                return do_recv_suffix_length<traits_type>(message_wrapper, std::move(scw));
-            }
-
-            LOG_TRACE("(%p) Reading header for key %zu of length %zu",
-                      this,
-                      std::size_t(traits_type::key),
-                      header_codec_type::header_size);
+            using read_helper_type = typename suffix_codec_type::sg_read_helper_type;
 
-            // read the header
-            return boost::asio::async_read(
-                in,
-                header_codec_type::mutable_buffer(message_wrapper->message),
-                [st = shared_from_this(), message_wrapper, scw = std::move(scw)](auto ec, auto n) mutable {
-                    // validate error
-                    if (ec) {
-                        LOG_TRACE("(%p) Reading header for key=%zu failed with error=%s",
-                                  st.get(),
-                                  std::size_t(traits_type::key),
-                                  ec.message().c_str());
+            constexpr std::size_t prefix_size =
+                key_codec_type::key_size + header_codec_type::header_size + suffix_codec_type::length_size;
 
-                        return st->invoke_handler(std::move(scw), ec, {});
-                    }
+            static_assert(prefix_size <= receive_buffer_size);
 
-                    // validate size
-                    if (n != header_codec_type::header_size) {
-                        LOG_TRACE("(%p) Reading header for key=%zu failed with due to short read (n=%zu)",
-                                  st.get(),
-                                  std::size_t(traits_type::key),
-                                  n);
+            auto bytes = received_bytes();
+            if (bytes.size() < prefix_size) {
+                return do_receive_more(std::move(scw));
+            }
 
-                        return st->invoke_handler(
-                            std::move(scw),
-                            boost::asio::error::make_error_code(boost::asio::error::misc_errors::eof),
-                            {});
+            message_type message {};
+            read_helper_type helper {};
+
+            // decode the header and suffix length
+            auto remaining = bytes.subspan(key_codec_type::key_size);
+            remaining = header_codec_type::read_header(remaining, message);
+            std::size_t suffix_length = 0;
+            remaining = suffix_codec_type::read_suffix_length(remaining, suffix_length);
+
+            // wait for the rest of the message if it will fit in the buffer, otherwise read the suffix
+            // straight into its own storage
+            if (remaining.size() < suffix_length) {
+                if constexpr (suffix_codec_type::length_size > 0) {
+                    if ((prefix_size + suffix_length) > receive_buffer.size()) {
+                        return do_recv_large_suffix<traits_type>(std::move(message), suffix_length, std::move(scw));
                     }
-
-                    // now read the suffix
-                    return st->do_recv_suffix_length<traits_type>(message_wrapper, std::move(scw));
-                });
-        }
-
-        /** Received the key and header, now read the length */
-        template<typename TraitsType, typename WrapperType, typename R, typename E>
-        void do_recv_suffix_length(std::shared_ptr<WrapperType> message_wrapper, sc_wrapper_t<R, E> && scw)
-        {
-            using traits_type = TraitsType;
-            using message_type = typename traits_type::message_type;
-            using suffix_codec_type = suffix_codec_t<message_type>;
-            using wrapper_type = message_wrapper_t<message_type, typename suffix_codec_type::sg_read_helper_type>;
-
-            static_assert(std::is_same_v<WrapperType, wrapper_type>);
-
-            // skip reading the length if it is zero length
-            if (suffix_codec_type::length_size == 0) {
-                LOG_TRACE("(%p) Skipping suffix length read for key %zu due to zero length",
-                          this,
-                          std::size_t(traits_type::key));
-                return do_recv_suffix<traits_type>(message_wrapper, std::move(scw));
+                }
+                return do_receive_more(std::move(scw));
             }
 
-            LOG_TRACE("(%p) Reading suffix length for key %zu of length %zu",
+            LOG_TRACE("(%p) Decoding complete message for key %zu with suffix of length %zu",
                       this,
                       std::size_t(traits_type::key),
-                      suffix_codec_type::length_size);
+                      suffix_length);
 
-            // read the length
-            return boost::asio::async_read(
-                in,
-                suffix_codec_type::mutable_length_buffer(message_wrapper->buffer),
-                [st = shared_from_this(), message_wrapper, scw = std::move(scw)](auto ec, auto n) mutable {
-                    // validate error
-                    if (ec) {
-                        LOG_TRACE("(%p) Reading suffix length for key=%zu failed with error=%s",
-                                  st.get(),
-                                  std::size_t(traits_type::key),
-                                  ec.message().c_str());
+            if constexpr (suffix_codec_type::length_size > 0) {
+                helper.length = suffix_length;
+            }
 
-                        return st->invoke_handler(std::move(scw), ec, {});
-                    }
+            auto suffix_buffer = suffix_codec_type::mutable_suffix_buffer(message, helper);
+            runtime_assert(suffix_buffer.size() == suffix_length, "Unexpected suffix buffer length");
+            if (suffix_length > 0) {
+                std::memcpy(suffix_buffer.data(), remaining.data(), suffix_length);
+            }
 
-                    // validate size
-                    if (n != suffix_codec_type::length_size) {
-                        LOG_TRACE("(%p) Reading suffix length for key=%zu failed with due to short read (n=%zu)",
-                                  st.get(),
-                                  std::size_t(traits_type::key),
-                                  n);
+            consume_received_bytes(prefix_size + suffix_length);
 
-                        return st->invoke_handler(
-                            std::move(scw),
-                            boost::asio::error::make_error_code(boost::asio::error::misc_errors::eof),
-                            {});
-                    }
-
-                    // now read the suffix
-                    return st->do_recv_suffix<traits_type>(message_wrapper, std::move(scw));
-                });
+            return do_recv_complete<traits_type>(message, helper, std::move(scw));
         }
 
-        /** Received the key, header and length, now read the suffix */
-        template<typename TraitsType, typename WrapperType, typename R, typename E>
-        void do_recv_suffix(std::shared_ptr<WrapperType> message_wrapper, sc_wrapper_t<R, E> && scw)
+        /** The message suffix is larger than the receive buffer so read the rest of it directly */
+        template<typename TraitsType, typename MessageType, typename R, typename E>
+        void do_recv_large_suffix(MessageType && message, std::size_t suffix_length, sc_wrapper_t<R, E> && scw)
         {
             using traits_type = TraitsType;
             using message_type = typename traits_type::message_type;
+            using key_codec_type = key_codec_t<message_type>;
+            using header_codec_type = header_codec_t<message_type>;
             using suffix_codec_type = suffix_codec_t<message_type>;
             using wrapper_type = message_wrapper_t<message_type, typename suffix_codec_type::sg_read_helper_type>;
 
-            static_assert(std::is_same_v<WrapperType, wrapper_type>);
+            static_assert(std::is_same_v<std::decay_t<MessageType>, message_type>);
 
-            auto buffer = suffix_codec_type::mutable_suffix_buffer(message_wrapper->message, message_wrapper->buffer);
+            constexpr std::size_t prefix_size =
+                key_codec_type::key_size + header_codec_type::header_size + suffix_codec_type::length_size;
 
-            // skip reading the length if it is zero length
-            if (buffer.size() == 0) {
-                LOG_TRACE("(%p) Skipping suffix read for key %zu due to zero length",
-                          this,
-                          std::size_t(traits_type::key));
+            // allocate the message wrapper
+            auto message_wrapper = std::make_shared<wrapper_type>();
+            message_wrapper->message = std::forward<MessageType>(message);
+            message_wrapper->buffer.length = suffix_length;
 
-                return do_recv_complete<traits_type>(message_wrapper, std::move(scw));
-            }
+            auto buffer = suffix_codec_type::mutable_suffix_buffer(message_wrapper->message, message_wrapper->buffer);
 
-            LOG_TRACE("(%p) Reading suffix for key %zu of length %zu",
+            // copy out the part that was already received
+            consume_received_bytes(prefix_size);
+            auto bytes = received_bytes();
+            const std::size_t already_received = std::min(bytes.size(), buffer.size());
+            std::memcpy(buffer.data(), bytes.data(), already_received);
+            consume_received_bytes(already_received);
+
+            LOG_TRACE("(%p) Reading large suffix for key %zu of length %zu (have %zu bytes)",
                       this,
                       std::size_t(traits_type::key),
-                      suffix_codec_type::length_size);
+                      suffix_length,
+                      already_received);
+
+            // read the remainder
+            buffer += already_received;
 
-            // read the length
             return boost::asio::async_read(
                 in,
                 buffer,
@@ -411,26 +423,27 @@ namespace ipc {
                             {});
                     }
 
-                    // now read the suffix
-                    return st->do_recv_complete<traits_type>(message_wrapper, std::move(scw));
+                    return st->do_recv_complete<traits_type>(message_wrapper->message,
+                                                             message_wrapper->buffer,
+                                                             std::move(scw));
                 });
         }
 
         /** Read complete */
-        template<typename TraitsType, typename WrapperType, typename R, typename E>
-        void do_recv_complete(std::shared_ptr<WrapperType> message_wrapper, sc_wrapper_t<R, E> && scw)
+        template<typename TraitsType, typename MessageType, typename ReadHelperType, typename R, typename E>
+        void do_recv_complete(MessageType & message, ReadHelperType const & helper, sc_wrapper_t<R, E> && scw)
         {
             using traits_type = TraitsType;
             using message_type = typename traits_type::message_type;
             using suffix_codec_type = suffix_codec_t<message_type>;
-            using wrapper_type = message_wrapper_t<message_type, typename suffix_codec_type::sg_read_helper_type>;
 
-            static_assert(std::is_same_v<WrapperType, wrapper_type>);
+            static_assert(std::is_same_v<MessageType, message_type>);
+            static_assert(std::is_same_v<ReadHelperType, typename suffix_codec_type::sg_read_helper_type>);
 
             LOG_TRACE("(%p) Reading complete for key %zu", this, std::size_t(traits_type::key));
 
             // apply conversion from read buffer to message suffix
-            auto ec = suffix_codec_type::read_suffix(message_wrapper->buffer, message_wrapper->message);
+            auto ec = suffix_codec_type::read_suffix(helper, message);
 
             // handle conversion failure
             if (ec) {
@@ -443,7 +456,7 @@ namespace ipc {
             }
 
             // notify handler
-            return invoke_handler(std::move(scw), ec, std::move(message_wrapper->message));
+            return invoke_handler(std::move(scw), ec, std::move(message));
         }
 
         /** Invoke the handler */
@@ -1,12 +1,90 @@
-/* Copyright (C) 2018-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2018-2025 by Arm Limited. All rights reserved. */
 
 #include "lib/File.h"
 
+#include "lib/AutoClosingFd.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include <fcntl.h>
+#include <unistd.h>
 
 namespace lib {
+    namespace {
+        [[nodiscard]] int openForRead(const char * path, int dirFd)
+        {
+            int fd;
+            do {
+                fd = ::openat(dirFd, path, O_RDONLY | O_CLOEXEC);
+            } while ((fd < 0) && (errno == EINTR));
+            return fd;
+        }
+
+        /**
+         * Reads into the buffer, growing it as needed, until EOF or until `stop` returns true for the newly read data
+         */
+        template<typename Buffer, typename Stop>
+        bool readFdIntoUntil(int fd, Buffer & buffer, Stop && stop)
+        {
+            // use all of the capacity from any previous read, without reallocating
+            buffer.resize(std::max(buffer.capacity(), READ_BUFFER_INITIAL_CAPACITY));
+
+            std::size_t used = 0;
+            while (true) {
+                if (used == buffer.size()) {
+                    buffer.resize(buffer.size() * 2);
+                }
+
+                auto const n = ::read(fd, buffer.data() + used, buffer.size() - used);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    buffer.clear();
+                    return false;
+                }
+
+                if (n == 0) {
+                    break;
+                }
+
+                auto const start = used;
+                used += n;
+
+                if (stop(buffer, start, used)) {
+                    break;
+                }
+            }
+
+            buffer.resize(used);
+            return true;
+        }
+
+        template<typename Buffer>
+        bool readFdIntoImpl(int fd, Buffer & buffer)
+        {
+            return readFdIntoUntil(fd, buffer, [](Buffer const &, std::size_t, std::size_t) { return false; });
+        }
+
+        template<typename Buffer>
+        bool readFileIntoImpl(const char * path, Buffer & buffer, int dirFd)
+        {
+            AutoClosingFd fd {openForRead(path, dirFd)};
+            if (!fd) {
+                buffer.clear();
+                return false;
+            }
+            return readFdIntoImpl(*fd, buffer);
+        }
+    }
+
     FILE * fopen_cloexec(const char * path, const char * mode)
     {
         FILE * fh = fopen(path, mode);
@@ -22,4 +100,44 @@ namespace lib {
         return fh;
     }
 
+    bool readFdInto(int fd, std::string & buffer)
+    {
+        return readFdIntoImpl(fd, buffer);
+    }
+
+    bool readFdInto(int fd, std::vector<std::uint8_t> & buffer)
+    {
+        return readFdIntoImpl(fd, buffer);
+    }
+
+    bool readFileInto(const char * path, std::string & buffer, int dirFd)
+    {
+        return readFileIntoImpl(path, buffer, dirFd);
+    }
+
+    bool readFileInto(const char * path, std::vector<std::uint8_t> & buffer, int dirFd)
+    {
+        return readFileIntoImpl(path, buffer, dirFd);
+    }
+
+    bool readFirstLineInto(const char * path, std::string & buffer, int dirFd)
+    {
+        AutoClosingFd fd {openForRead(path, dirFd)};
+        if (!fd) {
+            buffer.clear();
+            return false;
+        }
+
+        if (!readFdIntoUntil(*fd, buffer, [](std::string const & data, std::size_t start, std::size_t end) {
+                return std::memchr(data.data() + start, '\n', end - start) != nullptr;
+            })) {
+            return false;
+        }
+
+        auto const eol = buffer.find('\n');
+        if (eol != std::string::npos) {
+            buffer.resize(eol);
+        }
+        return true;
+    }
 }
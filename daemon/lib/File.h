@@ -1,12 +1,47 @@
-/* Copyright (C) 2018-2020 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2018-2025 by Arm Limited. All rights reserved. */
 
 #ifndef INCLUDE_LIB_FILE_H
 #define INCLUDE_LIB_FILE_H
 
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
 
 namespace lib {
     FILE * fopen_cloexec(const char * path, const char * mode);
+
+    /** The capacity given to an empty buffer before the first read into it */
+    constexpr std::size_t READ_BUFFER_INITIAL_CAPACITY = 4096;
+
+    /**
+     * Read from the file descriptor until EOF, replacing the contents of buffer with the data.
+     *
+     * The read is done directly into the buffer, which is only grown when it fills up. As the buffer's capacity is
+     * kept, reusing one buffer for many files means that it settles at the size of the largest of them.
+     *
+     * @return true if successful, false if read failed (in which case the buffer is empty)
+     */
+    bool readFdInto(int fd, std::string & buffer);
+    bool readFdInto(int fd, std::vector<std::uint8_t> & buffer);
+
+    /**
+     * Read the whole of a file, replacing the contents of buffer with the data. This is a single open and as few
+     * reads as the buffer's capacity allows, so is suited to procfs and sysfs files which report no size.
+     *
+     * @param dirFd If path is relative, it is relative to this directory
+     * @return true if successful, false if the file could not be opened or read (in which case the buffer is empty)
+     */
+    bool readFileInto(const char * path, std::string & buffer, int dirFd = AT_FDCWD);
+    bool readFileInto(const char * path, std::vector<std::uint8_t> & buffer, int dirFd = AT_FDCWD);
+
+    /**
+     * As readFileInto, but stops at the end of the first line, which is not included
+     */
+    bool readFirstLineInto(const char * path, std::string & buffer, int dirFd = AT_FDCWD);
 }
 
 #endif // INCLUDE_LIB_FILE_H
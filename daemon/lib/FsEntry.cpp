@@ -1,10 +1,11 @@
-/* Copyright (C) 2016-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2016-2025 by Arm Limited. All rights reserved. */
 
 #include "lib/FsEntry.h"
 
 #include "Logging.h"
 #include "lib/Assert.h"
 #include "lib/Error.h"
+#include "lib/File.h"
 
 #include <cerrno>
 #include <climits>
@@ -13,10 +14,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
-#include <iostream>
 #include <memory>
 #include <optional>
-#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -274,61 +273,33 @@ namespace lib {
 
     std::string FsEntry::readFileContents() const
     {
-        std::ifstream stream(path(), std::ios::in);
-        std::ostringstream buffer;
-
-        // read contents
-        bool first = true;
-        while (stream) {
-            if (!first) {
-                buffer << '\n';
-            }
-            else {
-                first = false;
-            }
-
-            std::string line;
-            std::getline(stream, line);
-            buffer << line;
-        }
-
-        return buffer.str();
+        std::string result {};
+        (void) readFileInto(result);
+        return result;
     }
 
     std::vector<std::uint8_t> FsEntry::readFileContentsAsBytes() const
     {
-        std::ifstream stream(path(), std::ios::in | std::ios::binary);
-
-        stream.unsetf(std::ios::skipws);
-
-        stream.seekg(0, std::ios::end);
-        auto const size = stream.tellg();
-        stream.seekg(0, std::ios::beg);
-
         std::vector<std::uint8_t> result {};
-
-        if (size > 0) {
-            result.reserve(size);
-        }
-
-        result.insert(result.begin(),
-                      std::istream_iterator<std::uint8_t>(stream),
-                      std::istream_iterator<std::uint8_t>());
-
+        (void) readFileInto(result);
         return result;
     }
 
     std::string FsEntry::readFileContentsSingleLine() const
     {
-        std::ifstream stream(path(), std::ios::in);
-        std::string line;
+        std::string result {};
+        (void) readFirstLineInto(path_.c_str(), result);
+        return result;
+    }
 
-        // read contents
-        if (stream) {
-            std::getline(stream, line);
-        }
+    bool FsEntry::readFileInto(std::string & buffer) const
+    {
+        return lib::readFileInto(path_.c_str(), buffer);
+    }
 
-        return line;
+    bool FsEntry::readFileInto(std::vector<std::uint8_t> & buffer) const
+    {
+        return lib::readFileInto(path_.c_str(), buffer);
     }
 
     bool FsEntry::writeFileContents(const char * data) const
@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2016-2025 by Arm Limited. All rights reserved. */
 
 #ifndef INCLUDE_LIB_FSENTRY_H
 #define INCLUDE_LIB_FSENTRY_H
@@ -125,6 +125,14 @@ namespace lib {
          */
         [[nodiscard]] std::string readFileContentsSingleLine() const;
 
+        /**
+         * Read the contents of a file into buffer, replacing what it held. The buffer keeps its capacity, so when
+         * reading many files, reuse one buffer rather than calling readFileContents for each.
+         * @return true if the file was read, false if it could not be opened or read
+         */
+        bool readFileInto(std::string & buffer) const;
+        bool readFileInto(std::vector<std::uint8_t> & buffer) const;
+
         /**
          * Write the contents of a file
          * @return  true if successful
@@ -1,4 +1,4 @@
-/* Copyright (C) 2018-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2018-2025 by Arm Limited. All rights reserved. */
 
 #include "Syscall.h"
 
@@ -66,6 +66,12 @@ namespace lib {
         return syscall(__NR_accept4, sockfd, addr, addrlen, flags);
     }
 
+    int memfd_create(const char * name, unsigned int flags)
+    {
+        // NOLINTNEXTLINE(bugprone-narrowing-conversions)
+        return syscall(__NR_memfd_create, name, flags);
+    }
+
     ssize_t read(int fd, void * buf, size_t count)
     {
         return ::read(fd, buf, count);
@@ -1,4 +1,4 @@
-/* Copyright (C) 2018-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2018-2025 by Arm Limited. All rights reserved. */
 
 #ifndef INCLUDE_LIB_SYSCALL_H
 #define INCLUDE_LIB_SYSCALL_H
@@ -38,6 +38,8 @@ namespace lib {
 
     int pipe2(std::array<int, 2> & fds, int flags);
 
+    int memfd_create(const char * name, unsigned int flags);
+
     int uname(struct utsname * buf);
 
     uid_t geteuid();
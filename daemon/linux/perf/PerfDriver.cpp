@@ -296,9 +296,10 @@ namespace {
     [[nodiscard]] metrics::metric_cpu_version_map_entry_t const & get_common_metrics_version(
         metrics::metric_cpu_event_map_entry_t const & cpu_metrics)
     {
-        if (auto it = cpu_metrics.per_version_metrics.find(metrics::metric_cpu_version_t());
-            it != cpu_metrics.per_version_metrics.end()) {
-            return it->second;
+        // the versions are sorted, common first
+        auto const & versions = cpu_metrics.per_version_metrics;
+        if ((versions.size() > 0) && versions.begin()->version.is_common()) {
+            return versions.begin()->metrics;
         }
 
         return empty_common_metrics;
@@ -653,7 +654,7 @@ namespace {
         std::size_t total_num_events = 0;
 
         for (auto const & entry : events) {
-            auto const & metric = entry.metric.get();
+            auto const & metric = entry.metric;
             if (auto const [it, inserted] = seen_ids.insert(metric.identifier); inserted) {
                 (void) it; //GCC7 :-(
 
@@ -681,14 +682,14 @@ namespace {
                                                          cpu_metrics_common.largest_metric_event_count);
 
             result.total_num_events =
-                combine_metrics_recursive(seen_ids, cpu_metrics_version->root_events.get(), result.root_events);
+                combine_metrics_recursive(seen_ids, cpu_metrics_version->root_events, result.root_events);
         }
         else {
             result.largest_metric_event_count = cpu_metrics_common.largest_metric_event_count;
         }
 
         result.total_num_events +=
-            combine_metrics_recursive(seen_ids, cpu_metrics_common.root_events.get(), result.root_events);
+            combine_metrics_recursive(seen_ids, cpu_metrics_common.root_events, result.root_events);
 
         return result;
     }
@@ -724,7 +725,7 @@ public:
                 uint64_t count,
                 uint64_t config_id2 = noConfigId2,
                 bool fixUpClockCyclesEvent = fixUpClockCyclesEventDefault,
-                std::unordered_set<metrics::metric_group_id_t> metricGroups = {})
+                metrics::metric_group_set_t metricGroups = {})
         : PerfCounter(next, groupIdentifier, name, IPerfGroups::Attr {}, false, config_id2, fixUpClockCyclesEvent)
     {
         attr.type = type;
@@ -790,9 +791,7 @@ public:
 
     [[nodiscard]] bool supportsAtLeastOne(metrics::metric_group_set_t const & desired) const override
     {
-        return std::any_of(mMetricGroups.cbegin(), mMetricGroups.cend(), [&](auto const & metric_group_id) {
-            return desired.has_member(metric_group_id);
-        });
+        return desired.intersects(mMetricGroups);
     }
 
 private:
@@ -803,7 +802,7 @@ private:
     bool mUsesAux;
     // Where this PerfCounter represents a metric, this member represents
     // the groups it is a part of.
-    std::unordered_set<metrics::metric_group_id_t> mMetricGroups {};
+    metrics::metric_group_set_t mMetricGroups {};
 };
 
 class CPUFreqDriver : public PerfCounter {
@@ -1205,8 +1204,7 @@ void PerfDriver::addCpuCounterMetricsRecursive(const PerfCpu & perfCpu,
                   metrics_set.event_codes.size(),
                   metric_id.c_str());
 
-        std::unordered_set<metrics::metric_group_id_t> groups {metrics_set.groups};
-        groups.insert(entry.group);
+        auto groups = metrics::metric_group_set_t {metrics_set.groups}.set_union({entry.group});
 
         if ((cpu.getPmncCounters() > 0) && (metrics_set.event_codes.size() <= std::size_t(cpu.getPmncCounters()))) {
             setCounters(new PerfCounter(getCounters(),
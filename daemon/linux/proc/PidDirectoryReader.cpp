@@ -0,0 +1,122 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#include "linux/proc/PidDirectoryReader.h"
+
+#include "lib/AutoClosingFd.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace lnx {
+    namespace {
+        // The layout of struct linux_dirent64, which libc does not consistently declare
+        constexpr std::size_t dirent64_reclen_offset = 16;
+        constexpr std::size_t dirent64_type_offset = 18;
+        constexpr std::size_t dirent64_name_offset = 19;
+
+        // more digits than this cannot be a valid pid
+        constexpr std::size_t max_id_digits = 9;
+
+        /** @return The value of @a name if it consists only of digits, otherwise -1 */
+        int parseId(const char * name)
+        {
+            int result = 0;
+            std::size_t n = 0;
+
+            for (; name[n] != '\0'; ++n) {
+                if ((name[n] < '0') || (name[n] > '9') || (n >= max_id_digits)) {
+                    return -1;
+                }
+                result = (result * 10) + (name[n] - '0');
+            }
+
+            return (n > 0 ? result : -1);
+        }
+    }
+
+    lib::AutoClosingFd openDirectoryAt(int dirFd, const char * path)
+    {
+        int fd;
+        do {
+            fd = ::openat(dirFd, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        } while ((fd < 0) && (errno == EINTR));
+        return lib::AutoClosingFd {fd};
+    }
+
+    PidDirectoryReader::PidDirectoryReader(int dirFd, const char * path) : fd(openDirectoryAt(dirFd, path))
+    {
+    }
+
+    bool PidDirectoryReader::readBatch(std::vector<int> & ids, std::size_t maxCount)
+    {
+        ids.clear();
+
+        while ((ids.size() < maxCount) && fillBuffer()) {
+            const char * const record = buffer.data() + offset;
+
+            std::uint16_t recordLength;
+            std::memcpy(&recordLength, record + dirent64_reclen_offset, sizeof(recordLength));
+            offset += recordLength;
+
+            const auto type = static_cast<unsigned char>(record[dirent64_type_offset]);
+            const char * const name = record + dirent64_name_offset;
+
+            const int id = parseId(name);
+            if (id < 0) {
+                continue;
+            }
+
+            // procfs always reports the type, but be tolerant of anything that does not
+            if ((type == DT_DIR) || ((type == DT_UNKNOWN) && isDirectory(name))) {
+                ids.push_back(id);
+            }
+        }
+
+        return !ids.empty();
+    }
+
+    bool PidDirectoryReader::fillBuffer()
+    {
+        if (offset < length) {
+            return true;
+        }
+
+        if (endOfDirectory || !fd) {
+            return false;
+        }
+
+        while (true) {
+            // NOLINTNEXTLINE(bugprone-narrowing-conversions)
+            const long n = syscall(__NR_getdents64, *fd, buffer.data(), buffer.size());
+
+            if ((n < 0) && (errno == EINTR)) {
+                continue;
+            }
+
+            // error or end of directory
+            if (n <= 0) {
+                endOfDirectory = true;
+                return false;
+            }
+
+            offset = 0;
+            length = n;
+            return true;
+        }
+    }
+
+    bool PidDirectoryReader::isDirectory(const char * name) const
+    {
+        struct stat data;
+        return (fstatat(*fd, name, &data, AT_SYMLINK_NOFOLLOW) == 0) && S_ISDIR(data.st_mode);
+    }
+}
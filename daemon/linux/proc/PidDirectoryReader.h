@@ -0,0 +1,73 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#ifndef INCLUDE_LINUX_PROC_PIDDIRECTORYREADER_H
+#define INCLUDE_LINUX_PROC_PIDDIRECTORYREADER_H
+
+#include "lib/AutoClosingFd.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace lnx {
+    /**
+     * Open a directory for use as the base of openat / readlinkat etc.
+     *
+     * @param dirFd The directory that @a path is relative to (or AT_FDCWD)
+     * @return The directory fd, which is invalid if the directory could not be opened
+     */
+    lib::AutoClosingFd openDirectoryAt(int dirFd, const char * path);
+
+    /**
+     * Lists the numeric subdirectories of /proc or /proc/[PID]/task, i.e. the PIDs or TIDs.
+     *
+     * Entries are read in bulk with getdents64 and filtered on the d_type it reports, so unlike iterating with
+     * lib::FsEntryDirectoryIterator there is no stat and no path string per entry.
+     */
+    class PidDirectoryReader {
+    public:
+        /** The number of ids to visit per batch, when the caller has some per batch overhead to amortize */
+        static constexpr std::size_t DEFAULT_BATCH_SIZE = 64;
+
+        /**
+         * Open the directory to read
+         *
+         * @param dirFd The directory that @a path is relative to (or AT_FDCWD)
+         */
+        PidDirectoryReader(int dirFd, const char * path);
+
+        // Intentionally unimplemented
+        PidDirectoryReader(const PidDirectoryReader &) = delete;
+        PidDirectoryReader & operator=(const PidDirectoryReader &) = delete;
+        PidDirectoryReader(PidDirectoryReader &&) = delete;
+        PidDirectoryReader & operator=(PidDirectoryReader &&) = delete;
+        ~PidDirectoryReader() = default;
+
+        /** @return True if the directory was opened successfully */
+        [[nodiscard]] bool isOpen() const { return bool(fd); }
+
+        /** @return The fd of the directory being read, for use with openat etc. */
+        [[nodiscard]] int dirFd() const { return *fd; }
+
+        /**
+         * Replace the contents of @a ids with up to @a maxCount of the next ids in the directory
+         *
+         * @return False once there are no more ids to read (or if the directory could not be read)
+         */
+        bool readBatch(std::vector<int> & ids, std::size_t maxCount = DEFAULT_BATCH_SIZE);
+
+    private:
+        static constexpr std::size_t BUFFER_SIZE = 8192;
+
+        lib::AutoClosingFd fd;
+        std::array<char, BUFFER_SIZE> buffer {};
+        std::size_t offset = 0;
+        std::size_t length = 0;
+        bool endOfDirectory = false;
+
+        [[nodiscard]] bool fillBuffer();
+        [[nodiscard]] bool isDirectory(const char * name) const;
+    };
+}
+
+#endif /* INCLUDE_LINUX_PROC_PIDDIRECTORYREADER_H */
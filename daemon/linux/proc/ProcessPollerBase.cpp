@@ -1,19 +1,26 @@
-/* Copyright (C) 2017-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2017-2025 by Arm Limited. All rights reserved. */
 
 #include "linux/proc/ProcessPollerBase.h"
 
 #include "Logging.h"
+#include "lib/AutoClosingFd.h"
+#include "lib/File.h"
 #include "lib/FsEntry.h"
 #include "lib/String.h"
+#include "linux/proc/PidDirectoryReader.h"
 #include "linux/proc/ProcPidStatFileRecord.h"
 #include "linux/proc/ProcPidStatmFileRecord.h"
 
-#include <algorithm>
-#include <cctype>
-#include <cstdlib>
+#include <array>
+#include <climits>
+#include <cstdio>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace lnx {
     namespace {
@@ -31,13 +38,28 @@ namespace lnx {
             return str;
         }
 
+        /** Read the target of a symlink relative to some directory */
+        std::optional<std::string> readLinkAt(int dirFd, const char * name)
+        {
+            std::array<char, PATH_MAX> buffer;
+
+            auto const n = ::readlinkat(dirFd, name, buffer.data(), buffer.size());
+
+            // empty string and error are ignored
+            if (n <= 0) {
+                return {};
+            }
+
+            return std::string(buffer.data(), n);
+        }
+
         /**
          * Get the exe path for a process by reading /proc/[PID]/cmdline
          */
-        std::optional<std::string> getProcessCmdlineExePath(const lib::FsEntry & entry)
+        std::optional<std::string> getProcessCmdlineExePath(int pidDirFd)
         {
-            const lib::FsEntry cmdline_file = lib::FsEntry::create(entry, "cmdline");
-            const std::string cmdline_contents = lib::readFileContents(cmdline_file);
+            std::string cmdline_contents {};
+            (void) lib::readFileInto("cmdline", cmdline_contents, pidDirFd);
             // need to extract just the first part of cmdline_contents (as it is an packed sequence of c-strings)
             // so use .c_str() to extract the first string (which is the exe path) and create a new string from it
             std::string cmdline_exe =
@@ -48,7 +70,7 @@ namespace lnx {
             return std::nullopt;
         }
 
-        std::optional<std::string> checkExePathForAndroidAppProcess(const lib::FsEntry & proc_dir,
+        std::optional<std::string> checkExePathForAndroidAppProcess(int pidDirFd,
                                                                     std::optional<lib::FsEntry> && exe_realpath)
         {
             if (exe_realpath && exe_realpath->is_absolute()) {
@@ -56,7 +78,7 @@ namespace lnx {
                 auto name = exe_realpath->name();
                 if ((name == "app_process") || (name == "app_process32") || (name == "app_process64")) {
                     // use the command line instead
-                    auto cmdline_exe = getProcessCmdlineExePath(proc_dir);
+                    auto cmdline_exe = getProcessCmdlineExePath(pidDirFd);
                     if (cmdline_exe) {
                         return cmdline_exe;
                     }
@@ -70,44 +92,46 @@ namespace lnx {
         }
     }
 
-    bool isPidDirectory(const lib::FsEntry & entry)
+    std::optional<std::string> getProcessExePath(const lib::FsEntry & entry)
     {
-        // type must be directory
-        const lib::FsEntry::Stats stats = entry.read_stats();
-        if (stats.type() != lib::FsEntry::Type::DIR) {
-            return false;
+        const lib::AutoClosingFd pidDirFd = openDirectoryAt(AT_FDCWD, entry.path().c_str());
+        if (!pidDirFd) {
+            LOG_TRACE("[%s] Process directory not found", entry.name().c_str());
+            return {};
         }
 
-        // name must be only digits
-        const std::string name = entry.name();
-        return std::all_of(name.cbegin(), name.cend(), [](char c) { return std::isdigit(c); });
+        return getProcessExePath(*pidDirFd, entry);
     }
 
-    std::optional<std::string> getProcessExePath(const lib::FsEntry & entry)
+    std::optional<std::string> getProcessExePath(int pidDirFd, const lib::FsEntry & entry)
     {
         auto const pid_str = entry.name();
-        auto proc_pid_exe = lib::FsEntry::create(entry, "exe");
+        auto const exe_link = readLinkAt(pidDirFd, "exe");
 
-        // try realpath on 'exe'.. most of the time this will resolve to the canonical exe path
-        {
-            auto exe_realpath = checkExePathForAndroidAppProcess(entry, proc_pid_exe.realpath());
-            if (exe_realpath) {
-                LOG_TRACE("[%s] Detected exe '%s'", pid_str.c_str(), exe_realpath->c_str());
-                return exe_realpath;
+        if (exe_link) {
+            auto const exe_link_path = lib::FsEntry::create(*exe_link);
+
+            // try realpath on the 'exe' target.. most of the time this will resolve to the canonical exe path
+            {
+                auto exe_realpath = checkExePathForAndroidAppProcess(pidDirFd, exe_link_path.realpath());
+                if (exe_realpath) {
+                    LOG_TRACE("[%s] Detected exe '%s'", pid_str.c_str(), exe_realpath->c_str());
+                    return exe_realpath;
+                }
             }
-        }
 
-        // realpath failed, possibly because the canonical name is invalid (e.g. inaccessible file path); try the readlink value
-        {
-            auto exe_readlink = checkExePathForAndroidAppProcess(entry, proc_pid_exe.readlink());
-            if (exe_readlink) {
-                LOG_TRACE("[%s] Detected exe '%s'", pid_str.c_str(), exe_readlink->c_str());
-                return exe_readlink;
+            // realpath failed, possibly because the canonical name is invalid (e.g. inaccessible file path); try the readlink value
+            {
+                auto exe_readlink = checkExePathForAndroidAppProcess(pidDirFd, exe_link_path);
+                if (exe_readlink) {
+                    LOG_TRACE("[%s] Detected exe '%s'", pid_str.c_str(), exe_readlink->c_str());
+                    return exe_readlink;
+                }
             }
         }
 
         // exe was linked to nothing, try getting from cmdline (but it must be for a real file)
-        auto cmdline_exe = getProcessCmdlineExePath(entry);
+        auto cmdline_exe = getProcessCmdlineExePath(pidDirFd);
         if (!cmdline_exe) {
             LOG_TRACE("[%s] Detected is kernel thread", pid_str.c_str());
             // no cmdline, must be a kernel thread
@@ -148,8 +172,9 @@ namespace lnx {
         // we could not resolve exe or the command to a real path.
         // Since the exe_path value *must* contain something for any non-kernel PID,
         // then prefer to send 'comm' (so long as it is not an empty string)
-        auto comm_file = lib::FsEntry::create(entry, "comm");
-        auto comm_file_contents = trimInvalid(lib::readFileContents(comm_file));
+        std::string comm_file_contents {};
+        (void) lib::readFileInto("comm", comm_file_contents, pidDirFd);
+        comm_file_contents = trimInvalid(std::move(comm_file_contents));
         if (!comm_file_contents.empty()) {
             constexpr std::size_t max_comm_length = 15;
             // is it a package name?
@@ -172,7 +197,31 @@ namespace lnx {
         }
 
         // worst case just send /proc/<pid>/exe
-        return proc_pid_exe.path();
+        return lib::FsEntry::create(entry, "exe").path();
+    }
+
+    bool readThreadStatFiles(int dirFd,
+                             int tid,
+                             std::string & buffer,
+                             ProcPidStatFileRecord & statRecord,
+                             std::optional<ProcPidStatmFileRecord> & statmRecord)
+    {
+        // enough for "[TID]/statm"
+        std::array<char, 32> path;
+
+        statmRecord.emplace();
+
+        // open /proc/[PID]/statm
+        std::snprintf(path.data(), path.size(), "%d/statm", tid);
+        if (lib::readFileInto(path.data(), buffer, dirFd)
+            && !ProcPidStatmFileRecord::parseStatmFile(*statmRecord, buffer.c_str())) {
+            statmRecord.reset();
+        }
+
+        // open /proc/[PID]/stat
+        std::snprintf(path.data(), path.size(), "%d/stat", tid);
+        return lib::readFileInto(path.data(), buffer, dirFd)
+            && ProcPidStatFileRecord::parseStatFile(statRecord, buffer.c_str());
     }
 
     void ProcessPollerBase::IProcessPollerReceiver::onProcessDirectory(int /*unused*/, const lib::FsEntry & /*unused*/)
@@ -200,12 +249,12 @@ namespace lnx {
 
     void ProcessPollerBase::poll(bool wantThreads, bool wantStats, IProcessPollerReceiver & receiver)
     {
-        // scan directory /proc for all pid files
-        lib::FsEntryDirectoryIterator iterator = procDir.children();
+        // scan directory /proc for all pid directories
+        PidDirectoryReader procReader {AT_FDCWD, procDir.path().c_str()};
 
-        while (std::optional<lib::FsEntry> entry = iterator.next()) {
-            if (isPidDirectory(*entry)) {
-                processPidDirectory(wantThreads, wantStats, receiver, *entry);
+        while (procReader.readBatch(pids)) {
+            for (const int pid : pids) {
+                processPidDirectory(wantThreads, wantStats, receiver, procReader.dirFd(), pid);
             }
         }
     }
@@ -213,13 +262,19 @@ namespace lnx {
     void ProcessPollerBase::processPidDirectory(bool wantThreads,
                                                 bool wantStats,
                                                 IProcessPollerReceiver & receiver,
-                                                const lib::FsEntry & entry)
+                                                int procDirFd,
+                                                int pid)
     {
-        const auto name = entry.name();
-        const auto exe_path = getProcessExePath(entry);
+        const auto name = std::to_string(pid);
+
+        // the process may have exited since /proc was read
+        const lib::AutoClosingFd pidDirFd = openDirectoryAt(procDirFd, name.c_str());
+        if (!pidDirFd) {
+            return;
+        }
 
-        // read the pid
-        const long pid = std::strtol(name.c_str(), nullptr, 0);
+        const lib::FsEntry entry = lib::FsEntry::create(procDir, name);
+        const auto exe_path = getProcessExePath(*pidDirFd, entry);
 
         // call the receiver object
         receiver.onProcessDirectory(pid, entry);
@@ -227,23 +282,21 @@ namespace lnx {
         // process threads?
         if (wantThreads || wantStats) {
             // the /proc/[PID]/task directory
-            const lib::FsEntry task_directory = lib::FsEntry::create(entry, "task");
+            PidDirectoryReader taskReader {*pidDirFd, "task"};
 
-            // the /proc/[PID]/task/[PID]/ directory
-            const lib::FsEntry task_pid_directory = lib::FsEntry::create(task_directory, name);
-            const lib::FsEntry::Stats task_pid_directory_stats = task_pid_directory.read_stats();
-
-            // if for some reason taskPidDirectory does not exist, then use stat and statm in the procPid directory instead
-            if ((!task_pid_directory_stats.exists()) || (task_pid_directory_stats.type() != lib::FsEntry::Type::DIR)) {
-                processTidDirectory(wantStats, receiver, pid, entry, exe_path);
+            // if for some reason the task directory does not exist, then use stat and statm in the procPid directory instead
+            if (!taskReader.isOpen()) {
+                processTidDirectory(wantStats, receiver, procDirFd, pid, pid, entry, exe_path);
+                return;
             }
 
             // scan all the TIDs in the task directory
-            lib::FsEntryDirectoryIterator task_iterator = task_directory.children();
+            const std::string taskPath = entry.path() + "/task/";
 
-            while (std::optional<lib::FsEntry> task_entry = task_iterator.next()) {
-                if (isPidDirectory(*task_entry)) {
-                    processTidDirectory(wantStats, receiver, pid, *task_entry, exe_path);
+            while (taskReader.readBatch(tids)) {
+                for (const int tid : tids) {
+                    const lib::FsEntry taskEntry = lib::FsEntry::create(taskPath + std::to_string(tid));
+                    processTidDirectory(wantStats, receiver, taskReader.dirFd(), pid, tid, taskEntry, exe_path);
                 }
             }
         }
@@ -251,45 +304,22 @@ namespace lnx {
 
     void ProcessPollerBase::processTidDirectory(bool wantStats,
                                                 IProcessPollerReceiver & receiver,
-                                                const int pid,
+                                                int dirFd,
+                                                int pid,
+                                                int tid,
                                                 const lib::FsEntry & entry,
                                                 const std::optional<std::string> & exe)
     {
-        const long tid = std::strtol(entry.name().c_str(), nullptr, 0);
-
         // call the receiver object
         receiver.onThreadDirectory(pid, tid, entry);
 
         // process stats?
         if (wantStats) {
-            std::optional<ProcPidStatmFileRecord> statm_file_record {ProcPidStatmFileRecord()};
+            ProcPidStatFileRecord statRecord;
+            std::optional<ProcPidStatmFileRecord> statmRecord;
 
-            // open /proc/[PID]/statm
-            {
-                const lib::FsEntry statm_file = lib::FsEntry::create(entry, "statm");
-                const lib::FsEntry::Stats statm_file_stats = statm_file.read_stats();
-
-                if (statm_file_stats.exists() && statm_file_stats.type() == lib::FsEntry::Type::FILE) {
-                    const std::string statm_file_contents = lib::readFileContents(statm_file);
-
-                    if (!ProcPidStatmFileRecord::parseStatmFile(*statm_file_record, statm_file_contents.c_str())) {
-                        statm_file_record.reset();
-                    }
-                }
-            }
-
-            // open /proc/[PID]/stat
-            {
-                const lib::FsEntry stat_file = lib::FsEntry::create(entry, "stat");
-                const lib::FsEntry::Stats stat_file_stats = stat_file.read_stats();
-
-                if (stat_file_stats.exists() && stat_file_stats.type() == lib::FsEntry::Type::FILE) {
-                    const std::string stat_file_contents = lib::readFileContents(stat_file);
-                    ProcPidStatFileRecord stat_file_record;
-                    if (ProcPidStatFileRecord::parseStatFile(stat_file_record, stat_file_contents.c_str())) {
-                        receiver.onThreadDetails(pid, tid, stat_file_record, statm_file_record, exe);
-                    }
-                }
+            if (readThreadStatFiles(dirFd, tid, fileBuffer, statRecord, statmRecord)) {
+                receiver.onThreadDetails(pid, tid, statRecord, statmRecord, exe);
             }
         }
     }
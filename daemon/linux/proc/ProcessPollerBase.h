@@ -1,4 +1,4 @@
-/* Copyright (C) 2017-2022 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2017-2025 by Arm Limited. All rights reserved. */
 
 #ifndef INCLUDE_LINUX_PROC_PROCESSPOLLERBASE_H
 #define INCLUDE_LINUX_PROC_PROCESSPOLLERBASE_H
@@ -9,6 +9,8 @@
 #include "linux/proc/ProcPidStatmFileRecord.h"
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace lnx {
     /**
@@ -48,28 +50,52 @@ namespace lnx {
 
     private:
         lib::FsEntry procDir;
+        // reused to read each of the stat and statm files
+        std::string fileBuffer {};
+        // reused for each batch of ids read from /proc and /proc/[PID]/task
+        std::vector<int> pids {};
+        std::vector<int> tids {};
 
-        static void processPidDirectory(bool wantThreads,
-                                        bool wantStats,
-                                        IProcessPollerReceiver & receiver,
-                                        const lib::FsEntry & entry);
-        static void processTidDirectory(bool wantStats,
-                                        IProcessPollerReceiver & receiver,
-                                        int pid,
-                                        const lib::FsEntry & entry,
-                                        const std::optional<std::string> & exe);
+        void processPidDirectory(bool wantThreads,
+                                 bool wantStats,
+                                 IProcessPollerReceiver & receiver,
+                                 int procDirFd,
+                                 int pid);
+        void processTidDirectory(bool wantStats,
+                                 IProcessPollerReceiver & receiver,
+                                 int dirFd,
+                                 int pid,
+                                 int tid,
+                                 const lib::FsEntry & entry,
+                                 const std::optional<std::string> & exe);
     };
 
+    /** @return The process exe path (or some estimation of it). Empty if the thread is a kernel thread, otherwise contains 'something' */
+    std::optional<std::string> getProcessExePath(const lib::FsEntry & entry);
+
     /**
-     * Checks the name of the FsEntry to see if it is a number, and checks the type
-     * to see if it is a directory.
+     * As getProcessExePath(entry), but reads the files relative to an already open /proc/[PID] directory
      *
-     * @return True if criteria are met, false otherwise
+     * @param pidDirFd The open /proc/[PID] directory
+     * @param entry The path of the same directory
      */
-    bool isPidDirectory(const lib::FsEntry & entry);
+    std::optional<std::string> getProcessExePath(int pidDirFd, const lib::FsEntry & entry);
 
-    /** @return The process exe path (or some estimation of it). Empty if the thread is a kernel thread, otherwise contains 'something' */
-    std::optional<std::string> getProcessExePath(const lib::FsEntry & entry);
+    /**
+     * Read and parse the stat and statm files of a thread
+     *
+     * @param dirFd The open /proc/[PID]/task directory (or /proc, when there is no task directory)
+     * @param tid The subdirectory of @a dirFd containing the files
+     * @param buffer Reused to read the files into
+     * @param statRecord Receives the parsed stat file
+     * @param statmRecord Receives the parsed statm file, or is empty if it could not be parsed
+     * @return True if the stat file was read and parsed, false otherwise
+     */
+    bool readThreadStatFiles(int dirFd,
+                             int tid,
+                             std::string & buffer,
+                             ProcPidStatFileRecord & statRecord,
+                             std::optional<ProcPidStatmFileRecord> & statmRecord);
 }
 
 #endif /* INCLUDE_LINUX_PROC_PROCESSPOLLERBASE_H */
@@ -1,35 +1,85 @@
-/* Copyright (C) 2021-2023 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2021-2025 by Arm Limited. All rights reserved. */
+
+#define __STDC_FORMAT_MACROS // must be before includes
 
 #include "logging/agent_log.h"
 
 #include "Logging.h"
-#include "async/async_line_reader.hpp"
-#include "async/continuations/operations.h"
-#include "async/continuations/use_continuation.h"
 #include "lib/AutoClosingFd.h"
 #include "lib/Format.h"
 #include "lib/FsEntry.h"
-#include "lib/String.h"
+#include "logging/agent_log_record.h"
+#include "logging/log_ring.h"
 #include "logging/parameters.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <optional>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
 
 #include <fcntl.h>
+#include <limits.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 namespace logging {
     namespace {
-        constexpr std::string_view message_start_marker {"\x01"};
-        constexpr std::string_view message_end_marker {"\x04"};
-        constexpr std::string_view separator {"\x09"};
+        /** How often the drain thread runs when not explicitly woken */
+        constexpr std::chrono::milliseconds drain_interval {10};
+
+        /** Source of unique agent_logger_t ids */
+        std::atomic<std::uint64_t> next_logger_id {1};
+
+        /** The rate limiting state for one call site */
+        struct call_site_rate_t {
+            std::int64_t second;
+            std::uint32_t count;
+        };
+
+        /** Identifies a call site */
+        struct call_site_key_t {
+            char const * file;
+            std::uint32_t line;
+
+            [[nodiscard]] bool operator==(call_site_key_t const & that) const
+            {
+                return (file == that.file) && (line == that.line);
+            }
+        };
+
+        struct call_site_hash_t {
+            [[nodiscard]] std::size_t operator()(call_site_key_t const & key) const
+            {
+                return std::hash<char const *> {}(key.file) ^ (std::size_t(key.line) * 0x9e3779b97f4a7c15ULL);
+            }
+        };
+
+        /** The per-thread logging state */
+        struct thread_log_state_t {
+            std::uint64_t logger_id {0};
+            std::shared_ptr<log_ring_t> ring {};
+            std::unordered_map<call_site_key_t, call_site_rate_t, call_site_hash_t> rates {};
+        };
+
+        thread_local thread_log_state_t thread_log_state {};
 
         void write_bytes(int file_descriptor, std::string_view str)
         {
@@ -42,23 +92,17 @@ namespace logging {
             }
         }
 
-        void write(int file_descriptor, std::uint32_t n)
+        void append_number(std::string & buffer, char const * format, std::int64_t n)
         {
-            dprintf(file_descriptor, "%" PRIu32, n);
-        }
-        void write(int file_descriptor, std::int64_t n)
-        {
-            dprintf(file_descriptor, "%" PRId64, n);
-        }
-        void write(int file_descriptor, thread_id_t t)
-        {
-            dprintf(file_descriptor, "%" PRIi32, pid_t(t));
-        }
-        void write(int file_descriptor, log_level_t l)
-        {
-            write(file_descriptor, std::uint32_t(l));
+            std::array<char, 32> chars {};
+            auto const length = snprintf(chars.data(), chars.size(), format, n);
+            if (length > 0) {
+                buffer.append(chars.data(), std::min<std::size_t>(length, chars.size() - 1));
+            }
         }
-        void write(int file_descriptor, std::string_view str)
+
+        /** Append the string to the buffer, escaping any control characters so that it fits on a single line */
+        void append_escaped(std::string & buffer, std::string_view str)
         {
             std::size_t from = 0;
 
@@ -67,168 +111,67 @@ namespace logging {
                 // escape control characters
                 if ((chr < ' ') || (chr == '\\')) {
                     // output the preceeding chars in the message since the last escape/start
-                    if (from < pos) {
-                        write_bytes(file_descriptor, str.substr(from, pos - from));
-                    }
+                    buffer.append(str.substr(from, pos - from));
                     // encode the char
                     if (chr == '\\') {
-                        dprintf(file_descriptor, "\\\\");
+                        buffer.append("\\\\");
                     }
                     else if (chr == '\n') {
-                        dprintf(file_descriptor, "\\n");
+                        buffer.append("\\n");
                     }
                     else {
-                        dprintf(file_descriptor, "\\%03" PRIo32, std::uint32_t(std::uint8_t(chr)));
+                        std::array<char, 8> chars {};
+                        snprintf(chars.data(), chars.size(), "\\%03" PRIo32, std::uint32_t(std::uint8_t(chr)));
+                        buffer.append(chars.data());
                     }
                     from = pos + 1;
                 }
             }
 
             // output the remaining chars in the message since the last escape/start
-            if (from < str.size()) {
-                write_bytes(file_descriptor, str.substr(from));
-            }
+            buffer.append(str.substr(from));
         }
 
-        constexpr bool is_octal(char c)
+        /** Append the human readable TSV form of the record to the buffer */
+        void append_tsv(std::string & buffer, agent_log_record::decoded_record_t const & record)
         {
-            return (c >= '0') && (c < '8');
+            append_number(buffer, "%" PRId64, std::int64_t(record.level));
+            buffer.push_back('\t');
+            append_number(buffer, "%" PRId64, std::int64_t(record.tid));
+            buffer.push_back('\t');
+            append_escaped(buffer, record.file);
+            buffer.push_back('\t');
+            append_number(buffer, "%" PRId64, record.line_no);
+            buffer.push_back('\t');
+            append_number(buffer, "%" PRId64, record.timestamp.seconds);
+            buffer.push_back('\t');
+            append_number(buffer, "%" PRId64, record.timestamp.nanos);
+            buffer.push_back('\t');
+            append_escaped(buffer, record.message);
+            buffer.push_back('\n');
         }
 
-        std::optional<std::int64_t> decode_num(std::string_view s)
+        /** @return true if the record should be written straight away, rather than queued */
+        constexpr bool is_synchronous_level(log_level_t level)
         {
-            return lib::try_to_int<std::int64_t>(s);
+            return (level == log_level_t::error) || (level == log_level_t::fatal);
         }
 
-        std::optional<std::string_view> decode_str(char * start, char const * end)
+        /** @return true if the call site has not exceeded its rate limit */
+        bool check_rate_limit(thread_log_state_t & state,
+                              source_loc_t const & location,
+                              log_timestamp_t const & timestamp,
+                              std::uint32_t limit)
         {
-            constexpr std::uint8_t octal_base = 8;
-
-            char * write = start;
-            for (char * from = start; from < end;) {
-                // is it an escape sequence
-                if (*from == '\\') {
-                    // is it a numeric encoding?
-                    if ((from + 3) <= end) {
-                        char oct1 = from[1];
-                        char oct2 = from[2];
-                        char oct3 = from[3];
-
-                        if (is_octal(oct1) && is_octal(oct2) && is_octal(oct3)) {
-                            // decode char and replace
-                            *write++ = char(((oct1 - '0') * octal_base * octal_base) + ((oct2 - '0') * octal_base)
-                                            + (oct3 - '0'));
-                            from += 4;
-                            continue;
-                        }
-                    }
-
-                    // is it an 'n' or '\\'
-                    if ((from + 1) <= end) {
-                        if (from[1] == '\\') {
-                            // replace
-                            *write++ = '\\';
-                            from += 2;
-                            continue;
-                        }
-
-                        if (from[1] == 'n') {
-                            // replace
-                            *write++ = '\n';
-                            from += 2;
-                            continue;
-                        }
-                    }
-
-                    // none of the above, must be invalid
-                    return {};
-                }
+            auto & rate = state.rates[call_site_key_t {location.file_name().data(), location.line_no()}];
 
-                // a normal char
-                *write++ = *from++;
+            if (rate.second != timestamp.seconds) {
+                rate.second = timestamp.seconds;
+                rate.count = 0;
             }
 
-            return std::string_view(start, write - start);
+            return (++rate.count <= limit);
         }
-
-        std::optional<std::string_view> decode_str(std::string_view s)
-        {
-            // we can safely const cast here since we own the std::string that backs the view...
-            return decode_str(const_cast<char *>(s.data()), const_cast<char *>(s.data() + s.size()));
-        }
-
-        constexpr std::size_t expected_no_fields = 7;
-        constexpr std::size_t field_index_level = 0;
-        constexpr std::size_t field_index_tid = 1;
-        constexpr std::size_t field_index_file = 2;
-        constexpr std::size_t field_index_line = 3;
-        constexpr std::size_t field_index_secs = 4;
-        constexpr std::size_t field_index_nsec = 5;
-        constexpr std::size_t field_index_text = 6;
-
-        std::optional<std::array<std::string_view, expected_no_fields>> split_fields(std::string_view inner)
-        {
-            // between level and tid
-            auto from_1 = 0;
-            auto sep_1 = inner.find(separator, from_1);
-            if (sep_1 == std::string_view::npos) {
-                return {};
-            }
-            // between tid and file
-            auto from_2 = sep_1 + separator.size();
-            auto sep_2 = inner.find(separator, from_2);
-            if (sep_2 == std::string_view::npos) {
-                return {};
-            }
-            // between file and line
-            auto from_3 = sep_2 + separator.size();
-            auto sep_3 = inner.find(separator, from_3);
-            if (sep_3 == std::string_view::npos) {
-                return {};
-            }
-            // between line and seconds
-            auto from_4 = sep_3 + separator.size();
-            auto sep_4 = inner.find(separator, from_4);
-            if (sep_4 == std::string_view::npos) {
-                return {};
-            }
-            // between seconds and nsecs
-            auto from_5 = sep_4 + separator.size();
-            auto sep_5 = inner.find(separator, from_5);
-            if (sep_5 == std::string_view::npos) {
-                return {};
-            }
-            // between nsecs and message
-            auto from_6 = sep_5 + separator.size();
-            auto sep_6 = inner.find(separator, from_6);
-            if (sep_6 == std::string_view::npos) {
-                return {};
-            }
-
-            // extract the fields
-            auto level_str = inner.substr(from_1, sep_1 - from_1);
-            auto tid_str = inner.substr(from_2, sep_2 - from_2);
-            auto file_str = inner.substr(from_3, sep_3 - from_3);
-            auto line_str = inner.substr(from_4, sep_4 - from_4);
-            auto secs_str = inner.substr(from_5, sep_5 - from_5);
-            auto nsec_str = inner.substr(from_6, sep_6 - from_6);
-            auto text_str = inner.substr(sep_6 + separator.size());
-
-            if (level_str.empty() || tid_str.empty() || line_str.empty() || secs_str.empty() || nsec_str.empty()) {
-                return {};
-            }
-
-            return {{
-                level_str,
-                tid_str,
-                file_str,
-                line_str,
-                secs_str,
-                nsec_str,
-                text_str,
-            }};
-        }
-
     }
 
     lib::AutoClosingFd agent_logger_t::get_log_file_fd()
@@ -250,153 +193,288 @@ namespace logging {
                                         S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)};
     }
 
+    agent_logger_t::agent_logger_t(int pipe_fd, lib::AutoClosingFd log_file_descriptor)
+        : id(next_logger_id.fetch_add(1, std::memory_order_relaxed)),
+          pipe_fd(pipe_fd),
+          log_file_descriptor(std::move(log_file_descriptor)),
+          drain_thread([this]() { run_drain_thread(); })
+    {
+    }
+
+    agent_logger_t::~agent_logger_t() noexcept
+    {
+        {
+            std::lock_guard lock {wakeup_mutex};
+            terminated.store(true, std::memory_order_release);
+        }
+        wakeup_condition.notify_one();
+
+        if (drain_thread.joinable()) {
+            drain_thread.join();
+        }
+    }
+
     void agent_logger_t::log_item(thread_id_t tid,
                                   log_level_t level,
                                   log_timestamp_t const & timestamp,
                                   source_loc_t const & location,
                                   std::string_view message)
     {
-        // writing to the log must be serialized in a multithreaded environment
-        std::lock_guard lock {mutex};
-
-        // encode the message as a specially escaped and delimited line of text.
-        // The encoding leaves the message largely human readable, whilst ensuring it fits on a single line and is recognizable
-        // If any other (e.g. library, stl) code happens to printf to stderr, then it will not corrupt the output
-        // and the receiver should be able to pick up the log entries + any random output (which will be considered error logging)
-        write_bytes(pipe_fd, message_start_marker);
-        write(pipe_fd, level);
-        write_bytes(pipe_fd, separator);
-        write(pipe_fd, tid);
-        write_bytes(pipe_fd, separator);
-        write(pipe_fd, location.file_name());
-        write_bytes(pipe_fd, separator);
-        write(pipe_fd, location.line_no());
-        write_bytes(pipe_fd, separator);
-        write(pipe_fd, timestamp.seconds);
-        write_bytes(pipe_fd, separator);
-        write(pipe_fd, timestamp.nanos);
-        write_bytes(pipe_fd, separator);
-        write(pipe_fd, message);
-        write_bytes(pipe_fd, message_end_marker);
-        write_bytes(pipe_fd, "\n");
+        auto const file = location.file_name();
+        auto const size = agent_log_record::encoded_size(file.size(), message.size());
 
-        // optional human readable TSV formatted log file
-        if (log_file_descriptor) {
-            write(*log_file_descriptor, level);
-            write_bytes(*log_file_descriptor, "\t");
-            write(*log_file_descriptor, tid);
-            write_bytes(*log_file_descriptor, "\t");
-            write(*log_file_descriptor, location.file_name());
-            write_bytes(*log_file_descriptor, "\t");
-            write(*log_file_descriptor, location.line_no());
-            write_bytes(*log_file_descriptor, "\t");
-            write(*log_file_descriptor, timestamp.seconds);
-            write_bytes(*log_file_descriptor, "\t");
-            write(*log_file_descriptor, timestamp.nanos);
-            write_bytes(*log_file_descriptor, "\t");
-            write(*log_file_descriptor, message);
-            write_bytes(*log_file_descriptor, "\n");
+        // errors are written straight away so that they are not lost if the process then terminates
+        if (is_synchronous_level(level)) {
+            return write_synchronously(tid, level, timestamp, location, message);
+        }
+
+        auto & ring = get_thread_ring();
+
+        // too big to queue
+        if (size > ring.max_record_size()) {
+            return write_synchronously(tid, level, timestamp, location, message);
+        }
+
+        if (!check_rate_limit(thread_log_state, location, timestamp, max_records_per_call_site)) {
+            dropped_records.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        char * const record = ring.try_reserve(size);
+        if (record == nullptr) {
+            dropped_records.fetch_add(1, std::memory_order_relaxed);
+            request_drain();
+            return;
+        }
+
+        agent_log_record::encode(record, tid, level, timestamp, file, location.line_no(), message);
+        ring.commit();
+
+        // don't wait for the next interval if the ring is filling up
+        if (ring.used() > (ring.capacity() / 2)) {
+            request_drain();
         }
     }
 
-    void agent_log_reader_t::do_async_read()
+    log_ring_t & agent_logger_t::get_thread_ring()
     {
-        using namespace async::continuations;
-
-        spawn("agent-log-reader",
-              async::async_consume_all_lines(
-                  line_reader,
-                  [st = shared_from_this()](std::string_view line) {
-                      // process line of text
-                      st->do_process_next_line(line);
-                  },
-                  use_continuation));
+        auto & state = thread_log_state;
+
+        if ((state.logger_id != id) || (state.ring == nullptr)) {
+            auto ring = std::make_shared<log_ring_t>(ring_capacity);
+            {
+                std::lock_guard lock {rings_mutex};
+                rings.emplace_back(ring);
+            }
+            state.logger_id = id;
+            state.ring = std::move(ring);
+        }
+
+        return *state.ring;
     }
 
-    void agent_log_reader_t::do_process_next_line(std::string_view line)
+    void agent_logger_t::request_drain()
     {
-        constexpr std::size_t expected_minimum_size = message_start_marker.size() //
-                                                    + 1                           // level (int)
-                                                    + separator.size()            //
-                                                    + 1                           // tid (int)
-                                                    + separator.size()            //
-                                                    + 0                           // file (str)
-                                                    + separator.size()            //
-                                                    + 1                           // line (int)
-                                                    + separator.size()            //
-                                                    + 1                           // seconds (int)
-                                                    + separator.size()            //
-                                                    + 1                           // nsec (int)
-                                                    + separator.size()            //
-                                                    + 0                           // message (str)
-                                                    + message_end_marker.size();
-
-        // empty substr means no marker, get more bytes
-        if (line.empty()) {
-            LOG_TRACE("(%p) No end of line found", this);
-            return do_async_read();
+        if (!drain_requested.exchange(true, std::memory_order_acq_rel)) {
+            wakeup_condition.notify_one();
         }
+    }
 
-        // remove trailing newline (turn it into a null terminator instead so that it can be used with printf)
-        if (line.back() == '\n') {
-            const_cast<char &>(line.back()) = 0;
-            line.remove_suffix(1);
+    void agent_logger_t::run_drain_thread()
+    {
+        while (!terminated.load(std::memory_order_acquire)) {
+            {
+                std::unique_lock lock {wakeup_mutex};
+                wakeup_condition.wait_for(lock, drain_interval, [this]() {
+                    return drain_requested.load(std::memory_order_acquire)
+                        || terminated.load(std::memory_order_acquire);
+                });
+            }
+            drain_requested.store(false, std::memory_order_release);
+
+            std::lock_guard lock {drain_mutex};
+            drain_locked();
         }
 
-        // ignore empty lines
-        if (line.empty()) {
-            LOG_TRACE("(%p) Ignoring empty line", this);
-            return do_async_read();
+        // final drain, once everything else has stopped
+        std::lock_guard lock {drain_mutex};
+        drain_locked();
+    }
+
+    void agent_logger_t::drain_locked()
+    {
+        {
+            std::lock_guard lock {rings_mutex};
+
+            for (auto & ring : rings) {
+                ring->consume([this](std::string_view record) { append_record_locked(record); });
+            }
+
+            // forget the rings of any thread that has exited
+            auto const is_orphaned = [](auto const & ring) { return (ring.use_count() == 1) && (ring->used() == 0); };
+            rings.erase(std::remove_if(rings.begin(), rings.end(), is_orphaned), rings.end());
         }
 
-        // must have a minimum size
-        if (line.size() < expected_minimum_size) {
-            return do_unexpected_message(line);
+        // report any dropped records
+        auto const dropped = dropped_records.load(std::memory_order_relaxed);
+        if (dropped != reported_dropped_records) {
+            auto const message = std::string(lib::Format() << (dropped - reported_dropped_records)
+                                                           << " log records were dropped (" << dropped
+                                                           << " in total)");
+            reported_dropped_records = dropped;
+
+            struct timespec t;
+            clock_gettime(CLOCK_MONOTONIC, &t);
+
+            std::string record(agent_log_record::encoded_size(0, message.size()), '\0');
+            agent_log_record::encode(record.data(),
+                                     thread_id_t(syscall(SYS_gettid)),
+                                     log_level_t::warning,
+                                     {t.tv_sec, t.tv_nsec},
+                                     {},
+                                     0,
+                                     message);
+            append_record_locked(record);
         }
 
-        // does it start with the marker?
-        if (line.substr(0, message_start_marker.size()) != message_start_marker) {
-            // no, just a normal line of text
-            return do_unexpected_message(line);
+        flush_pipe_locked();
+
+        if (log_file_descriptor && !file_buffer.empty()) {
+            write_bytes(*log_file_descriptor, file_buffer);
+            file_buffer.clear();
         }
+    }
 
-        // does it end with the marker?
-        if (line.substr(line.size() - message_end_marker.size()) != message_end_marker) {
-            // no, just a normal line of text
-            return do_unexpected_message(line);
+    void agent_logger_t::append_record_locked(std::string_view record)
+    {
+        // keep each write within PIPE_BUF where possible, so that it is atomic with respect to any other writes
+        // to stderr that are not log records
+        if ((!pipe_buffer.empty()) && ((pipe_buffer.size() + record.size()) > PIPE_BUF)) {
+            flush_pipe_locked();
         }
+        pipe_buffer.append(record);
 
-        // find the separators and split the fields
-        auto inner = line.substr(message_start_marker.size(),
-                                 line.size() - (message_start_marker.size() + message_end_marker.size()));
+        // optional human readable TSV formatted log file
+        if (log_file_descriptor) {
+            agent_log_record::decoded_record_t decoded {};
+            std::size_t size = 0;
+            if (agent_log_record::decode(record, decoded, size) == agent_log_record::decode_result_t::complete) {
+                append_tsv(file_buffer, decoded);
+            }
+        }
+    }
 
-        auto fields_opt = split_fields(inner);
-        if (!fields_opt) {
-            // no, just a normal line of text
-            return do_unexpected_message(line);
+    void agent_logger_t::flush_pipe_locked()
+    {
+        if (!pipe_buffer.empty()) {
+            write_bytes(pipe_fd, pipe_buffer);
+            pipe_buffer.clear();
         }
+    }
+
+    void agent_logger_t::write_synchronously(thread_id_t tid,
+                                             log_level_t level,
+                                             log_timestamp_t const & timestamp,
+                                             source_loc_t const & location,
+                                             std::string_view message)
+    {
+        auto const file = location.file_name();
 
-        // decode the fields
-        auto & fields = *fields_opt;
-        auto level_num = decode_num(fields[field_index_level]);
-        auto tid_num = decode_num(fields[field_index_tid]);
-        auto file = decode_str(fields[field_index_file]);
-        auto line_num = decode_num(fields[field_index_line]);
-        auto secs_num = decode_num(fields[field_index_secs]);
-        auto nsec_num = decode_num(fields[field_index_nsec]);
-        auto text = decode_str(fields[field_index_text]);
-
-        // all fields must be valid
-        if ((!level_num) || (!tid_num) || (!file) || (!line_num) || (!secs_num) || (!nsec_num) || (!text)) {
-            return do_unexpected_message(line);
+        std::lock_guard lock {drain_mutex};
+
+        // anything already queued must be written first
+        drain_locked();
+
+        std::string record(agent_log_record::encoded_size(file.size(), message.size()), '\0');
+        agent_log_record::encode(record.data(), tid, level, timestamp, file, location.line_no(), message);
+        append_record_locked(record);
+
+        flush_pipe_locked();
+        if (log_file_descriptor && !file_buffer.empty()) {
+            write_bytes(*log_file_descriptor, file_buffer);
+            file_buffer.clear();
+        }
+    }
+
+    void agent_log_reader_t::do_async_read()
+    {
+        // move any partial record to the start of the buffer
+        if (buffer_begin > 0) {
+            std::memmove(buffer.data(), buffer.data() + buffer_begin, buffer_end - buffer_begin);
+            buffer_end -= buffer_begin;
+            buffer_begin = 0;
         }
 
-        // a valid message
-        return do_expected_message(thread_id_t(*tid_num),
-                                   log_level_t(*level_num),
-                                   log_timestamp_t {*secs_num, *nsec_num},
-                                   source_loc_t {*file, unsigned(*line_num)},
-                                   *text);
+        stream_descriptor.async_read_some(
+            boost::asio::buffer(buffer.data() + buffer_end, buffer.size() - buffer_end),
+            [st = shared_from_this()](boost::system::error_code const & ec, std::size_t n) {
+                if (ec) {
+                    if (ec != boost::asio::error::eof) {
+                        LOG_DEBUG("Read failed with %s", ec.message().c_str());
+                    }
+                    // process whatever remains
+                    return st->do_process_received(true);
+                }
+
+                st->buffer_end += n;
+                st->do_process_received(false);
+                st->do_async_read();
+            });
+    }
+
+    void agent_log_reader_t::do_process_received(bool is_eof)
+    {
+        while (buffer_begin < buffer_end) {
+            auto const received = std::string_view(buffer.data() + buffer_begin, buffer_end - buffer_begin);
+
+            if (received.front() == agent_log_record::record_start_marker) {
+                agent_log_record::decoded_record_t record {};
+                std::size_t size = 0;
+
+                auto const result = agent_log_record::decode(received, record, size);
+
+                if (result == agent_log_record::decode_result_t::complete) {
+                    buffer_begin += size;
+                    do_expected_message(record.tid,
+                                        record.level,
+                                        record.timestamp,
+                                        source_loc_t {record.file, record.line_no},
+                                        record.message);
+                    continue;
+                }
+
+                if ((result == agent_log_record::decode_result_t::incomplete) && !is_eof) {
+                    // make sure the buffer is big enough for the whole record
+                    if (size > buffer.size()) {
+                        buffer.resize(size);
+                    }
+                    return;
+                }
+
+                // otherwise it is not a valid record, so treat it as text
+            }
+
+            // some other output; consume it up to the end of the line, or the start of the next record
+            auto const end_of_text = std::min(received.find('\n'),
+                                              received.find(agent_log_record::record_start_marker, 1));
+
+            if ((end_of_text == std::string_view::npos) && (!is_eof) && (buffer_end < buffer.size())) {
+                // wait for the rest of the line
+                return;
+            }
+
+            auto const text_size = std::min(end_of_text, received.size());
+            auto text = received.substr(0, text_size);
+            buffer_begin += text_size;
+
+            if ((buffer_begin < buffer_end) && (buffer[buffer_begin] == '\n')) {
+                buffer_begin += 1;
+            }
+
+            if (!text.empty()) {
+                do_unexpected_message(text);
+            }
+        }
     }
 
     void agent_log_reader_t::do_unexpected_message(std::string_view msg)
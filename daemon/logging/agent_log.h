@@ -1,32 +1,57 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
-#include "async/async_line_reader.hpp"
 #include "lib/AutoClosingFd.h"
+#include "logging/log_ring.h"
 #include "logging/logger_t.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <iostream>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/posix/stream_descriptor.hpp>
 
 namespace logging {
-    /** Implements logger_t for agent sub-processes that log out via the IPC channel */
+    /**
+     * Implements logger_t for agent sub-processes that log out via the IPC channel.
+     *
+     * Log records are encoded in the agent_log_record binary format into a lock-free ring owned by the calling
+     * thread, and a background thread drains the rings to the pipe (and optional log file). Error and fatal records
+     * (and any record too large for the ring) are written synchronously, along with anything already queued, so
+     * that they are not lost if the process then terminates.
+     *
+     * Each call site is limited to a maximum number of records per second, per thread. Records that are rate
+     * limited, or that are discarded because the ring is full, are counted and reported periodically.
+     */
     class agent_logger_t : public logger_t {
     public:
+        /** The size of each thread's ring */
+        static constexpr std::size_t ring_capacity = 128 * 1024;
+        /** The maximum number of records per second from any one call site, on any one thread */
+        static constexpr std::uint32_t max_records_per_call_site = 1000;
+
         /** Allocate an optional log file fd for this process */
         static lib::AutoClosingFd get_log_file_fd();
 
-        explicit agent_logger_t(int pipe_fd, lib::AutoClosingFd log_file_descriptor = {})
-            : pipe_fd(pipe_fd), log_file_descriptor(std::move(log_file_descriptor))
-        {
-        }
+        explicit agent_logger_t(int pipe_fd, lib::AutoClosingFd log_file_descriptor = {});
+
+        // Intentionally unimplemented
+        agent_logger_t(agent_logger_t const &) = delete;
+        agent_logger_t & operator=(agent_logger_t const &) = delete;
+        agent_logger_t(agent_logger_t &&) = delete;
+        agent_logger_t & operator=(agent_logger_t &&) = delete;
+
+        ~agent_logger_t() noexcept override;
 
         /** Toggle whether TRACE/DEBUG/SETUP messages are output to the console */
         void set_debug_enabled(bool /*enabled*/) override { /*ignored*/ }
@@ -41,16 +66,58 @@ namespace logging {
                       source_loc_t const & location,
                       std::string_view message) override;
 
+        /** @return the number of log records that were dropped, either due to rate limiting or a full ring */
+        [[nodiscard]] std::uint64_t get_dropped_records() const
+        {
+            return dropped_records.load(std::memory_order_relaxed);
+        }
+
     private:
-        /** To protect against concurrect modifications */
-        mutable std::mutex mutex;
+        /** Uniquely identifies this logger, so that thread local state can tell when the logger has changed */
+        std::uint64_t const id;
         /** The file descriptor to write to */
         int pipe_fd;
         /** The additional log file descriptor */
         lib::AutoClosingFd log_file_descriptor;
+        /** The rings for all threads that have logged something; protected by rings_mutex */
+        std::vector<std::shared_ptr<log_ring_t>> rings {};
+        std::mutex rings_mutex {};
+        /** Serializes draining the rings and writing to the outputs */
+        std::mutex drain_mutex {};
+        /** The encoded data to write to the pipe / log file; protected by drain_mutex */
+        std::string pipe_buffer {};
+        std::string file_buffer {};
+        /** The number of dropped records at the last time they were reported; protected by drain_mutex */
+        std::uint64_t reported_dropped_records {0};
+        /** For waking the drain thread */
+        std::mutex wakeup_mutex {};
+        std::condition_variable wakeup_condition {};
+        std::atomic<bool> drain_requested {false};
+        std::atomic<bool> terminated {false};
+        std::atomic<std::uint64_t> dropped_records {0};
+        std::thread drain_thread;
+
+        /** The body of the drain thread */
+        void run_drain_thread();
+        /** Wake the drain thread */
+        void request_drain();
+        /** @return the ring for the calling thread */
+        log_ring_t & get_thread_ring();
+        /** Drain all rings, and then write out the buffers; must hold drain_mutex */
+        void drain_locked();
+        /** Add an encoded record to the output buffers; must hold drain_mutex */
+        void append_record_locked(std::string_view record);
+        /** Write out the buffered pipe data; must hold drain_mutex */
+        void flush_pipe_locked();
+        /** Write a record directly (after draining anything already queued) */
+        void write_synchronously(thread_id_t tid,
+                                 log_level_t level,
+                                 log_timestamp_t const & timestamp,
+                                 source_loc_t const & location,
+                                 std::string_view message);
     };
 
-    /** An async reader of lines of agent log */
+    /** An async reader of agent log records */
     class agent_log_reader_t : public std::enable_shared_from_this<agent_log_reader_t> {
     public:
         using consumer_fn_t =
@@ -68,21 +135,24 @@ namespace logging {
         }
 
         agent_log_reader_t(boost::asio::io_context & io_context, lib::AutoClosingFd && fd, consumer_fn_t consumer)
-            : consumer(std::move(consumer)),
-              line_reader(std::make_shared<async::async_line_reader_t>(
-                  boost::asio::posix::stream_descriptor {io_context, fd.release()}))
+            : consumer(std::move(consumer)), stream_descriptor(io_context, fd.release()), buffer(initial_buffer_size)
         {
         }
 
     private:
+        static constexpr std::size_t initial_buffer_size = 64 * 1024;
+
         consumer_fn_t consumer;
-        std::shared_ptr<async::async_line_reader_t> line_reader;
+        boost::asio::posix::stream_descriptor stream_descriptor;
+        std::vector<char> buffer;
+        std::size_t buffer_begin {0};
+        std::size_t buffer_end {0};
 
-        /** Read the next line of data from the stream */
+        /** Read more data from the stream */
         void do_async_read();
 
-        /** Process the received line */
-        void do_process_next_line(std::string_view line);
+        /** Process the received bytes */
+        void do_process_received(bool is_eof);
 
         /** Handle the line having an unexpected format */
         void do_unexpected_message(std::string_view msg);
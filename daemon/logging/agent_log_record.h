@@ -0,0 +1,150 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include "logging/parameters.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace logging {
+    /**
+     * The binary encoding of a log record, as sent from an agent process to the shell on the agent's stderr.
+     *
+     * Each record is `record_start_marker`, a record_header_t, the file name, the message text, and then
+     * `record_end_marker`. The markers allow any other (e.g. library) output on stderr to be told apart from
+     * log records, in which case it is treated as error logging.
+     *
+     * Both ends of the pipe are always the same build of gatord on the same machine, so the header is in native
+     * byte order.
+     */
+    namespace agent_log_record {
+        constexpr char record_start_marker = '\x02';
+        constexpr char record_end_marker = '\x04';
+
+        /** Records larger than this are assumed to be corrupt */
+        constexpr std::size_t max_record_size = 16 * 1024 * 1024;
+
+        struct record_header_t {
+            std::uint32_t file_size;
+            std::uint32_t message_size;
+            std::int64_t seconds;
+            std::int64_t nanos;
+            std::int32_t tid;
+            std::uint32_t line_no;
+            std::uint8_t level;
+        };
+
+        /** @return the encoded size of a record */
+        constexpr std::size_t encoded_size(std::size_t file_size, std::size_t message_size)
+        {
+            return 1 + sizeof(record_header_t) + file_size + message_size + 1;
+        }
+
+        /** The decoded form of a record; the strings point into the decoded buffer */
+        struct decoded_record_t {
+            thread_id_t tid;
+            log_level_t level;
+            log_timestamp_t timestamp;
+            std::string_view file;
+            std::uint32_t line_no;
+            std::string_view message;
+        };
+
+        /**
+         * Encode a record into `buffer`, which must have at least encoded_size(file.size(), message.size()) bytes
+         *
+         * @return the number of bytes written
+         */
+        inline std::size_t encode(char * buffer,
+                                  thread_id_t tid,
+                                  log_level_t level,
+                                  log_timestamp_t const & timestamp,
+                                  std::string_view file,
+                                  std::uint32_t line_no,
+                                  std::string_view message)
+        {
+            record_header_t const header {
+                std::uint32_t(file.size()),
+                std::uint32_t(message.size()),
+                timestamp.seconds,
+                timestamp.nanos,
+                std::int32_t(tid),
+                line_no,
+                std::uint8_t(level),
+            };
+
+            char * out = buffer;
+            *out++ = record_start_marker;
+            std::memcpy(out, &header, sizeof(header));
+            out += sizeof(header);
+            std::memcpy(out, file.data(), file.size());
+            out += file.size();
+            std::memcpy(out, message.data(), message.size());
+            out += message.size();
+            *out++ = record_end_marker;
+
+            return out - buffer;
+        }
+
+        enum class decode_result_t {
+            /** A whole record was decoded */
+            complete,
+            /** The bytes so far are the start of a valid record, but more are needed */
+            incomplete,
+            /** The bytes are not a valid record */
+            invalid,
+        };
+
+        /**
+         * Decode one record from the start of `bytes`
+         *
+         * @param bytes The received bytes, starting with record_start_marker
+         * @param record Receives the decoded record
+         * @param size Receives the number of bytes used (when complete), or needed (when incomplete)
+         */
+        inline decode_result_t decode(std::string_view bytes, decoded_record_t & record, std::size_t & size)
+        {
+            if (bytes.empty() || (bytes[0] != record_start_marker)) {
+                return decode_result_t::invalid;
+            }
+
+            if (bytes.size() < (1 + sizeof(record_header_t))) {
+                size = 1 + sizeof(record_header_t);
+                return decode_result_t::incomplete;
+            }
+
+            record_header_t header;
+            std::memcpy(&header, bytes.data() + 1, sizeof(header));
+
+            if ((header.level > std::uint8_t(log_level_t::child_stderr))
+                || ((std::size_t(header.file_size) + header.message_size) > max_record_size)) {
+                return decode_result_t::invalid;
+            }
+
+            size = encoded_size(header.file_size, header.message_size);
+            if (bytes.size() < size) {
+                return decode_result_t::incomplete;
+            }
+
+            if (bytes[size - 1] != record_end_marker) {
+                return decode_result_t::invalid;
+            }
+
+            auto const strings = bytes.substr(1 + sizeof(record_header_t));
+
+            record = decoded_record_t {
+                thread_id_t(header.tid),
+                log_level_t(header.level),
+                log_timestamp_t {header.seconds, header.nanos},
+                strings.substr(0, header.file_size),
+                header.line_no,
+                strings.substr(header.file_size, header.message_size),
+            };
+
+            return decode_result_t::complete;
+        }
+    }
+}
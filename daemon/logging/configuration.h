@@ -1,8 +1,9 @@
-/* Copyright (C) 2023-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2023-2025 by Arm Limited. All rights reserved. */
 
 #include "logging/logger_t.h"
 
 #include <memory>
+#include <string_view>
 
 namespace logging {
     /**
@@ -14,4 +15,22 @@ namespace logging {
 
     /** Enable trace logging (which also enables debug) */
     void set_log_enable_trace(bool enabled) noexcept;
+
+    /** The environment variable containing the runtime per-module log filter */
+    constexpr char const * log_filter_env_var = "GATORD_LOG_FILTER";
+
+    /**
+     * Set the runtime per-module filter for the verbose (trace, debug and fine) log levels.
+     *
+     * The spec is a comma separated list of `<module>=<level>` rules, where the module is a source directory such as
+     * `agents/perf` and the level is one of trace, debug, fine or info. Items logged from a source file within the
+     * module at a level below the given level are discarded before formatting; where more than one rule matches, the
+     * longest module wins. For example `agents/armnn=trace,agents/perf=info` enables trace for the armnn agent and
+     * disables debug for the perf agent. Source files not covered by any rule use the default (trace if enabled,
+     * otherwise debug), and call sites compiled out by CONFIG_LOG_MIN_LEVEL cannot be re-enabled.
+     */
+    void set_log_module_filter(std::string_view spec);
+
+    /** Set the runtime per-module filter from the GATORD_LOG_FILTER environment variable, if it is set */
+    void set_log_module_filter_from_env();
 }
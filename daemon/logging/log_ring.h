@@ -0,0 +1,140 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace logging {
+    /**
+     * A lock-free, single producer / single consumer ring of variable sized records.
+     *
+     * Each record is stored contiguously, prefixed by its size. Where a record will not fit in the space remaining
+     * before the end of the buffer, a wrap marker is written and the record starts again at the beginning.
+     */
+    class log_ring_t {
+    public:
+        explicit log_ring_t(std::size_t capacity) : buffer(capacity) {}
+
+        /** @return the largest record that can be stored */
+        [[nodiscard]] std::size_t max_record_size() const { return (buffer.size() / 2) - prefix_size; }
+
+        /**
+         * Reserve space for a record (producer only). If successful, the caller must write the record into the
+         * returned pointer and then call commit().
+         *
+         * @return a pointer to `size` bytes, or nullptr if there is not enough space
+         */
+        [[nodiscard]] char * try_reserve(std::size_t size)
+        {
+            if (size > max_record_size()) {
+                return nullptr;
+            }
+
+            auto const capacity = buffer.size();
+            auto const current_head = head.load(std::memory_order_relaxed);
+            auto const available = capacity - (current_head - tail.load(std::memory_order_acquire));
+            auto const offset = current_head % capacity;
+            auto const to_end = capacity - offset;
+            auto const needed = prefix_size + size;
+
+            if (needed <= to_end) {
+                if (needed > available) {
+                    return nullptr;
+                }
+                write_prefix(offset, size);
+                pending_head = current_head + needed;
+                return buffer.data() + offset + prefix_size;
+            }
+
+            // must wrap to the start of the buffer
+            if ((to_end + needed) > available) {
+                return nullptr;
+            }
+            if (to_end >= prefix_size) {
+                write_prefix(offset, wrap_marker);
+            }
+            write_prefix(0, size);
+            pending_head = current_head + to_end + needed;
+            return buffer.data() + prefix_size;
+        }
+
+        /** Publish the record written into the space returned by try_reserve (producer only) */
+        void commit() { head.store(pending_head, std::memory_order_release); }
+
+        /** @return the number of bytes currently in use */
+        [[nodiscard]] std::size_t used() const
+        {
+            return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed);
+        }
+
+        /** @return the total capacity of the ring */
+        [[nodiscard]] std::size_t capacity() const { return buffer.size(); }
+
+        /**
+         * Pass each available record to the consumer, in order (consumer only)
+         *
+         * @param consumer Some callable of the form `void(std::string_view)`
+         */
+        template<typename Consumer>
+        void consume(Consumer && consumer)
+        {
+            auto const capacity = buffer.size();
+            auto current_tail = tail.load(std::memory_order_relaxed);
+            auto const current_head = head.load(std::memory_order_acquire);
+
+            while (current_tail < current_head) {
+                auto const offset = current_tail % capacity;
+                auto const to_end = capacity - offset;
+
+                if (to_end < prefix_size) {
+                    current_tail += to_end;
+                    continue;
+                }
+
+                auto const size = read_prefix(offset);
+                if (size == wrap_marker) {
+                    current_tail += to_end;
+                    continue;
+                }
+
+                consumer(std::string_view(buffer.data() + offset + prefix_size, size));
+                current_tail += prefix_size + size;
+            }
+
+            tail.store(current_tail, std::memory_order_release);
+        }
+
+    private:
+        using prefix_type = std::uint32_t;
+
+        static constexpr std::size_t prefix_size = sizeof(prefix_type);
+        static constexpr prefix_type wrap_marker = std::numeric_limits<prefix_type>::max();
+
+        std::vector<char> buffer;
+        /** Total bytes produced; written by the producer */
+        alignas(64) std::atomic<std::uint64_t> head {0};
+        /** Total bytes consumed; written by the consumer */
+        alignas(64) std::atomic<std::uint64_t> tail {0};
+        /** The head value to publish on commit */
+        std::uint64_t pending_head {0};
+
+        void write_prefix(std::size_t offset, std::size_t value)
+        {
+            auto const prefix = prefix_type(value);
+            std::memcpy(buffer.data() + offset, &prefix, prefix_size);
+        }
+
+        [[nodiscard]] std::size_t read_prefix(std::size_t offset) const
+        {
+            prefix_type prefix;
+            std::memcpy(&prefix, buffer.data() + offset, prefix_size);
+            return prefix;
+        }
+    };
+}
@@ -1,4 +1,4 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 #include "Logging.h"
 
@@ -6,12 +6,20 @@
 #include "logging/logger_t.h"
 #include "logging/parameters.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <sys/syscall.h>
 #include <sys/types.h>
@@ -28,10 +36,70 @@
 namespace logging {
     namespace {
         std::shared_ptr<logger_t> current_logger {};
+
+        /** A runtime filter rule, setting the minimum level for all source files under some directory */
+        struct module_filter_t {
+            std::string module;
+            log_level_t min_level;
+        };
+
+        std::mutex module_filters_mutex {};
+        std::vector<module_filter_t> module_filters {};
+
+        std::atomic<bool> enabled_log_trace {false};
+
+        std::optional<log_level_t> parse_filter_level(std::string_view name)
+        {
+            if (name == "trace") {
+                return log_level_t::trace;
+            }
+            if (name == "debug") {
+                return log_level_t::debug;
+            }
+            if (name == "fine") {
+                return log_level_t::fine;
+            }
+            if (name == "info") {
+                return log_level_t::info;
+            }
+            return {};
+        }
+
+        /** @return true if `file` is within the directory `module` (e.g. 'agents/perf') */
+        bool is_in_module(std::string_view file, std::string_view module)
+        {
+            for (auto pos = file.find(module); pos != std::string_view::npos; pos = file.find(module, pos + 1)) {
+                auto const end = pos + module.size();
+                if (((pos == 0) || (file[pos - 1] == '/')) && (end < file.size()) && (file[end] == '/')) {
+                    return true;
+                }
+            }
+            return false;
+        }
     }
 
     namespace detail {
-        bool enabled_log_trace = false;
+        std::atomic<std::uint32_t> log_filter_generation {1};
+
+        log_level_t lookup_min_log_level(char const * file) noexcept
+        {
+            auto const default_level = (enabled_log_trace.load(std::memory_order_relaxed) ? log_level_t::trace //
+                                                                                            : log_level_t::debug);
+
+            std::lock_guard lock {module_filters_mutex};
+
+            // the longest (most specific) matching module wins
+            std::size_t best_length = 0;
+            auto result = default_level;
+            for (auto const & filter : module_filters) {
+                if ((filter.module.size() > best_length) && is_in_module(file, filter.module)) {
+                    best_length = filter.module.size();
+                    result = filter.min_level;
+                }
+            }
+
+            return result;
+        }
 
         //NOLINTNEXTLINE(cert-dcl50-cpp)
         void do_log_item(log_level_t level, source_loc_t const & location, const char * format, ...)
@@ -119,13 +187,59 @@ namespace logging {
     /** @return true if trace logging is enabled */
     bool is_log_enable_trace() noexcept
     {
-        return detail::enabled_log_trace;
+        return enabled_log_trace.load(std::memory_order_relaxed);
     }
 
     /** Enable trace logging (which also enables debug) */
     void set_log_enable_trace(bool enabled) noexcept
     {
-        detail::enabled_log_trace = enabled;
+        enabled_log_trace.store(enabled, std::memory_order_relaxed);
+        detail::log_filter_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void set_log_module_filter(std::string_view spec)
+    {
+        std::vector<module_filter_t> filters {};
+
+        while (!spec.empty()) {
+            auto const comma = spec.find(',');
+            auto const rule = spec.substr(0, comma);
+            spec = (comma == std::string_view::npos ? std::string_view {} : spec.substr(comma + 1));
+
+            if (rule.empty()) {
+                continue;
+            }
+
+            auto const equals = rule.rfind('=');
+            auto const module = (equals == std::string_view::npos ? std::string_view {} : rule.substr(0, equals));
+            auto const level = (equals == std::string_view::npos ? std::nullopt //
+                                                                 : parse_filter_level(rule.substr(equals + 1)));
+
+            if (module.empty() || !level) {
+                LOG_WARNING("Ignoring invalid log filter rule '%.*s'", int(rule.size()), rule.data());
+                continue;
+            }
+
+            // normalize 'dir/' to 'dir'
+            auto const trimmed = module.substr(0, module.find_last_not_of('/') + 1);
+            filters.push_back(module_filter_t {std::string(trimmed), *level});
+        }
+
+        {
+            std::lock_guard lock {module_filters_mutex};
+            module_filters = std::move(filters);
+        }
+
+        detail::log_filter_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void set_log_module_filter_from_env()
+    {
+        //NOLINTNEXTLINE(concurrency-mt-unsafe)
+        auto const * spec = getenv(log_filter_env_var);
+        if (spec != nullptr) {
+            set_log_module_filter(spec);
+        }
     }
 
 }
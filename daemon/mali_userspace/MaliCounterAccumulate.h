@@ -0,0 +1,56 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace mali_userspace {
+
+    /**
+     * Add a whole block of 32-bit counter values into a block of 64-bit sums, i.e. `sums[i] += values[i]`
+     * for every counter in the block.
+     *
+     * The whole block is summed (rather than just the enabled counters) as a dense contiguous loop is cheaper
+     * than a gather over the enabled indexes once more than a handful of counters are selected.
+     */
+    inline void accumulate_block(std::uint64_t * __restrict sums,
+                                 const std::uint32_t * __restrict values,
+                                 std::size_t count)
+    {
+        std::size_t i = 0;
+#if defined(__aarch64__) && defined(__ARM_NEON)
+        for (; (i + 4) <= count; i += 4) {
+            const uint32x4_t v = vld1q_u32(values + i);
+            vst1q_u64(sums + i, vaddw_u32(vld1q_u64(sums + i), vget_low_u32(v)));
+            vst1q_u64(sums + i + 2, vaddw_high_u32(vld1q_u64(sums + i + 2), v));
+        }
+#endif
+        for (; i < count; ++i) {
+            sums[i] += values[i];
+        }
+    }
+
+    /**
+     * Add a whole block of 64-bit counter values into a block of 64-bit sums, i.e. `sums[i] += values[i]`
+     * for every counter in the block.
+     */
+    inline void accumulate_block(std::uint64_t * __restrict sums,
+                                 const std::uint64_t * __restrict values,
+                                 std::size_t count)
+    {
+        std::size_t i = 0;
+#if defined(__aarch64__) && defined(__ARM_NEON)
+        for (; (i + 2) <= count; i += 2) {
+            vst1q_u64(sums + i, vaddq_u64(vld1q_u64(sums + i), vld1q_u64(values + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            sums[i] += values[i];
+        }
+    }
+}
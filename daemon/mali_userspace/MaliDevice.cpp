@@ -16,6 +16,7 @@
 #include "device/product_id.hpp"
 #include "lib/Span.h"
 #include "libGPUInfo/source/libgpuinfo.hpp"
+#include "mali_userspace/MaliCounterAccumulate.h"
 #include "mali_userspace/MaliHwCntrNamesGenerated.h"
 
 #include <algorithm>
@@ -360,18 +361,26 @@ namespace mali_userspace {
     MaliDeviceCounterList::MaliDeviceCounterList(uint32_t numBlocks, uint32_t numGroups, uint32_t numWords)
         : countersListLength(numBlocks * numGroups * numWords),
           countersListValid(0),
-          countersList(new Address[countersListLength])
+          countersList(new Address[countersListLength]),
+          shaderCoreSums(numGroups * numWords),
+          l2Sums(numGroups * numWords)
     {
         counters_by_block[hwcnt::block_type::fe] = {};
         counters_by_block[hwcnt::block_type::tiler] = {};
         counters_by_block[hwcnt::block_type::memory] = {};
         counters_by_block[hwcnt::block_type::core] = {};
+
+        values.reserve(countersListLength);
     }
 
     MaliDeviceCounterList::MaliDeviceCounterList(MaliDeviceCounterList && that) noexcept
         : countersListLength(that.countersListLength),
           countersListValid(that.countersListValid),
-          countersList(that.countersList)
+          countersList(that.countersList),
+          counters_by_block(std::move(that.counters_by_block)),
+          shaderCoreSums(std::move(that.shaderCoreSums)),
+          l2Sums(std::move(that.l2Sums)),
+          values(std::move(that.values))
     {
         that.countersListLength = 0;
         that.countersListValid = 0;
@@ -455,7 +464,6 @@ namespace mali_userspace {
           instance(std::move(instance)),
           clockPath(std::move(clockPath))
     {
-        using namespace std::placeholders;
         namespace hwcnt = hwcpipe::device::hwcnt;
 
         const auto constants = this->instance->get_constants();
@@ -478,23 +486,8 @@ namespace mali_userspace {
             return count;
         }();
 
-        if (counter_type == hwcnt::sample_values_type::uint32) {
-            counter_accumulator = [this](auto const & counter_list, auto const & metadata, auto counters) {
-                accumulate_counters<std::uint32_t>(counter_list, metadata, counters);
-            };
-            delta_writer =
-                [this](auto const & counter_list, auto const & metadata, auto & frame_builder, auto & callback) {
-                    dump_delta_counters<std::uint32_t>(counter_list, metadata, frame_builder, callback);
-                };
-        }
-        else if (counter_type == hwcnt::sample_values_type::uint64) {
-            counter_accumulator = [this](auto const & counter_list, auto const & metadata, auto counters) {
-                accumulate_counters<std::uint64_t>(counter_list, metadata, counters);
-            };
-            delta_writer =
-                [this](auto const & counter_list, auto const & metadata, auto & frame_builder, auto & callback) {
-                    dump_delta_counters<std::uint64_t>(counter_list, metadata, frame_builder, callback);
-                };
+        if ((counter_type == hwcnt::sample_values_type::uint32) || (counter_type == hwcnt::sample_values_type::uint64)) {
+            counter_values_type = counter_type;
         }
         else {
             LOG_ERROR("Unsupported counter values type: %" PRIu8, static_cast<std::uint8_t>(counter_type));
@@ -653,37 +646,74 @@ namespace mali_userspace {
         return result;
     }
 
-    void MaliDevice::dumpCounters(const MaliDeviceCounterList & counter_list,
+    void MaliDevice::dumpCounters(MaliDeviceCounterList & counter_list,
                                   const hwcnt::sample & sample,
                                   const hwcnt::features & features,
                                   IBlockCounterFrameBuilder & buffer_data,
                                   IMaliDeviceCounterDumpCallback & callback) const
     {
-        std::vector<AccumulatedCounter> shader_core_counters(block_metadata.num_counters_per_block);
-        std::vector<AccumulatedCounter> l2_counters(block_metadata.num_counters_per_block);
+        if (counter_values_type == hwcnt::sample_values_type::uint64) {
+            dump_counters<std::uint64_t>(counter_list, sample, features, buffer_data, callback);
+        }
+        else {
+            dump_counters<std::uint32_t>(counter_list, sample, features, buffer_data, callback);
+        }
+    }
+
+    template<typename CounterType>
+    void MaliDevice::dump_counters(MaliDeviceCounterList & counter_list,
+                                   const hwcnt::sample & sample,
+                                   const hwcnt::features & features,
+                                   IBlockCounterFrameBuilder & buffer_data,
+                                   IMaliDeviceCounterDumpCallback & callback) const
+    {
+        const std::size_t num_counters = block_metadata.num_counters_per_block;
+        const auto counter_index = [this](const MaliDeviceCounterList::Address & address) -> std::uint32_t {
+            return (address.groupIndex * block_metadata.num_counters_per_enable_group) + address.wordIndex;
+        };
 
+        auto & values = counter_list.values;
+        auto & shader_core_sums = counter_list.shaderCoreSums;
+        auto & l2_sums = counter_list.l2Sums;
+
+        values.clear();
+        std::fill(shader_core_sums.begin(), shader_core_sums.end(), 0);
+        std::fill(l2_sums.begin(), l2_sums.end(), 0);
+
+        const bool has_shader_core_counters = !counter_list[hwcnt::block_type::core].empty();
+        const bool has_enabled_l2_counters = !counter_list[hwcnt::block_type::memory].empty();
+
+        bool accumulated_shader_cores = false;
         bool has_l2_counters = false;
         bool already_logged = false;
 
         for (auto it : sample.blocks()) {
+            const auto * counter_values = reinterpret_cast<const CounterType *>(it.values);
+
             switch (it.type) {
                 case hwcnt::block_type::fe:
                 case hwcnt::block_type::tiler:
-                    delta_writer(counter_list, it, buffer_data, callback);
+                    for (const auto & address : counter_list[it.type]) {
+                        const std::uint32_t index = counter_index(address);
+                        values.push_back({static_cast<std::uint32_t>(it.type), index, counter_values[index]});
+                    }
                     break;
 
                 case hwcnt::block_type::core: {
                     // skip over any absent shader core blocks based on the availabilty mask
                     const bool on = features.has_power_states ? it.state.on != 0 : true;
                     const bool available = features.has_vm_states ? it.state.available != 0 : true;
-                    if (on && available) {
-                        counter_accumulator(counter_list, it, shader_core_counters);
+                    if (has_shader_core_counters && on && available) {
+                        accumulate_block(shader_core_sums.data(), counter_values, num_counters);
+                        accumulated_shader_cores = true;
                     }
                 } break;
 
                 case hwcnt::block_type::memory:
                     has_l2_counters = true;
-                    counter_accumulator(counter_list, it, l2_counters);
+                    if (has_enabled_l2_counters) {
+                        accumulate_block(l2_sums.data(), counter_values, num_counters);
+                    }
                     break;
                 default:
                     if (!already_logged) {
@@ -694,30 +724,24 @@ namespace mali_userspace {
         }
 
         // now send shader core sums
-        for (std::size_t i = 0; i < block_metadata.num_counters_per_block; ++i) {
-            auto & counter = shader_core_counters[i];
-            if (counter.isValid()) {
-                callback.nextCounterValue(mapNameBlockToIndex(MaliCounterBlockName::SHADER),
-                                          i,
-                                          counter.sum,
-                                          static_cast<std::uint32_t>(mProductVersion.product_id),
-                                          buffer_data);
+        if (accumulated_shader_cores) {
+            const std::uint32_t name_block_index = mapNameBlockToIndex(MaliCounterBlockName::SHADER);
+            for (const auto & address : counter_list[hwcnt::block_type::core]) {
+                const std::uint32_t index = counter_index(address);
+                values.push_back({name_block_index, index, shader_core_sums[index]});
             }
         }
 
         // and l2 counters if the device supports them
         if (has_l2_counters) {
-            for (std::size_t i = 0; i < block_metadata.num_counters_per_block; ++i) {
-                auto & counter = l2_counters[i];
-                if (counter.isValid()) {
-                    callback.nextCounterValue(mapNameBlockToIndex(MaliCounterBlockName::MMU),
-                                              i,
-                                              counter.sum,
-                                              static_cast<std::uint32_t>(mProductVersion.product_id),
-                                              buffer_data);
-                }
+            const std::uint32_t name_block_index = mapNameBlockToIndex(MaliCounterBlockName::MMU);
+            for (const auto & address : counter_list[hwcnt::block_type::memory]) {
+                const std::uint32_t index = counter_index(address);
+                values.push_back({name_block_index, index, l2_sums[index]});
             }
         }
+
+        callback.nextCounterValues(values, static_cast<std::uint32_t>(mProductVersion.product_id), buffer_data);
     }
 
     void MaliDevice::insertConstants(std::set<Constant> & dest)
@@ -16,11 +16,11 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace mali_userspace {
 
@@ -60,6 +60,27 @@ namespace mali_userspace {
                                       uint32_t gpuId,
                                       IBlockCounterFrameBuilder & buffer) = 0;
 
+        /** One counter value as passed to nextCounterValues */
+        struct CounterValue {
+            uint32_t nameBlockIndex;
+            uint32_t counterIndex;
+            uint64_t delta;
+        };
+
+        /**
+         * Receive all the counter values for one sample.
+         *
+         * The default implementation forwards each value to nextCounterValue; override it to handle the sample in bulk.
+         */
+        virtual void nextCounterValues(lib::Span<const CounterValue> values,
+                                       uint32_t gpuId,
+                                       IBlockCounterFrameBuilder & buffer)
+        {
+            for (const auto & value : values) {
+                nextCounterValue(value.nameBlockIndex, value.counterIndex, value.delta, gpuId, buffer);
+            }
+        }
+
         /**
          * Used to check if the user selected the counter in the config dialog when building the fast lookup list
          *
@@ -112,6 +133,11 @@ namespace mali_userspace {
         Address * countersList;
         counters_by_block_map_t counters_by_block;
 
+        /* Scratch space used by MaliDevice::dumpCounters; allocated once here so none is needed per sample */
+        std::vector<uint64_t> shaderCoreSums;
+        std::vector<uint64_t> l2Sums;
+        std::vector<IMaliDeviceCounterDumpCallback::CounterValue> values;
+
         /* It can call enable */
         friend class MaliDevice;
 
@@ -211,8 +237,10 @@ namespace mali_userspace {
 
         /**
          * Dump all the counter data encoded in the provided sample buffer, passing it to the callback object
+         *
+         * The counter list's scratch space is reused, so each list must only be used by one thread at a time.
          */
-        void dumpCounters(const MaliDeviceCounterList & counter_list,
+        void dumpCounters(MaliDeviceCounterList & counter_list,
                           const hwcpipe::device::hwcnt::sample & sample,
                           const hwcpipe::device::hwcnt::features & features,
                           IBlockCounterFrameBuilder & buffer_data,
@@ -234,34 +262,6 @@ namespace mali_userspace {
         static int get_mali_ddk_version_from_device();
 
     private:
-        struct AccumulatedCounter {
-            uint64_t sum;
-            uint32_t count;
-
-            AccumulatedCounter() : sum(0), count(0) {}
-
-            AccumulatedCounter & operator+=(uint64_t delta)
-            {
-                sum += delta;
-                count += 1;
-
-                return *this;
-            }
-
-            bool isValid() const { return count > 0; }
-
-            uint64_t average() const { return sum / count; }
-        };
-
-        using counter_delta_writer_t = std::function<void(const MaliDeviceCounterList &,
-                                                          const hwcpipe::device::hwcnt::block_metadata &,
-                                                          IBlockCounterFrameBuilder &,
-                                                          IMaliDeviceCounterDumpCallback &)>;
-
-        using counter_accumulator_t = std::function<void(const MaliDeviceCounterList &,
-                                                         const hwcpipe::device::hwcnt::block_metadata &,
-                                                         lib::Span<AccumulatedCounter>)>;
-
         /** Init a block in the enable list */
         void initCounterList(uint32_t gpuId,
                              IMaliDeviceCounterDumpCallback & callback,
@@ -284,8 +284,8 @@ namespace mali_userspace {
 
         block_metadata_t block_metadata;
 
-        counter_delta_writer_t delta_writer;
-        counter_accumulator_t counter_accumulator;
+        /** The width of each counter value in a sample */
+        hwcpipe::device::hwcnt::sample_values_type counter_values_type;
 
         /** Mali DDK Version on device */
         int ddk_version;
@@ -296,45 +296,11 @@ namespace mali_userspace {
                    std::string clockPath);
 
         template<typename CounterType>
-        void dump_delta_counters(const MaliDeviceCounterList & counter_list,
-                                 const hwcpipe::device::hwcnt::block_metadata & block,
-                                 IBlockCounterFrameBuilder & buffer_data,
-                                 IMaliDeviceCounterDumpCallback & callback)
-        {
-            auto active_counters = counter_list[block.type];
-            auto counter_values = reinterpret_cast<const CounterType *>(block.values);
-
-            for (const auto & address : active_counters) {
-                const std::uint32_t counter_index =
-                    address.groupIndex * block_metadata.num_counters_per_enable_group + address.wordIndex;
-                auto delta = counter_values[counter_index];
-
-                callback.nextCounterValue(static_cast<std::uint32_t>(block.type),
-                                          counter_index,
-                                          delta,
-                                          static_cast<std::uint32_t>(mProductVersion.product_id),
-                                          buffer_data);
-            }
-        }
-
-        template<typename CounterType>
-        void accumulate_counters(const MaliDeviceCounterList & counter_list,
-                                 const hwcpipe::device::hwcnt::block_metadata & block,
-                                 lib::Span<AccumulatedCounter> counters)
-        {
-            auto active_counters = counter_list[block.type];
-            if (active_counters.empty()) {
-                return;
-            }
-
-            auto counter_values = reinterpret_cast<const CounterType *>(block.values);
-            for (const auto & address : active_counters) {
-                const std::uint32_t counter_index =
-                    address.groupIndex * block_metadata.num_counters_per_enable_group + address.wordIndex;
-                auto delta = counter_values[counter_index];
-                counters[counter_index] += delta;
-            }
-        }
+        void dump_counters(MaliDeviceCounterList & counter_list,
+                           const hwcpipe::device::hwcnt::sample & sample,
+                           const hwcpipe::device::hwcnt::features & features,
+                           IBlockCounterFrameBuilder & buffer_data,
+                           IMaliDeviceCounterDumpCallback & callback) const;
     };
 }
 
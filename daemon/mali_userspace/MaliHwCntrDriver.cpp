@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2016-2025 by Arm Limited. All rights reserved. */
 
 #include "mali_userspace/MaliHwCntrDriver.h"
 
@@ -7,6 +7,7 @@
 #include "Logging.h"
 #include "MaliGPUClockPolledDriver.h"
 #include "MaliHwCntr.h"
+#include "MaliSamplerPolledDriver.h"
 #include "PolledDriver.h"
 #include "SimpleDriver.h"
 #include "mali_userspace/MaliDevice.h"
@@ -81,12 +82,18 @@ namespace mali_userspace {
         for (auto const & mDevice : mDevices) {
             const MaliDevice & device = *mDevice.second;
             if (!device.getClockPath().empty()) {
-                mPolledDrivers[mDevice.first] =
-                    std::unique_ptr<PolledDriver>(new MaliGPUClockPolledDriver(device.getClockPath(), mDevice.first));
+                mPolledDrivers.emplace(
+                    mDevice.first,
+                    std::unique_ptr<PolledDriver>(new MaliGPUClockPolledDriver(device.getClockPath(), mDevice.first)));
             }
             else {
                 LOG_SETUP("Mali GPU counters\nGPU frequency counters not available for GPU # %d.", mDevice.first);
             }
+
+            // and the sampler health driver
+            auto samplerDriver = std::make_unique<MaliSamplerPolledDriver>(mDevice.first);
+            mSamplerDrivers[mDevice.first] = samplerDriver.get();
+            mPolledDrivers.emplace(mDevice.first, std::move(samplerDriver));
         }
     }
 
@@ -139,23 +146,38 @@ namespace mali_userspace {
     // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
     int MaliHwCntrDriver::getCounterKey(uint32_t nameBlockIndex, uint32_t counterIndex, uint32_t gpuId) const
     {
-        const auto block_it = metadata_by_gpu_id.find(gpuId);
-        if (block_it == metadata_by_gpu_id.end()) {
-            return 0;
-        }
+        const auto [keys, counters_per_block] = getCounterKeys(gpuId);
 
-        const auto counters_per_block = block_it->second.num_counters_per_block;
         if (counterIndex < counters_per_block) {
             const auto index = (nameBlockIndex * counters_per_block + counterIndex);
-            const auto it = mEnabledCounterKeysByGpuId.find(gpuId);
-            if (it == mEnabledCounterKeysByGpuId.end()) {
-                return 0;
+            if (index < keys.size()) {
+                return keys[index];
             }
-            return it->second[index];
         }
         return 0;
     }
 
+    std::pair<lib::Span<const int>, std::size_t> MaliHwCntrDriver::getCounterKeys(uint32_t gpuId) const
+    {
+        const auto block_it = metadata_by_gpu_id.find(gpuId);
+        if (block_it == metadata_by_gpu_id.end()) {
+            return {};
+        }
+
+        const auto it = mEnabledCounterKeysByGpuId.find(gpuId);
+        if (it == mEnabledCounterKeysByGpuId.end()) {
+            return {};
+        }
+
+        return {it->second, block_it->second.num_counters_per_block};
+    }
+
+    MaliSamplerPolledDriver * MaliHwCntrDriver::getSamplerDriver(unsigned deviceNumber) const
+    {
+        const auto it = mSamplerDrivers.find(deviceNumber);
+        return (it != mSamplerDrivers.end() ? it->second : nullptr);
+    }
+
     const char * MaliHwCntrDriver::getSupportedDeviceFamilyName() const
     {
         if (!mDevices.empty()) {
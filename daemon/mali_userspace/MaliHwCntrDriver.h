@@ -1,4 +1,4 @@
-/* Copyright (C) 2013-2022 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2013-2025 by Arm Limited. All rights reserved. */
 
 #ifndef NATIVE_GATOR_DAEMON_MIDGARDHWCOUNTERDRIVER_H_
 #define NATIVE_GATOR_DAEMON_MIDGARDHWCOUNTERDRIVER_H_
@@ -6,12 +6,18 @@
 #include "PolledDriver.h"
 #include "SessionData.h"
 #include "SimpleDriver.h"
+#include "lib/Span.h"
 #include "mali_userspace/MaliDevice.h"
+#include "mali_userspace/MaliSamplerPolledDriver.h"
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <utility>
+#include <vector>
+
 namespace mali_userspace {
     /**
      * Implements a counter driver for all Mali Midgard devices with r8p0 or later driver installed.
@@ -34,7 +40,8 @@ namespace mali_userspace {
         void setupCounter(Counter & counter) override;
         bool start();
 
-        [[nodiscard]] inline const std::map<unsigned, std::unique_ptr<PolledDriver>> & getPolledDrivers() const noexcept
+        [[nodiscard]] inline const std::multimap<unsigned, std::unique_ptr<PolledDriver>> & getPolledDrivers()
+            const noexcept
         {
             return mPolledDrivers;
         }
@@ -47,8 +54,18 @@ namespace mali_userspace {
         void insertConstants(std::set<Constant> & dest) override;
         [[nodiscard]] int getCounterKey(uint32_t nameBlockIndex, uint32_t counterIndex, uint32_t gpuId) const;
 
+        /**
+         * @return the table of counter keys for the gpu (0 if not enabled), along with the number of counters
+         * per block; or an empty table if the gpu is unknown. The table is indexed by
+         * `nameBlockIndex * counters per block + counterIndex`
+         */
+        [[nodiscard]] std::pair<lib::Span<const int>, std::size_t> getCounterKeys(uint32_t gpuId) const;
+
         [[nodiscard]] const char * getSupportedDeviceFamilyName() const;
 
+        /** @return the sampler health driver for the device, or nullptr if there is none */
+        [[nodiscard]] MaliSamplerPolledDriver * getSamplerDriver(unsigned deviceNumber) const;
+
         /** @return map from device number to gpu id */
         [[nodiscard]] std::map<unsigned, unsigned> getDeviceGpuIds() const;
 
@@ -60,7 +77,9 @@ namespace mali_userspace {
         /** store per-gpu block sizes */
         std::map<unsigned, MaliDevice::block_metadata_t> metadata_by_gpu_id {};
         /** Map of the GPU device number and Polling driver for GPU clock etc. */
-        std::map<unsigned, std::unique_ptr<PolledDriver>> mPolledDrivers {};
+        std::multimap<unsigned, std::unique_ptr<PolledDriver>> mPolledDrivers {};
+        /** Map of the GPU device number to its sampler health driver (owned by mPolledDrivers) */
+        std::map<unsigned, MaliSamplerPolledDriver *> mSamplerDrivers {};
         //Map between the device number and the mali devices .
         std::map<unsigned, std::unique_ptr<MaliDevice>> mDevices;
     };
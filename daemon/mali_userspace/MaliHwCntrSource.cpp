@@ -1,4 +1,4 @@
-/* Copyright (C) 2010-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2010-2025 by Arm Limited. All rights reserved. */
 
 // Define to get format macros from inttypes.h
 #define __STDC_FORMAT_MACROS
@@ -12,16 +12,21 @@
 
 #include "BlockCounterFrameBuilder.h"
 #include "Buffer.h"
+#include "CommitTimeChecker.h"
 #include "Logging.h"
 #include "MaliHwCntrTask.h"
 #include "SessionData.h"
 #include "Source.h"
+#include "lib/Span.h"
 #include "mali_userspace/MaliDevice.h"
 #include "mali_userspace/MaliHwCntrDriver.h"
 #include "mali_userspace/MaliHwCntrTask.h"
+#include "mali_userspace/MaliRawCounterFrameBuilder.h"
 #include "monotonic_pair.h"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -52,17 +57,32 @@ namespace mali_userspace {
                     sampleRate = gSessionData.mSampleRateGpu;
                 }
 
+                // An explicit GPU sample rate overrides both
+                if (gSessionData.mMaliSampleRate > 0) {
+                    sampleRate = gSessionData.mMaliSampleRate;
+                }
+
                 LOG_FINE("GPU id = 0x%x, sampling rate = %d\n", gpuId, sampleRate);
 
                 // NOLINTNEXTLINE(readability-magic-numbers)
                 std::unique_ptr<Buffer> taskBuffer(new Buffer(gSessionData.mTotalBufferSize * 1024 * 1024, mSenderSem));
 
+                // both frame builders write to the same buffer so must share the commit time
+                auto commitTimeChecker = std::make_shared<CommitTimeChecker>(gSessionData.mLiveRate);
                 std::unique_ptr<BlockCounterFrameBuilder> frameBuilder(
-                    new BlockCounterFrameBuilder(*taskBuffer, gSessionData.mLiveRate));
+                    new BlockCounterFrameBuilder(*taskBuffer, commitTimeChecker));
+                std::unique_ptr<MaliRawCounterFrameBuilder> rawFrameBuilder;
+                // the raw frames are only understood by hosts that accept PROTOCOL_VERSION_GPU_RAW_COUNTERS, which is
+                // only announced when this is set
+                if (gSessionData.mMaliRawCounters) {
+                    rawFrameBuilder = std::make_unique<MaliRawCounterFrameBuilder>(*taskBuffer, commitTimeChecker);
+                }
                 std::unique_ptr<MaliHwCntrTask> task(new MaliHwCntrTask(std::move(taskBuffer),
                                                                         std::move(frameBuilder),
+                                                                        std::move(rawFrameBuilder),
                                                                         deviceNumber,
                                                                         *this,
+                                                                        mDriver.getSamplerDriver(pair.first),
                                                                         device,
                                                                         device.getConstantValues(),
                                                                         sampleRate));
@@ -116,6 +136,36 @@ namespace mali_userspace {
             }
         }
 
+        void nextCounterValues(lib::Span<const CounterValue> values,
+                               uint32_t gpuId,
+                               IBlockCounterFrameBuilder & buffer) override
+        {
+            // resolve the key table once per sample rather than once per counter
+            const auto [keys, counters_per_block] = mDriver.getCounterKeys(gpuId);
+
+            // batch into a fixed size block on the stack so that nothing is allocated per sample
+            std::array<IBlockCounterFrameBuilder::event64_t, EVENTS_BATCH_SIZE> events;
+            std::size_t count = 0;
+
+            for (const auto & value : values) {
+                const auto index = (value.nameBlockIndex * counters_per_block) + value.counterIndex;
+                const int key = (index < keys.size() ? keys[index] : 0);
+                if (key == 0) {
+                    continue;
+                }
+
+                events[count++] = {key, static_cast<int64_t>(value.delta)};
+                if (count == events.size()) {
+                    buffer.events64({events.data(), count});
+                    count = 0;
+                }
+            }
+
+            if (count > 0) {
+                buffer.events64({events.data(), count});
+            }
+        }
+
         [[nodiscard]] bool isCounterActive(uint32_t nameBlockIndex,
                                            uint32_t counterIndex,
                                            uint32_t gpuId) const override
@@ -125,6 +175,8 @@ namespace mali_userspace {
         }
 
     private:
+        static constexpr std::size_t EVENTS_BATCH_SIZE = 128;
+
         MaliHwCntrDriver & mDriver;
         std::vector<std::unique_ptr<MaliHwCntrTask>> tasks {};
     };
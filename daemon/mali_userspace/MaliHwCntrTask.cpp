@@ -1,4 +1,8 @@
-/* Copyright (C) 2019-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
+
+// Define to get format macros from inttypes.h
+#define __STDC_FORMAT_MACROS
+// must be before includes
 
 #include "MaliHwCntrTask.h"
 
@@ -16,8 +20,12 @@
 #include "device/hwcnt/sampler/periodic.hpp"
 #include "device/instance.hpp"
 #include "mali_userspace/MaliDevice.h"
+#include "mali_userspace/MaliRawCounterFrameBuilder.h"
+#include "mali_userspace/MaliSamplerPolledDriver.h"
 
 #include <array>
+#include <cinttypes>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -27,6 +35,7 @@
 #include <vector>
 
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/epoll.h>
 #include <unistd.h>
 
@@ -36,6 +45,19 @@ namespace mali_userspace {
     namespace hwcnt = dev::hwcnt;
 
     namespace {
+        /**
+         * The maximum number of samples to read per wakeup, so that a GPU producing samples faster than they can
+         * be consumed cannot stop the task from noticing it has been interrupted
+         */
+        constexpr std::size_t MAX_SAMPLES_PER_WAKEUP = 64;
+
+        /** @return true if another sample can be read from the fd without blocking */
+        bool is_sample_ready(int fd)
+        {
+            pollfd pfd {fd, POLLIN, 0};
+            return (::poll(&pfd, 1, 0) > 0) && ((pfd.revents & POLLIN) != 0);
+        }
+
         hwcnt::sampler::periodic create_sampler(dev::instance & instance, std::uint32_t sample_period)
         {
             using namespace hwcpipe::device::hwcnt;
@@ -60,14 +82,18 @@ namespace mali_userspace {
 
     MaliHwCntrTask::MaliHwCntrTask(std::unique_ptr<IBufferControl> buffer,
                                    std::unique_ptr<IBlockCounterFrameBuilder> frameBuilder,
+                                   std::unique_ptr<MaliRawCounterFrameBuilder> rawFrameBuilder,
                                    std::int32_t deviceNumber,
                                    IMaliDeviceCounterDumpCallback & callback_,
+                                   MaliSamplerPolledDriver * samplerDriver,
                                    const MaliDevice & device,
                                    std::map<CounterKey, int64_t> constantValues,
                                    std::uint32_t sampleRate)
         : mBuffer(std::move(buffer)),
           mFrameBuilder(std::move(frameBuilder)),
+          mRawFrameBuilder(std::move(rawFrameBuilder)),
           mCallback(callback_),
+          mSamplerDriver(samplerDriver),
           mDevice(device),
           deviceNumber(deviceNumber),
           mConstantValues(std::move(constantValues)),
@@ -126,6 +152,16 @@ namespace mali_userspace {
             }
         }
 
+        if (mRawFrameBuilder
+            && !mRawFrameBuilder->writeMetadata(deviceNumber,
+                                                mDevice.getGpuId(),
+                                                instance->get_hwcnt_block_extents())) {
+            LOG_ERROR("Failed to send raw counter metadata for device %d", deviceNumber);
+            mFrameBuilder->flush();
+            mBuffer->setDone();
+            return;
+        }
+
         Monitor monitor;
         if (!monitor.init() || !monitor.add(reader.get_fd()) || !monitor.add(interrupt_fd[0])) {
             LOG_ERROR("Failed to set up epoll monitor for GPU sampler on device %d", deviceNumber);
@@ -135,7 +171,7 @@ namespace mali_userspace {
         sampler.sampling_start(0);
 
         // create the list of enabled counters
-        const MaliDeviceCounterList countersList(mDevice.createCounterList(mCallback));
+        MaliDeviceCounterList countersList(mDevice.createCounterList(mCallback));
         while (true) {
             epoll_event event;
             int ready = monitor.wait(&event, 1, -1);
@@ -149,10 +185,19 @@ namespace mali_userspace {
             }
 
             if (event.data.fd == reader.get_fd()) {
-                auto ec = write_sample(countersList, reader, monotonicStarted);
-                if (ec) {
-                    LOG_ERROR("Error getting Mali counter sample on device %d: %s", deviceNumber, ec.message().c_str());
-                    handleException();
+                // drain everything that is ready in one go, so that at high sample rates the kernel's
+                // sample buffer does not fill up between wakeups
+                for (std::size_t n = 0; n < MAX_SAMPLES_PER_WAKEUP; ++n) {
+                    auto ec = write_sample(countersList, reader, monotonicStarted);
+                    if (ec) {
+                        LOG_ERROR("Error getting Mali counter sample on device %d: %s",
+                                  deviceNumber,
+                                  ec.message().c_str());
+                        handleException();
+                    }
+                    if (!is_sample_ready(reader.get_fd())) {
+                        break;
+                    }
                 }
             }
             else if (event.data.fd == interrupt_fd[0]) {
@@ -166,11 +211,21 @@ namespace mali_userspace {
         }
 
         sampler.sampling_stop(0);
+        if ((mSamplerDriver != nullptr) && (mSamplerDriver->getDroppedSamples() > 0)) {
+            LOG_WARNING("Lost %" PRIu64 " GPU counter samples on device %d; consider a lower sample rate",
+                        mSamplerDriver->getDroppedSamples(),
+                        deviceNumber);
+        }
+        if (mRawFrameBuilder && (mRawFrameBuilder->getDroppedSamples() > 0)) {
+            LOG_WARNING("Dropped %" PRIu64 " raw GPU counter samples on device %d due to lack of buffer space",
+                        mRawFrameBuilder->getDroppedSamples(),
+                        deviceNumber);
+        }
         mFrameBuilder->flush();
         mBuffer->setDone();
     }
 
-    std::error_code MaliHwCntrTask::write_sample(const MaliDeviceCounterList & counter_list,
+    std::error_code MaliHwCntrTask::write_sample(MaliDeviceCounterList & counter_list,
                                                  hwcnt::reader & reader,
                                                  std::uint64_t monotonic_start)
     {
@@ -180,8 +235,14 @@ namespace mali_userspace {
             return ec;
         }
 
+        countDroppedSamples(sample.get_metadata());
+
         const std::uint64_t sample_time = sample.get_metadata().timestamp_ns_end - monotonic_start;
-        if (mFrameBuilder->eventHeader(sample_time) && mFrameBuilder->eventCore(deviceNumber)) {
+        if (mRawFrameBuilder) {
+            mRawFrameBuilder->writeSample(deviceNumber, monotonic_start, sample);
+            mRawFrameBuilder->check(sample_time);
+        }
+        else if (mFrameBuilder->eventHeader(sample_time) && mFrameBuilder->eventCore(deviceNumber)) {
             mDevice.dumpCounters(counter_list, sample, reader.get_features(), *mFrameBuilder, mCallback);
             mFrameBuilder->check(sample_time);
         }
@@ -189,6 +250,22 @@ namespace mali_userspace {
         return {};
     }
 
+    void MaliHwCntrTask::countDroppedSamples(const hwcnt::sample_metadata & metadata)
+    {
+        // samples are numbered consecutively, so a gap means the kernel had to discard some; a stretched
+        // sample means the kernel could not take a sample when it should have as its buffer was full
+        std::uint64_t dropped = (metadata.flags.stretched != 0 ? 1 : 0);
+        if (mHaveLastSampleNr && (metadata.sample_nr > (mLastSampleNr + 1))) {
+            dropped += metadata.sample_nr - (mLastSampleNr + 1);
+        }
+        mLastSampleNr = metadata.sample_nr;
+        mHaveLastSampleNr = true;
+
+        if ((dropped > 0) && (mSamplerDriver != nullptr)) {
+            mSamplerDriver->addDroppedSamples(dropped);
+        }
+    }
+
     bool MaliHwCntrTask::write(ISender & sender)
     {
         return mBuffer->write(sender);
@@ -1,9 +1,11 @@
-/* Copyright (C) 2019-2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2019-2025 by Arm Limited. All rights reserved. */
 
 #ifndef MALI_USERSPACE_MALIHWCNTRTASK_H_
 #define MALI_USERSPACE_MALIHWCNTRTASK_H_
 
 #include "MaliDevice.h"
+#include "MaliRawCounterFrameBuilder.h"
+#include "MaliSamplerPolledDriver.h"
 #include "device/handle.hpp"
 #include "device/instance.hpp"
 
@@ -22,11 +24,16 @@ namespace mali_userspace {
     public:
         /**
          * @param frameBuilder will not outlive buffer
+         * @param rawFrameBuilder if not null, the raw counter blocks are sent through this instead of the
+         * enabled counter values being sent through frameBuilder. Will not outlive buffer
+         * @param samplerDriver if not null, receives the count of lost samples
          */
         MaliHwCntrTask(std::unique_ptr<IBufferControl> buffer,
                        std::unique_ptr<IBlockCounterFrameBuilder> frameBuilder,
+                       std::unique_ptr<MaliRawCounterFrameBuilder> rawFrameBuilder,
                        std::int32_t deviceNumber,
                        IMaliDeviceCounterDumpCallback & callback,
+                       MaliSamplerPolledDriver * samplerDriver,
                        const MaliDevice & device,
                        std::map<CounterKey, int64_t> constants,
                        std::uint32_t sampleRate);
@@ -52,17 +59,23 @@ namespace mali_userspace {
         instance_type instance;
         std::unique_ptr<IBufferControl> mBuffer;
         std::unique_ptr<IBlockCounterFrameBuilder> mFrameBuilder;
+        std::unique_ptr<MaliRawCounterFrameBuilder> mRawFrameBuilder;
         IMaliDeviceCounterDumpCallback & mCallback;
+        MaliSamplerPolledDriver * mSamplerDriver;
         const MaliDevice & mDevice;
         std::int32_t deviceNumber;
         const std::map<CounterKey, int64_t> mConstantValues;
         std::array<int, 2> interrupt_fd;
         std::int32_t mSampleRate;
+        std::uint64_t mLastSampleNr {0};
+        bool mHaveLastSampleNr {false};
 
-        std::error_code write_sample(const MaliDeviceCounterList & counter_list,
+        std::error_code write_sample(MaliDeviceCounterList & counter_list,
                                      hwcpipe::device::hwcnt::reader & reader,
                                      std::uint64_t monotonic_start);
 
+        void countDroppedSamples(const hwcpipe::device::hwcnt::sample_metadata & metadata);
+
         bool writeConstants();
     };
 }
@@ -0,0 +1,134 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#include "mali_userspace/MaliRawCounterFrameBuilder.h"
+
+#include "BufferUtils.h"
+#include "IRawFrameBuilder.h"
+#include "Logging.h"
+#include "Protocol.h"
+#include "device/hwcnt/block_extents.hpp"
+#include "device/hwcnt/block_metadata.hpp"
+#include "device/hwcnt/sample.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mali_userspace {
+    namespace hwcnt = hwcpipe::device::hwcnt;
+
+    namespace {
+        constexpr int RECORD_HEADER_SIZE = IRawFrameBuilder::MAX_FRAME_HEADER_SIZE + (2 * buffer_utils::MAXSIZE_PACK32);
+
+        std::uint32_t pack_block_state(const hwcnt::block_state & state)
+        {
+            return (state.on << 0U)              //
+                 | (state.off << 1U)             //
+                 | (state.available << 2U)       //
+                 | (state.unavailable << 3U)     //
+                 | (state.normal << 4U)          //
+                 | (state.protected_mode << 5U);
+        }
+
+        std::uint32_t pack_sample_flags(const hwcnt::sample_flags & flags)
+        {
+            return (flags.stretched << 0U) | (flags.error << 1U);
+        }
+
+        /** The GPU may have started the first sample before the capture started, so clamp rather than wrap */
+        std::uint64_t relative_to_start(std::uint64_t timestamp, std::uint64_t monotonicStart)
+        {
+            return (timestamp > monotonicStart ? timestamp - monotonicStart : 0);
+        }
+    }
+
+    bool MaliRawCounterFrameBuilder::writeMetadata(std::int32_t deviceNumber,
+                                                   std::uint32_t gpuId,
+                                                   const hwcnt::block_extents & extents)
+    {
+        const std::size_t counterWidth = (extents.values_type() == hwcnt::sample_values_type::uint64)
+                                           ? sizeof(std::uint64_t)
+                                           : sizeof(std::uint32_t);
+        bytesPerBlock = extents.counters_per_block() * counterWidth;
+
+        const int size = RECORD_HEADER_SIZE
+                       + ((4 + hwcnt::block_extents::num_block_types) * buffer_utils::MAXSIZE_PACK32);
+        if (rawBuilder.bytesAvailable() < size) {
+            return false;
+        }
+
+        rawBuilder.beginFrame(FrameType::GPU_RAW_COUNTERS);
+        rawBuilder.packInt(deviceNumber);
+        rawBuilder.packInt(static_cast<std::int32_t>(RecordType::METADATA));
+        rawBuilder.packInt(gpuId);
+        rawBuilder.packInt(static_cast<std::uint32_t>(counterWidth));
+        rawBuilder.packInt(static_cast<std::uint32_t>(extents.counters_per_block()));
+        rawBuilder.packInt(static_cast<std::uint32_t>(hwcnt::block_extents::num_block_types));
+        for (std::size_t type = 0; type < hwcnt::block_extents::num_block_types; ++type) {
+            const auto numBlocks = extents.num_blocks_of_type(static_cast<hwcnt::block_type>(type));
+            rawBuilder.packInt(static_cast<std::uint32_t>(numBlocks));
+        }
+        rawBuilder.endFrame();
+
+        // make sure the layout is available before the first sample
+        rawBuilder.flush();
+        return true;
+    }
+
+    bool MaliRawCounterFrameBuilder::writeSample(std::int32_t deviceNumber,
+                                                 std::uint64_t monotonicStart,
+                                                 const hwcnt::sample & sample)
+    {
+        std::uint32_t numBlocks = 0;
+        for (const auto & block : sample.blocks()) {
+            (void) block;
+            ++numBlocks;
+        }
+
+        const std::size_t size = RECORD_HEADER_SIZE                                            //
+                               + (2 * buffer_utils::MAXSIZE_PACK64)                            //
+                               + (2 * buffer_utils::MAXSIZE_PACK32)                            //
+                               + (numBlocks * ((3 * buffer_utils::MAXSIZE_PACK32) + bytesPerBlock));
+
+        if (!rawBuilder.supportsWriteOfSize(static_cast<int>(size))) {
+            if (!loggedOversize) {
+                LOG_ERROR("Raw GPU counter sample of %zu bytes is too large for the capture buffer", size);
+                loggedOversize = true;
+            }
+            ++droppedSamples;
+            return false;
+        }
+
+        if (rawBuilder.bytesAvailable() < static_cast<int>(size)) {
+            ++droppedSamples;
+            return false;
+        }
+
+        const auto & metadata = sample.get_metadata();
+
+        rawBuilder.beginFrame(FrameType::GPU_RAW_COUNTERS);
+        rawBuilder.packInt(deviceNumber);
+        rawBuilder.packInt(static_cast<std::int32_t>(RecordType::SAMPLE));
+        rawBuilder.packInt64(relative_to_start(metadata.timestamp_ns_begin, monotonicStart));
+        rawBuilder.packInt64(relative_to_start(metadata.timestamp_ns_end, monotonicStart));
+        rawBuilder.packInt(pack_sample_flags(metadata.flags));
+        rawBuilder.packInt(numBlocks);
+        for (const auto & block : sample.blocks()) {
+            rawBuilder.packInt(static_cast<std::uint32_t>(block.type));
+            rawBuilder.packInt(static_cast<std::uint32_t>(block.index));
+            rawBuilder.packInt(pack_block_state(block.state));
+            rawBuilder.writeBytes(block.values, bytesPerBlock);
+        }
+        rawBuilder.endFrame();
+
+        return true;
+    }
+
+    bool MaliRawCounterFrameBuilder::check(std::uint64_t time)
+    {
+        if ((flushIsNeeded != nullptr) && ((*flushIsNeeded)(time, rawBuilder.needsFlush()))) {
+            rawBuilder.flush();
+            return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,85 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#pragma once
+
+#include "CommitTimeChecker.h"
+#include "device/hwcnt/block_extents.hpp"
+#include "device/hwcnt/sample.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+class IRawFrameBuilder;
+
+namespace mali_userspace {
+
+    /**
+     * Builds frames of FrameType::GPU_RAW_COUNTERS, which carry the unprocessed hardware counter blocks
+     * from each sample so that any delta / aggregation can be done on the host.
+     *
+     * Each frame contains a single record, and starts with the device number and the record type:
+     *
+     *  - METADATA, written once per session before any samples:
+     *      gpuId (pack32), counter width in bytes (pack32), counters per block (pack32),
+     *      number of block types (pack32), then the number of blocks of each type in block_type order (pack32 each)
+     *
+     *  - SAMPLE, written for every sample:
+     *      timestamp begin (pack64), timestamp end (pack64), sample flags (pack32), number of blocks (pack32),
+     *      then for each block: type (pack32), index (pack32), state bits (pack32) followed by
+     *      counters per block * counter width bytes of raw little-endian counter values
+     *
+     * Timestamps are relative to the start of the capture; a sample that began before the capture started has a begin
+     * timestamp of zero. Only sent when the announced protocol version is PROTOCOL_VERSION_GPU_RAW_COUNTERS.
+     */
+    class MaliRawCounterFrameBuilder {
+    public:
+        enum class RecordType : std::int32_t {
+            METADATA = 1,
+            SAMPLE = 2,
+        };
+
+        MaliRawCounterFrameBuilder(IRawFrameBuilder & rawBuilder, std::shared_ptr<CommitTimeChecker> checker)
+            : rawBuilder(rawBuilder), flushIsNeeded(std::move(checker))
+        {
+        }
+
+        // Intentionally unimplemented
+        MaliRawCounterFrameBuilder(const MaliRawCounterFrameBuilder &) = delete;
+        MaliRawCounterFrameBuilder & operator=(const MaliRawCounterFrameBuilder &) = delete;
+        MaliRawCounterFrameBuilder(MaliRawCounterFrameBuilder &&) = delete;
+        MaliRawCounterFrameBuilder & operator=(MaliRawCounterFrameBuilder &&) = delete;
+
+        /**
+         * Write the block layout for the device
+         * @return true if it could be written
+         */
+        bool writeMetadata(std::int32_t deviceNumber,
+                           std::uint32_t gpuId,
+                           const hwcpipe::device::hwcnt::block_extents & extents);
+
+        /**
+         * Write the raw blocks of one sample. The sample is dropped if the buffer does not have space for it.
+         * @return true if it could be written
+         */
+        bool writeSample(std::int32_t deviceNumber,
+                         std::uint64_t monotonicStart,
+                         const hwcpipe::device::hwcnt::sample & sample);
+
+        /**
+         * flushes the buffer if the commit rate requires it
+         * @return true if the buffer was flushed
+         */
+        bool check(std::uint64_t time);
+
+        /** @return the number of samples dropped due to lack of buffer space */
+        [[nodiscard]] std::uint64_t getDroppedSamples() const { return droppedSamples; }
+
+    private:
+        IRawFrameBuilder & rawBuilder;
+        std::shared_ptr<CommitTimeChecker> flushIsNeeded;
+        std::size_t bytesPerBlock {0};
+        std::uint64_t droppedSamples {0};
+        bool loggedOversize {false};
+    };
+}
@@ -0,0 +1,70 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#include "mali_userspace/MaliSamplerPolledDriver.h"
+
+#include "DriverCounter.h"
+#include "PolledDriver.h"
+
+#include <cstdint>
+#include <string>
+
+#include <mxml.h>
+
+namespace mali_userspace {
+    namespace {
+        class MaliDroppedSamplesCounter : public DriverCounter {
+        public:
+            MaliDroppedSamplesCounter(DriverCounter * next, const char * const name, MaliSamplerPolledDriver & driver)
+                : DriverCounter(next, name), mDriver(driver)
+            {
+            }
+
+            // Intentionally unimplemented
+            MaliDroppedSamplesCounter(const MaliDroppedSamplesCounter &) = delete;
+            MaliDroppedSamplesCounter & operator=(const MaliDroppedSamplesCounter &) = delete;
+            MaliDroppedSamplesCounter(MaliDroppedSamplesCounter &&) = delete;
+            MaliDroppedSamplesCounter & operator=(MaliDroppedSamplesCounter &&) = delete;
+
+            int64_t read() override
+            {
+                const std::uint64_t total = mDriver.getDroppedSamples();
+                const std::uint64_t delta = total - mPrevious;
+                mPrevious = total;
+                return static_cast<int64_t>(delta);
+            }
+
+        private:
+            MaliSamplerPolledDriver & mDriver;
+            std::uint64_t mPrevious {0};
+        };
+    }
+
+    MaliSamplerPolledDriver::MaliSamplerPolledDriver(unsigned deviceNumber)
+        : PolledDriver("MaliSampler"), deviceNumber(deviceNumber)
+    {
+        counterName = ARM_MALI_DROPPED_SAMPLES.data() + std::to_string(deviceNumber);
+    }
+
+    void MaliSamplerPolledDriver::readEvents(mxml_node_t * const /*root*/)
+    {
+        setCounters(new MaliDroppedSamplesCounter(getCounters(), counterName.c_str(), *this));
+    }
+
+    void MaliSamplerPolledDriver::writeEvents(mxml_node_t * root) const
+    {
+        mxml_node_t * node = mxmlNewElement(root, "category");
+        mxmlElementSetAttr(node, "name", "Mali Misc");
+        mxmlElementSetAttr(node, "per_cpu", "no");
+
+        mxml_node_t * nodeEvent = mxmlNewElement(node, "event");
+        mxmlElementSetAttr(nodeEvent, "counter", counterName.c_str());
+        mxmlElementSetAttr(nodeEvent, "title", "Mali Sampler");
+        auto eventName = "Dropped samples (Device #" + std::to_string(deviceNumber) + ")";
+        mxmlElementSetAttr(nodeEvent, "name", eventName.c_str());
+        mxmlElementSetAttr(nodeEvent, "class", "delta");
+        mxmlElementSetAttr(nodeEvent, "display", "accumulate");
+        mxmlElementSetAttr(nodeEvent, "description",
+                           "The number of GPU counter samples lost because the sample buffer overflowed");
+        mxmlElementSetAttr(nodeEvent, "units", "samples");
+    }
+}
@@ -0,0 +1,54 @@
+/* Copyright (C) 2025 by Arm Limited. All rights reserved. */
+
+#ifndef MALI_USERSPACE_MALISAMPLERPOLLEDDRIVER_H_
+#define MALI_USERSPACE_MALISAMPLERPOLLEDDRIVER_H_
+
+#include "PolledDriver.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <mxml.h>
+
+namespace mali_userspace {
+
+    /**
+     * Exposes the health of the Mali hardware counter sampler as a counter, so that samples lost because the
+     * kernel's sample ring overflowed are visible in the capture rather than just as gaps in the data.
+     *
+     * The count is written by the MaliHwCntrTask thread and read by the polled counter thread.
+     */
+    class MaliSamplerPolledDriver : public PolledDriver {
+    public:
+        explicit MaliSamplerPolledDriver(unsigned deviceNumber);
+
+        // Intentionally unimplemented
+        MaliSamplerPolledDriver(const MaliSamplerPolledDriver &) = delete;
+        MaliSamplerPolledDriver & operator=(const MaliSamplerPolledDriver &) = delete;
+        MaliSamplerPolledDriver(MaliSamplerPolledDriver &&) = delete;
+        MaliSamplerPolledDriver & operator=(MaliSamplerPolledDriver &&) = delete;
+
+        void readEvents(mxml_node_t * const /*root*/) override;
+        void writeEvents(mxml_node_t * root) const override;
+
+        /** Record that some samples were lost */
+        void addDroppedSamples(std::uint64_t count) { mDroppedSamples.fetch_add(count, std::memory_order_relaxed); }
+
+        /** @return the total number of samples lost so far */
+        [[nodiscard]] std::uint64_t getDroppedSamples() const
+        {
+            return mDroppedSamples.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr std::string_view ARM_MALI_DROPPED_SAMPLES = "ARM_Mali-dropped-samples-";
+
+        unsigned deviceNumber;
+        std::string counterName;
+        std::atomic<std::uint64_t> mDroppedSamples {0};
+    };
+}
+
+#endif /* MALI_USERSPACE_MALISAMPLERPOLLEDDRIVER_H_ */
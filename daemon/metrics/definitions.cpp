@@ -8,13 +8,14 @@
 
 #include "metrics/definitions.hpp"
 
+#include <array>
 #include <cstdint>
 
 // NOLINTBEGIN(cert-err58-cpp)
 
 namespace metrics {
     namespace {
-        [[maybe_unused]] const metric_events_set_t backend_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_bound_0 {
             {
                 {std::uint16_t(0x003d), 10},
             },
@@ -32,7 +33,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t backend_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_bound_1 {
             {
                 {std::uint16_t(0x003d), 10},
                 {std::uint16_t(0x0010), 100},
@@ -51,7 +52,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t backend_busy_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_busy_bound_0 {
             {
                 {std::uint16_t(0x816b), 100},
                 {std::uint16_t(0x0024), 10},
@@ -69,7 +70,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_busy_ls_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_busy_ls_bound_0 {
             {
                 {std::uint16_t(0x0024), 10},
                 {std::uint16_t(0x00f1), 100},
@@ -87,7 +88,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_busy_vpu_arb_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_busy_vpu_arb_bound_0 {
             {
                 {std::uint16_t(0x00ef), 100},
                 {std::uint16_t(0x0024), 10},
@@ -105,7 +106,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cache_l1d_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cache_l1d_bound_0 {
             {
                 {std::uint16_t(0x4005), 100},
                 {std::uint16_t(0x8165), 100},
@@ -123,7 +124,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cache_l2d_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cache_l2d_bound_0 {
             {
                 {std::uint16_t(0x4005), 100},
                 {std::uint16_t(0x8165), 100},
@@ -141,7 +142,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cme_backpressure_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cme_backpressure_bound_0 {
             {
                 {std::uint16_t(0x3200), 100},
                 {std::uint16_t(0x3201), 100},
@@ -159,7 +160,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cme_busy_arb_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cme_busy_arb_bound_0 {
             {
                 {std::uint16_t(0x3200), 100},
                 {std::uint16_t(0x3202), 100},
@@ -177,7 +178,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cme_busy_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cme_busy_bound_0 {
             {
                 {std::uint16_t(0x3200), 100},
                 {std::uint16_t(0x816b), 100},
@@ -194,7 +195,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cme_busy_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cme_busy_bound_1 {
             {
                 {std::uint16_t(0x3200), 100},
             },
@@ -210,7 +211,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_cme_cpu_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_cme_cpu_bound_0 {
             {
                 {std::uint16_t(0x3203), 100},
                 {std::uint16_t(0x3200), 100},
@@ -228,7 +229,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_core_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_core_bound_0 {
             {
                 {std::uint16_t(0x0024), 10},
                 {std::uint16_t(0x816a), 100},
@@ -246,7 +247,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_core_cme_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_core_cme_bound_0 {
             {
                 {std::uint16_t(0x3200), 100},
                 {std::uint16_t(0x816a), 100},
@@ -264,7 +265,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_core_other_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_core_other_bound_0 {
             {
                 {std::uint16_t(0x1003), 100},
                 {std::uint16_t(0x1005), 100},
@@ -283,7 +284,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_core_other_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_core_other_bound_1 {
             {
                 {std::uint16_t(0x1338), 100},
                 {std::uint16_t(0x816a), 100},
@@ -301,7 +302,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_core_rename_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_core_rename_bound_0 {
             {
                 {std::uint16_t(0x816a), 100},
                 {std::uint16_t(0x816d), 100},
@@ -319,7 +320,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_core_spec_throttle_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_core_spec_throttle_bound_0 {
             {
                 {std::uint16_t(0x3009), 100},
                 {std::uint16_t(0x816a), 100},
@@ -337,7 +338,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_bound_0 {
             {
                 {std::uint16_t(0x4005), 100},
                 {std::uint16_t(0x0024), 10},
@@ -355,7 +356,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_bound_1 {
             {
                 {std::uint16_t(0x0024), 10},
                 {std::uint16_t(0x8164), 100},
@@ -373,7 +374,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cache_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cache_bound_0 {
             {
                 {std::uint16_t(0x4005), 100},
                 {std::uint16_t(0x8165), 100},
@@ -392,7 +393,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cache_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cache_bound_1 {
             {
                 {std::uint16_t(0x4005), 100},
                 {std::uint16_t(0x8165), 100},
@@ -411,7 +412,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cme_barrier_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cme_barrier_bound_0 {
             {
                 {std::uint16_t(0x3210), 100},
                 {std::uint16_t(0x320d), 100},
@@ -429,7 +430,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cme_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cme_bound_0 {
             {
                 {std::uint16_t(0x3210), 100},
                 {std::uint16_t(0x8164), 100},
@@ -449,7 +450,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cme_hazard_cpu_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cme_hazard_cpu_bound_0 {
             {
                 {std::uint16_t(0x3210), 100},
                 {std::uint16_t(0x320e), 100},
@@ -468,7 +469,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cme_lsrt_full_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cme_lsrt_full_bound_0 {
             {
                 {std::uint16_t(0x3210), 100},
                 {std::uint16_t(0x320c), 100},
@@ -487,7 +488,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_cpu_hazard_cme_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_cpu_hazard_cme_bound_0 {
             {
                 {std::uint16_t(0x3210), 100},
                 {std::uint16_t(0x320f), 100},
@@ -507,7 +508,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_store_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_store_bound_0 {
             {
                 {std::uint16_t(0x8168), 100},
                 {std::uint16_t(0x8164), 100},
@@ -525,7 +526,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_store_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_store_bound_1 {
             {
                 {std::uint16_t(0x8168), 100},
                 {std::uint16_t(0x8164), 100},
@@ -543,7 +544,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_tlb_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_tlb_bound_0 {
             {
                 {std::uint16_t(0x8164), 100},
                 {std::uint16_t(0x8167), 100},
@@ -561,7 +562,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_mem_tlb_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_mem_tlb_bound_1 {
             {
                 {std::uint16_t(0x8164), 100},
                 {std::uint16_t(0x8167), 100},
@@ -579,7 +580,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_stall_interlock_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_stall_interlock_bound_0 {
             {
                 {std::uint16_t(0x00e4), 100},
                 {std::uint16_t(0x0024), 10},
@@ -598,7 +599,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_stall_interlock_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_stall_interlock_bound_1 {
             {
                 {std::uint16_t(0x816c), 100},
                 {std::uint16_t(0x0024), 10},
@@ -617,7 +618,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_stall_interlock_ls_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_stall_interlock_ls_bound_0 {
             {
                 {std::uint16_t(0x00f2), 100},
                 {std::uint16_t(0x0024), 10},
@@ -637,7 +638,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_stall_interlock_ptr_chase_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_stall_interlock_ptr_chase_bound_0 {
             {
                 {std::uint16_t(0x0024), 10},
                 {std::uint16_t(0x00f3), 100},
@@ -658,7 +659,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_stall_interlock_vpu_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_stall_interlock_vpu_bound_0 {
             {
                 {std::uint16_t(0x00e6), 100},
                 {std::uint16_t(0x0024), 10},
@@ -676,7 +677,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t backend_stalled_cycles_0 {
+        [[maybe_unused]] constexpr metric_events_set_t backend_stalled_cycles_0 {
             {
                 {std::uint16_t(0x0024), 10},
             },
@@ -694,7 +695,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t bad_speculation_0 {
+        [[maybe_unused]] constexpr metric_events_set_t bad_speculation_0 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003f), 10},
@@ -715,7 +716,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t bad_speculation_1 {
+        [[maybe_unused]] constexpr metric_events_set_t bad_speculation_1 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003f), 10},
@@ -736,7 +737,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t bad_speculation_2 {
+        [[maybe_unused]] constexpr metric_events_set_t bad_speculation_2 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003f), 10},
@@ -757,7 +758,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t barrier_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t barrier_percentage_0 {
             {
                 {std::uint16_t(0x007e), 10},
                 {std::uint16_t(0x007d), 10},
@@ -777,7 +778,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_direct_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_direct_ratio_0 {
             {
                 {std::uint16_t(0x0021), 10},
                 {std::uint16_t(0x000d), 10},
@@ -796,7 +797,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_indirect_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_indirect_ratio_0 {
             {
                 {std::uint16_t(0x0021), 10},
                 {std::uint16_t(0x811d), 10},
@@ -815,7 +816,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_misprediction_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_misprediction_ratio_0 {
             {
                 {std::uint16_t(0x0021), 10},
                 {std::uint16_t(0x0022), 100},
@@ -835,7 +836,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_mpki_0 {
             {
                 {std::uint16_t(0x0008), 1},
                 {std::uint16_t(0x0010), 100},
@@ -853,7 +854,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_mpki_1 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_mpki_1 {
             {
                 {std::uint16_t(0x0022), 100},
                 {std::uint16_t(0x0008), 1},
@@ -872,7 +873,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_percentage_0 {
             {
                 {std::uint16_t(0x0078), 10},
                 {std::uint16_t(0x007a), 10},
@@ -890,7 +891,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_percentage_1 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_percentage_1 {
             {
                 {std::uint16_t(0x0076), 10},
                 {std::uint16_t(0x001b), 1},
@@ -908,7 +909,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_percentage_2 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_percentage_2 {
             {
                 {std::uint16_t(0x0076), 10},
                 {std::uint16_t(0x001b), 1},
@@ -925,7 +926,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t branch_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_port_utilization_0 {
             {
                 {std::uint16_t(0x3000), 10},
             },
@@ -942,7 +943,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t branch_return_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t branch_return_ratio_0 {
             {
                 {std::uint16_t(0x0021), 10},
                 {std::uint16_t(0x000e), 10},
@@ -961,7 +962,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t bus_access_average_count_0 {
+        [[maybe_unused]] constexpr metric_events_set_t bus_access_average_count_0 {
             {
                 {std::uint16_t(0x0061), 1},
                 {std::uint16_t(0x818f), 1},
@@ -980,7 +981,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t bus_read_requests_average_latency_0 {
+        [[maybe_unused]] constexpr metric_events_set_t bus_read_requests_average_latency_0 {
             {
                 {std::uint16_t(0x8125), 1},
                 {std::uint16_t(0x818d), 1},
@@ -999,7 +1000,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cas_far_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cas_far_ratio_0 {
             {
                 {std::uint16_t(0x8174), 10},
                 {std::uint16_t(0x8172), 10},
@@ -1017,7 +1018,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cas_near_fail_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cas_near_fail_ratio_0 {
             {
                 {std::uint16_t(0x8172), 10},
                 {std::uint16_t(0x8171), 100},
@@ -1035,7 +1036,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cas_near_pass_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cas_near_pass_ratio_0 {
             {
                 {std::uint16_t(0x8172), 10},
                 {std::uint16_t(0x8171), 100},
@@ -1053,7 +1054,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cas_near_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cas_near_ratio_0 {
             {
                 {std::uint16_t(0x8174), 10},
                 {std::uint16_t(0x8172), 10},
@@ -1071,7 +1072,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_alloc_cycles_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_alloc_cycles_ratio_0 {
             {
                 {std::uint16_t(0x3213), 10},
             },
@@ -1088,7 +1089,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t cme_alu_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_alu_port_utilization_0 {
             {
                 {std::uint16_t(0x3246), 1},
                 {std::uint16_t(0x3260), 10},
@@ -1105,7 +1106,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_arb_pending_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_arb_pending_ratio_0 {
             {
                 {std::uint16_t(0x3214), 10},
             },
@@ -1122,7 +1123,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t cme_backend_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_backend_bound_0 {
             {
                 {std::uint16_t(0x324d), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1141,7 +1142,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_backend_core_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_backend_core_bound_0 {
             {
                 {std::uint16_t(0x324d), 10},
                 {std::uint16_t(0x324e), 100},
@@ -1159,7 +1160,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_backend_mem_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_backend_mem_bound_0 {
             {
                 {std::uint16_t(0x324f), 100},
                 {std::uint16_t(0x324d), 10},
@@ -1177,7 +1178,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_backend_mem_cache_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_backend_mem_cache_bound_0 {
             {
                 {std::uint16_t(0x324f), 100},
                 {std::uint16_t(0x3251), 100},
@@ -1195,7 +1196,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_backend_mem_store_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_backend_mem_store_bound_0 {
             {
                 {std::uint16_t(0x324f), 100},
                 {std::uint16_t(0x3252), 100},
@@ -1213,7 +1214,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_backend_prefetch_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_backend_prefetch_bound_0 {
             {
                 {std::uint16_t(0x324d), 10},
                 {std::uint16_t(0x3250), 100},
@@ -1231,7 +1232,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_bus_access_average_length_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_bus_access_average_length_0 {
             {
                 {std::uint16_t(0x3267), 1},
                 {std::uint16_t(0x326b), 1},
@@ -1248,7 +1249,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_frontend_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_frontend_bound_0 {
             {
                 {std::uint16_t(0x3246), 1},
                 {std::uint16_t(0x324a), 10},
@@ -1267,7 +1268,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_frontend_cpu_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_frontend_cpu_bound_0 {
             {
                 {std::uint16_t(0x324a), 10},
                 {std::uint16_t(0x324b), 100},
@@ -1285,7 +1286,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_frontend_other_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_frontend_other_bound_0 {
             {
                 {std::uint16_t(0x324a), 10},
                 {std::uint16_t(0x324c), 100},
@@ -1303,7 +1304,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_ipc_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_ipc_0 {
             {
                 {std::uint16_t(0x3247), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1321,7 +1322,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_iq_dp0_stall_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_iq_dp0_stall_percentage_0 {
             {
                 {std::uint16_t(0x325d), 100},
                 {std::uint16_t(0x324d), 10},
@@ -1339,7 +1340,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_iq_dp1_stall_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_iq_dp1_stall_percentage_0 {
             {
                 {std::uint16_t(0x324d), 10},
                 {std::uint16_t(0x325e), 100},
@@ -1357,7 +1358,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_iq_load_stall_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_iq_load_stall_percentage_0 {
             {
                 {std::uint16_t(0x325f), 100},
                 {std::uint16_t(0x324d), 10},
@@ -1375,7 +1376,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l1_prefetcher_accuracy_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l1_prefetcher_accuracy_0 {
             {
                 {std::uint16_t(0x32b2), 100},
                 {std::uint16_t(0x32ad), 100},
@@ -1393,7 +1394,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l1_prefetcher_coverage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l1_prefetcher_coverage_0 {
             {
                 {std::uint16_t(0x3281), 100},
                 {std::uint16_t(0x32ad), 100},
@@ -1412,7 +1413,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l1_prefetcher_timeliness_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l1_prefetcher_timeliness_0 {
             {
                 {std::uint16_t(0x32ad), 100},
                 {std::uint16_t(0x3274), 10},
@@ -1429,7 +1430,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l1d_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l1d_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x326f), 10},
                 {std::uint16_t(0x3270), 10},
@@ -1449,7 +1450,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l1d_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l1d_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x326f), 10},
                 {std::uint16_t(0x327c), 100},
@@ -1469,7 +1470,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l1d_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l1d_cache_mpki_0 {
             {
                 {std::uint16_t(0x327c), 100},
                 {std::uint16_t(0x3247), 10},
@@ -1489,7 +1490,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l3d_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l3d_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x3287), 10},
                 {std::uint16_t(0x328e), 10},
@@ -1509,7 +1510,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l3d_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l3d_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x3287), 10},
                 {std::uint16_t(0x3290), 100},
@@ -1529,7 +1530,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_l3d_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_l3d_cache_mpki_0 {
             {
                 {std::uint16_t(0x3247), 10},
                 {std::uint16_t(0x3290), 100},
@@ -1549,7 +1550,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_ll_cache_read_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_ll_cache_read_hit_ratio_0 {
             {
                 {std::uint16_t(0x3295), 100},
                 {std::uint16_t(0x3294), 10},
@@ -1567,7 +1568,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_ll_cache_read_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_ll_cache_read_miss_ratio_0 {
             {
                 {std::uint16_t(0x3295), 100},
                 {std::uint16_t(0x3294), 10},
@@ -1587,7 +1588,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_ll_cache_read_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_ll_cache_read_mpki_0 {
             {
                 {std::uint16_t(0x3295), 100},
                 {std::uint16_t(0x3247), 10},
@@ -1607,7 +1608,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_load_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_load_percentage_0 {
             {
                 {std::uint16_t(0x3254), 10},
                 {std::uint16_t(0x3247), 10},
@@ -1625,7 +1626,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_mac_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_mac_port_utilization_0 {
             {
                 {std::uint16_t(0x3261), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1642,7 +1643,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_mmdp_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_mmdp_port_utilization_0 {
             {
                 {std::uint16_t(0x3246), 1},
                 {std::uint16_t(0x3264), 10},
@@ -1660,7 +1661,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_mmmv_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_mmmv_port_utilization_0 {
             {
                 {std::uint16_t(0x3265), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1678,7 +1679,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_perm_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_perm_port_utilization_0 {
             {
                 {std::uint16_t(0x3262), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1695,7 +1696,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_retiring_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_retiring_0 {
             {
                 {std::uint16_t(0x324d), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1714,7 +1715,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_st_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_st_port_utilization_0 {
             {
                 {std::uint16_t(0x3263), 10},
                 {std::uint16_t(0x3246), 1},
@@ -1731,7 +1732,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_store_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_store_percentage_0 {
             {
                 {std::uint16_t(0x3259), 10},
                 {std::uint16_t(0x3247), 10},
@@ -1749,7 +1750,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_system_dram_mem_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_system_dram_mem_hit_ratio_0 {
             {
                 {std::uint16_t(0x327c), 100},
                 {std::uint16_t(0x32ac), 1},
@@ -1767,7 +1768,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_system_l3d_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_system_l3d_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x327c), 100},
                 {std::uint16_t(0x328e), 10},
@@ -1785,7 +1786,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cme_system_ll_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cme_system_ll_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x327c), 100},
                 {std::uint16_t(0x3296), 10},
@@ -1804,7 +1805,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t cpi_0 {
+        [[maybe_unused]] constexpr metric_events_set_t cpi_0 {
             {
                 {std::uint16_t(0x0008), 1},
             },
@@ -1820,7 +1821,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t crypto_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t crypto_percentage_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x0077), 10},
@@ -1837,7 +1838,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_mpki_0 {
             {
                 {std::uint16_t(0x0008), 1},
                 {std::uint16_t(0x0034), 100},
@@ -1855,7 +1856,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_average_depth_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_average_depth_0 {
             {
                 {std::uint16_t(0x8136), 10},
                 {std::uint16_t(0x0034), 100},
@@ -1872,7 +1873,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_average_latency_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_average_latency_0 {
             {
                 {std::uint16_t(0x8128), 100},
                 {std::uint16_t(0x0034), 100},
@@ -1890,7 +1891,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_block_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_block_ratio_0 {
             {
                 {std::uint16_t(0x8188), 100},
                 {std::uint16_t(0x0025), 10},
@@ -1908,7 +1909,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_large_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_large_ratio_0 {
             {
                 {std::uint16_t(0x8138), 100},
                 {std::uint16_t(0x0025), 10},
@@ -1926,7 +1927,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_page_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_page_ratio_0 {
             {
                 {std::uint16_t(0x818a), 100},
                 {std::uint16_t(0x0025), 10},
@@ -1944,7 +1945,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_ratio_0 {
             {
                 {std::uint16_t(0x0025), 10},
                 {std::uint16_t(0x0034), 100},
@@ -1963,7 +1964,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t dtlb_walk_small_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t dtlb_walk_small_ratio_0 {
             {
                 {std::uint16_t(0x813a), 100},
                 {std::uint16_t(0x0025), 10},
@@ -1981,7 +1982,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t fp16_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t fp16_percentage_0 {
             {
                 {std::uint16_t(0x8014), 10},
                 {std::uint16_t(0x001b), 1},
@@ -1999,7 +2000,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t fp32_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t fp32_percentage_0 {
             {
                 {std::uint16_t(0x8018), 10},
                 {std::uint16_t(0x001b), 1},
@@ -2017,7 +2018,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t fp64_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t fp64_percentage_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x801c), 10},
@@ -2035,7 +2036,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t fp_ops_per_cycle_0 {
+        [[maybe_unused]] constexpr metric_events_set_t fp_ops_per_cycle_0 {
             {
                 {std::uint16_t(0x80c0), 10},
                 {std::uint16_t(0x80c1), 10},
@@ -2054,7 +2055,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_bound_0 {
             {
                 {std::uint16_t(0x003e), 10},
                 {std::uint16_t(0x8162), 100},
@@ -2073,7 +2074,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_bound_1 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_bound_1 {
             {
                 {std::uint16_t(0x003e), 10},
                 {std::uint16_t(0x0010), 100},
@@ -2092,7 +2093,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_bound_2 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_bound_2 {
             {
                 {std::uint16_t(0x003e), 10},
                 {std::uint16_t(0x0010), 100},
@@ -2111,7 +2112,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_cache_l1i_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_cache_l1i_bound_0 {
             {
                 {std::uint16_t(0x8159), 100},
                 {std::uint16_t(0x815b), 100},
@@ -2129,7 +2130,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_cache_l2i_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_cache_l2i_bound_0 {
             {
                 {std::uint16_t(0x8159), 100},
                 {std::uint16_t(0x815b), 100},
@@ -2147,7 +2148,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_core_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_core_bound_0 {
             {
                 {std::uint16_t(0x8160), 100},
                 {std::uint16_t(0x0023), 10},
@@ -2165,7 +2166,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_core_flow_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_core_flow_bound_0 {
             {
                 {std::uint16_t(0x8161), 100},
                 {std::uint16_t(0x8160), 100},
@@ -2183,7 +2184,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_core_flush_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_core_flush_bound_0 {
             {
                 {std::uint16_t(0x8160), 100},
                 {std::uint16_t(0x8162), 100},
@@ -2201,7 +2202,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_core_flush_machine_clear_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_core_flush_machine_clear_bound_0 {
             {
                 {std::uint16_t(0x8162), 100},
                 {std::uint16_t(0x3006), 100},
@@ -2219,7 +2220,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_core_flush_resteer_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_core_flush_resteer_bound_0 {
             {
                 {std::uint16_t(0x3007), 100},
                 {std::uint16_t(0x8162), 100},
@@ -2237,7 +2238,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_core_spec_throttle_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_core_spec_throttle_bound_0 {
             {
                 {std::uint16_t(0x3005), 100},
                 {std::uint16_t(0x8160), 100},
@@ -2255,7 +2256,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_mem_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_mem_bound_0 {
             {
                 {std::uint16_t(0x8158), 100},
                 {std::uint16_t(0x0023), 10},
@@ -2273,7 +2274,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_mem_cache_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_mem_cache_bound_0 {
             {
                 {std::uint16_t(0x8158), 100},
                 {std::uint16_t(0x8159), 100},
@@ -2292,7 +2293,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_mem_tlb_bound_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_mem_tlb_bound_0 {
             {
                 {std::uint16_t(0x815c), 100},
                 {std::uint16_t(0x8158), 100},
@@ -2310,7 +2311,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t frontend_stalled_cycles_0 {
+        [[maybe_unused]] constexpr metric_events_set_t frontend_stalled_cycles_0 {
             {
                 {std::uint16_t(0x0023), 10},
             },
@@ -2328,7 +2329,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t instruction_fetch_average_latency_0 {
+        [[maybe_unused]] constexpr metric_events_set_t instruction_fetch_average_latency_0 {
             {
                 {std::uint16_t(0x8120), 1},
                 {std::uint16_t(0x8124), 1},
@@ -2345,7 +2346,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t int_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t int_port_utilization_0 {
             {
                 {std::uint16_t(0x3001), 10},
             },
@@ -2362,7 +2363,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t integer_dp_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t integer_dp_percentage_0 {
             {
                 {std::uint16_t(0x007d), 10},
                 {std::uint16_t(0x0073), 10},
@@ -2381,7 +2382,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t integer_dp_percentage_1 {
+        [[maybe_unused]] constexpr metric_events_set_t integer_dp_percentage_1 {
             {
                 {std::uint16_t(0x0073), 10},
                 {std::uint16_t(0x001b), 1},
@@ -2399,7 +2400,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t ipc_0 {
+        [[maybe_unused]] constexpr metric_events_set_t ipc_0 {
             {
                 {std::uint16_t(0x0008), 1},
             },
@@ -2416,7 +2417,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t iq_stall_lsu_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t iq_stall_lsu_percentage_0 {
             {
                 {std::uint16_t(0x015e), 100},
                 {std::uint16_t(0x816b), 100},
@@ -2434,7 +2435,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t iq_stall_mx_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t iq_stall_mx_percentage_0 {
             {
                 {std::uint16_t(0x015d), 100},
                 {std::uint16_t(0x816b), 100},
@@ -2452,7 +2453,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t iq_stall_sx_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t iq_stall_sx_percentage_0 {
             {
                 {std::uint16_t(0x816b), 100},
                 {std::uint16_t(0x015c), 100},
@@ -2470,7 +2471,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t iq_stall_vpu_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t iq_stall_vpu_percentage_0 {
             {
                 {std::uint16_t(0x816b), 100},
                 {std::uint16_t(0x015f), 100},
@@ -2488,7 +2489,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_mpki_0 {
             {
                 {std::uint16_t(0x0035), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2506,7 +2507,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_average_depth_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_average_depth_0 {
             {
                 {std::uint16_t(0x0035), 100},
                 {std::uint16_t(0x8137), 10},
@@ -2523,7 +2524,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_average_latency_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_average_latency_0 {
             {
                 {std::uint16_t(0x0035), 100},
                 {std::uint16_t(0x8129), 100},
@@ -2541,7 +2542,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_block_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_block_ratio_0 {
             {
                 {std::uint16_t(0x0026), 10},
                 {std::uint16_t(0x8189), 100},
@@ -2560,7 +2561,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_large_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_large_ratio_0 {
             {
                 {std::uint16_t(0x8139), 100},
                 {std::uint16_t(0x0026), 10},
@@ -2578,7 +2579,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_page_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_page_ratio_0 {
             {
                 {std::uint16_t(0x818b), 100},
                 {std::uint16_t(0x0026), 10},
@@ -2596,7 +2597,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_ratio_0 {
             {
                 {std::uint16_t(0x0035), 100},
                 {std::uint16_t(0x0026), 10},
@@ -2615,7 +2616,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t itlb_walk_small_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t itlb_walk_small_ratio_0 {
             {
                 {std::uint16_t(0x813b), 100},
                 {std::uint16_t(0x0026), 10},
@@ -2633,7 +2634,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1_prefetcher_accuracy_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1_prefetcher_accuracy_0 {
             {
                 {std::uint16_t(0x81ec), 10},
                 {std::uint16_t(0x81bc), 100},
@@ -2651,7 +2652,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1_prefetcher_accuracy_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l1_prefetcher_accuracy_1 {
             {
                 {std::uint16_t(0x81ec), 10},
                 {std::uint16_t(0x81bc), 100},
@@ -2669,7 +2670,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1_prefetcher_coverage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1_prefetcher_coverage_0 {
             {
                 {std::uint16_t(0x81ec), 10},
                 {std::uint16_t(0x0042), 100},
@@ -2688,7 +2689,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1_prefetcher_timeliness_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1_prefetcher_timeliness_0 {
             {
                 {std::uint16_t(0x81ec), 10},
                 {std::uint16_t(0x826c), 100},
@@ -2705,7 +2706,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_cache_demand_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_cache_demand_mpki_0 {
             {
                 {std::uint16_t(0x0042), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2725,7 +2726,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x0042), 100},
                 {std::uint16_t(0x8140), 10},
@@ -2746,7 +2747,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_cache_miss_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_cache_miss_ratio_1 {
             {
                 {std::uint16_t(0x0003), 100},
                 {std::uint16_t(0x0004), 10},
@@ -2766,7 +2767,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_cache_mpki_0 {
             {
                 {std::uint16_t(0x0042), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2786,7 +2787,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_cache_mpki_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_cache_mpki_1 {
             {
                 {std::uint16_t(0x0008), 1},
                 {std::uint16_t(0x0003), 100},
@@ -2805,7 +2806,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_tlb_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_tlb_miss_ratio_0 {
             {
                 {std::uint16_t(0x0005), 100},
                 {std::uint16_t(0x0025), 10},
@@ -2824,7 +2825,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1d_tlb_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1d_tlb_mpki_0 {
             {
                 {std::uint16_t(0x0005), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2842,7 +2843,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1i_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1i_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x0001), 100},
                 {std::uint16_t(0x0014), 10},
@@ -2863,7 +2864,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1i_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1i_cache_mpki_0 {
             {
                 {std::uint16_t(0x0001), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2883,7 +2884,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1i_tlb_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1i_tlb_miss_ratio_0 {
             {
                 {std::uint16_t(0x0002), 100},
                 {std::uint16_t(0x0026), 10},
@@ -2902,7 +2903,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l1i_tlb_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l1i_tlb_mpki_0 {
             {
                 {std::uint16_t(0x0002), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2921,7 +2922,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x0052), 100},
                 {std::uint16_t(0x0053), 100},
@@ -2944,7 +2945,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_cache_miss_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_cache_miss_ratio_1 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0016), 10},
@@ -2966,7 +2967,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_cache_mpki_0 {
             {
                 {std::uint16_t(0x0052), 100},
                 {std::uint16_t(0x0008), 1},
@@ -2988,7 +2989,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_cache_mpki_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_cache_mpki_1 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3009,7 +3010,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_accuracy_l1hwprf_exclusive_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_accuracy_l1hwprf_exclusive_0 {
             {
                 {std::uint16_t(0x81ed), 10},
                 {std::uint16_t(0x81bd), 100},
@@ -3027,7 +3028,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_accuracy_l1hwprf_exclusive_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_accuracy_l1hwprf_exclusive_1 {
             {
                 {std::uint16_t(0x81ed), 10},
                 {std::uint16_t(0x81bd), 100},
@@ -3045,7 +3046,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_accuracy_l1hwprf_inclusive_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_accuracy_l1hwprf_inclusive_0 {
             {
                 {std::uint16_t(0x0179), 10},
                 {std::uint16_t(0x010b), 100},
@@ -3063,7 +3064,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_accuracy_l1hwprf_inclusive_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_accuracy_l1hwprf_inclusive_1 {
             {
                 {std::uint16_t(0x0179), 10},
                 {std::uint16_t(0x010b), 100},
@@ -3081,7 +3082,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_coverage_l1hwprf_exclusive_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_coverage_l1hwprf_exclusive_0 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x01b9), 100},
@@ -3101,7 +3102,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_coverage_l1hwprf_exclusive_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_coverage_l1hwprf_exclusive_1 {
             {
                 {std::uint16_t(0x0052), 100},
                 {std::uint16_t(0x81ed), 10},
@@ -3120,7 +3121,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_coverage_l1hwprf_inclusive_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_coverage_l1hwprf_inclusive_0 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0179), 10},
@@ -3139,7 +3140,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_timeliness_l1hwprf_exclusive_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_timeliness_l1hwprf_exclusive_0 {
             {
                 {std::uint16_t(0x81ed), 10},
                 {std::uint16_t(0x826d), 100},
@@ -3156,7 +3157,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_prefetcher_timeliness_l1hwprf_inclusive_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_prefetcher_timeliness_l1hwprf_inclusive_0 {
             {
                 {std::uint16_t(0x0179), 10},
                 {std::uint16_t(0x010b), 100},
@@ -3173,7 +3174,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_tlb_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_tlb_miss_ratio_0 {
             {
                 {std::uint16_t(0x002d), 100},
                 {std::uint16_t(0x002f), 10},
@@ -3193,7 +3194,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2_tlb_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2_tlb_mpki_0 {
             {
                 {std::uint16_t(0x002d), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3213,7 +3214,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2d_cache_demand_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2d_cache_demand_mpki_0 {
             {
                 {std::uint16_t(0x0052), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3235,7 +3236,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2d_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2d_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x0052), 100},
                 {std::uint16_t(0x0053), 100},
@@ -3258,7 +3259,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2d_cache_miss_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2d_cache_miss_ratio_1 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0051), 10},
@@ -3281,7 +3282,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2d_cache_miss_ratio_2 {
+        [[maybe_unused]] constexpr metric_events_set_t l2d_cache_miss_ratio_2 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0016), 10},
@@ -3303,7 +3304,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2d_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2d_cache_mpki_0 {
             {
                 {std::uint16_t(0x0052), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3325,7 +3326,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2d_cache_mpki_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l2d_cache_mpki_1 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3346,7 +3347,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2i_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2i_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x0028), 100},
                 {std::uint16_t(0x0027), 10},
@@ -3368,7 +3369,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l2i_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l2i_cache_mpki_0 {
             {
                 {std::uint16_t(0x0028), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3389,7 +3390,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l3_cache_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l3_cache_miss_ratio_0 {
             {
                 {std::uint16_t(0x002a), 100},
                 {std::uint16_t(0x002b), 10},
@@ -3411,7 +3412,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l3_cache_miss_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l3_cache_miss_ratio_1 {
             {
                 {std::uint16_t(0x00a2), 100},
                 {std::uint16_t(0x00a0), 10},
@@ -3433,7 +3434,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l3_cache_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t l3_cache_mpki_0 {
             {
                 {std::uint16_t(0x002a), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3454,7 +3455,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t l3_cache_mpki_1 {
+        [[maybe_unused]] constexpr metric_events_set_t l3_cache_mpki_1 {
             {
                 {std::uint16_t(0x00a2), 100},
                 {std::uint16_t(0x0008), 1},
@@ -3475,7 +3476,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t ldrex_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t ldrex_percentage_0 {
             {
                 {std::uint16_t(0x006c), 10},
                 {std::uint16_t(0x001b), 1},
@@ -3493,7 +3494,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t ll_cache_read_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t ll_cache_read_hit_ratio_0 {
             {
                 {std::uint16_t(0x0036), 10},
                 {std::uint16_t(0x0037), 100},
@@ -3514,7 +3515,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t ll_cache_read_miss_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t ll_cache_read_miss_ratio_0 {
             {
                 {std::uint16_t(0x0036), 10},
                 {std::uint16_t(0x0037), 100},
@@ -3536,7 +3537,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t ll_cache_read_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t ll_cache_read_mpki_0 {
             {
                 {std::uint16_t(0x0008), 1},
                 {std::uint16_t(0x0037), 100},
@@ -3556,7 +3557,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t load_average_latency_0 {
+        [[maybe_unused]] constexpr metric_events_set_t load_average_latency_0 {
             {
                 {std::uint16_t(0x0013), 10},
                 {std::uint16_t(0x8121), 10},
@@ -3573,7 +3574,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t load_ls_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t load_ls_percentage_0 {
             {
                 {std::uint16_t(0x0070), 10},
                 {std::uint16_t(0x0072), 10},
@@ -3590,7 +3591,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t load_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t load_percentage_0 {
             {
                 {std::uint16_t(0x0070), 10},
                 {std::uint16_t(0x001b), 1},
@@ -3608,7 +3609,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t load_store_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t load_store_percentage_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x0072), 10},
@@ -3625,7 +3626,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t lse_atomics_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t lse_atomics_ratio_0 {
             {
                 {std::uint16_t(0x8177), 10},
                 {std::uint16_t(0x0072), 10},
@@ -3643,7 +3644,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t lse_load_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t lse_load_ratio_0 {
             {
                 {std::uint16_t(0x8177), 10},
                 {std::uint16_t(0x8175), 10},
@@ -3661,7 +3662,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t lse_store_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t lse_store_ratio_0 {
             {
                 {std::uint16_t(0x8177), 10},
                 {std::uint16_t(0x8176), 10},
@@ -3679,7 +3680,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t lsu_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t lsu_port_utilization_0 {
             {
                 {std::uint16_t(0x3003), 10},
             },
@@ -3696,7 +3697,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t mcq_stall_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t mcq_stall_percentage_0 {
             {
                 {std::uint16_t(0x0160), 100},
                 {std::uint16_t(0x816a), 100},
@@ -3713,7 +3714,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t nonsve_fp_ops_per_cycle_0 {
+        [[maybe_unused]] constexpr metric_events_set_t nonsve_fp_ops_per_cycle_0 {
             {
                 {std::uint16_t(0x80c1), 10},
             },
@@ -3731,7 +3732,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t rc_ld_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t rc_ld_percentage_0 {
             {
                 {std::uint16_t(0x0090), 10},
                 {std::uint16_t(0x001b), 1},
@@ -3750,7 +3751,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rc_st_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t rc_st_percentage_0 {
             {
                 {std::uint16_t(0x0091), 10},
                 {std::uint16_t(0x001b), 1},
@@ -3769,7 +3770,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_flags_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_flags_ratio_0 {
             {
                 {std::uint16_t(0x0399), 100},
                 {std::uint16_t(0x0159), 100},
@@ -3788,7 +3789,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_flags_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_flags_ratio_1 {
             {
                 {std::uint16_t(0x0158), 100},
                 {std::uint16_t(0x816d), 100},
@@ -3805,7 +3806,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_int_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_int_ratio_0 {
             {
                 {std::uint16_t(0x0399), 100},
                 {std::uint16_t(0x0159), 100},
@@ -3824,7 +3825,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_int_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_int_ratio_1 {
             {
                 {std::uint16_t(0x0159), 100},
                 {std::uint16_t(0x816d), 100},
@@ -3841,7 +3842,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_pred_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_pred_ratio_0 {
             {
                 {std::uint16_t(0x0399), 100},
                 {std::uint16_t(0x0159), 100},
@@ -3860,7 +3861,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_pred_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_pred_ratio_1 {
             {
                 {std::uint16_t(0x0170), 100},
                 {std::uint16_t(0x816d), 100},
@@ -3877,7 +3878,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_vec_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_vec_ratio_0 {
             {
                 {std::uint16_t(0x0399), 100},
                 {std::uint16_t(0x0159), 100},
@@ -3896,7 +3897,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t rename_stall_vec_ratio_1 {
+        [[maybe_unused]] constexpr metric_events_set_t rename_stall_vec_ratio_1 {
             {
                 {std::uint16_t(0x015a), 100},
                 {std::uint16_t(0x816d), 100},
@@ -3913,7 +3914,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t retired_insns_percent_0 {
+        [[maybe_unused]] constexpr metric_events_set_t retired_insns_percent_0 {
             {
                 {std::uint16_t(0x0008), 1},
                 {std::uint16_t(0x001b), 1},
@@ -3930,7 +3931,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t retired_ops_percent_0 {
+        [[maybe_unused]] constexpr metric_events_set_t retired_ops_percent_0 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003b), 10},
@@ -3947,7 +3948,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t retiring_0 {
+        [[maybe_unused]] constexpr metric_events_set_t retiring_0 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003f), 10},
@@ -3967,7 +3968,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t retiring_1 {
+        [[maybe_unused]] constexpr metric_events_set_t retiring_1 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003f), 10},
@@ -3987,7 +3988,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t retiring_2 {
+        [[maybe_unused]] constexpr metric_events_set_t retiring_2 {
             {
                 {std::uint16_t(0x003a), 10},
                 {std::uint16_t(0x003f), 10},
@@ -4007,7 +4008,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t scalar_fp_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t scalar_fp_percentage_0 {
             {
                 {std::uint16_t(0x0075), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4026,7 +4027,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t simd_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t simd_percentage_0 {
             {
                 {std::uint16_t(0x0074), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4044,7 +4045,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sme_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sme_percentage_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x835e), 10},
@@ -4062,7 +4063,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t std_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t std_port_utilization_0 {
             {
                 {std::uint16_t(0x3004), 10},
             },
@@ -4079,7 +4080,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t store_ls_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t store_ls_percentage_0 {
             {
                 {std::uint16_t(0x0071), 10},
                 {std::uint16_t(0x0072), 10},
@@ -4097,7 +4098,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t store_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t store_percentage_0 {
             {
                 {std::uint16_t(0x0071), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4115,7 +4116,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_fp_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_fp_op_percentage_0 {
             {
                 {std::uint16_t(0x3220), 10},
                 {std::uint16_t(0x3219), 10},
@@ -4134,7 +4135,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_int_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_int_op_percentage_0 {
             {
                 {std::uint16_t(0x321f), 10},
                 {std::uint16_t(0x3219), 10},
@@ -4153,7 +4154,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_ld_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_ld_op_percentage_0 {
             {
                 {std::uint16_t(0x321c), 10},
                 {std::uint16_t(0x3219), 10},
@@ -4172,7 +4173,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_ls_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_ls_op_percentage_0 {
             {
                 {std::uint16_t(0x321b), 10},
                 {std::uint16_t(0x3219), 10},
@@ -4191,7 +4192,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_op_percentage_0 {
             {
                 {std::uint16_t(0x3219), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4211,7 +4212,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_slow_inst_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_slow_inst_percentage_0 {
             {
                 {std::uint16_t(0x3219), 10},
                 {std::uint16_t(0x32a4), 100},
@@ -4230,7 +4231,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t streaming_st_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t streaming_st_op_percentage_0 {
             {
                 {std::uint16_t(0x321d), 10},
                 {std::uint16_t(0x3219), 10},
@@ -4249,7 +4250,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t strex_fail_mpki_0 {
+        [[maybe_unused]] constexpr metric_events_set_t strex_fail_mpki_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x006e), 10},
@@ -4268,7 +4269,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t strex_fail_percent_0 {
+        [[maybe_unused]] constexpr metric_events_set_t strex_fail_percent_0 {
             {
                 {std::uint16_t(0x006f), 10},
                 {std::uint16_t(0x006e), 10},
@@ -4286,7 +4287,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t strex_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t strex_percentage_0 {
             {
                 {std::uint16_t(0x006f), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4304,7 +4305,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sve_all_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_all_percentage_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x8006), 10},
@@ -4323,7 +4324,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sve_fp_ops_per_cycle_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_fp_ops_per_cycle_0 {
             {
                 {std::uint16_t(0x80c0), 10},
             },
@@ -4341,7 +4342,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t sve_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_percentage_0 {
             {
                 {std::uint16_t(0x8056), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4358,7 +4359,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sve_predicate_empty_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_predicate_empty_percentage_0 {
             {
                 {std::uint16_t(0x8075), 10},
                 {std::uint16_t(0x8074), 10},
@@ -4376,7 +4377,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sve_predicate_full_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_predicate_full_percentage_0 {
             {
                 {std::uint16_t(0x8076), 10},
                 {std::uint16_t(0x8074), 10},
@@ -4394,7 +4395,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sve_predicate_partial_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_predicate_partial_percentage_0 {
             {
                 {std::uint16_t(0x8077), 10},
                 {std::uint16_t(0x8074), 10},
@@ -4412,7 +4413,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t sve_predicate_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t sve_predicate_percentage_0 {
             {
                 {std::uint16_t(0x8074), 10},
                 {std::uint16_t(0x001b), 1},
@@ -4430,7 +4431,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t system_dram_mem_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t system_dram_mem_hit_ratio_0 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x3008), 1},
@@ -4451,7 +4452,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t system_l3_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t system_l3_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x8206), 10},
@@ -4472,7 +4473,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t system_llc_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t system_llc_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x0028), 100},
@@ -4493,7 +4494,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t system_peer_cluster_cache_hit_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t system_peer_cluster_cache_hit_ratio_0 {
             {
                 {std::uint16_t(0x0017), 100},
                 {std::uint16_t(0x8190), 100},
@@ -4515,7 +4516,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t vpu_port_utilization_0 {
+        [[maybe_unused]] constexpr metric_events_set_t vpu_port_utilization_0 {
             {
                 {std::uint16_t(0x3002), 10},
             },
@@ -4532,7 +4533,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t za_active_cycles_ratio_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_active_cycles_ratio_0 {
             {
                 {std::uint16_t(0x8380), 10},
             },
@@ -4549,7 +4550,7 @@ namespace metrics {
             },
             true,
         };
-        [[maybe_unused]] const metric_events_set_t za_fp_addsub_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_fp_addsub_percentage_0 {
             {
                 {std::uint16_t(0x8370), 10},
                 {std::uint16_t(0x8352), 10},
@@ -4568,7 +4569,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_fp_dot_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_fp_dot_percentage_0 {
             {
                 {std::uint16_t(0x8352), 10},
                 {std::uint16_t(0x8374), 10},
@@ -4587,7 +4588,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_fp_fma_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_fp_fma_percentage_0 {
             {
                 {std::uint16_t(0x8352), 10},
                 {std::uint16_t(0x8372), 10},
@@ -4607,7 +4608,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_fp_mopa_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_fp_mopa_percentage_0 {
             {
                 {std::uint16_t(0x8352), 10},
                 {std::uint16_t(0x8376), 10},
@@ -4627,7 +4628,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_fp_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_fp_op_percentage_0 {
             {
                 {std::uint16_t(0x8352), 10},
                 {std::uint16_t(0x835e), 10},
@@ -4647,7 +4648,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_fp_other_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_fp_other_percentage_0 {
             {
                 {std::uint16_t(0x32b0), 10},
                 {std::uint16_t(0x8352), 10},
@@ -4666,7 +4667,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_int_dot_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_int_dot_percentage_0 {
             {
                 {std::uint16_t(0x8378), 10},
                 {std::uint16_t(0x837c), 10},
@@ -4685,7 +4686,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_int_mopa_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_int_mopa_percentage_0 {
             {
                 {std::uint16_t(0x8378), 10},
                 {std::uint16_t(0x837e), 10},
@@ -4704,7 +4705,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_int_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_int_op_percentage_0 {
             {
                 {std::uint16_t(0x8378), 10},
                 {std::uint16_t(0x835e), 10},
@@ -4724,7 +4725,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_int_other_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_int_other_percentage_0 {
             {
                 {std::uint16_t(0x8378), 10},
                 {std::uint16_t(0x32af), 10},
@@ -4743,7 +4744,7 @@ namespace metrics {
             },
             false,
         };
-        [[maybe_unused]] const metric_events_set_t za_op_percentage_0 {
+        [[maybe_unused]] constexpr metric_events_set_t za_op_percentage_0 {
             {
                 {std::uint16_t(0x001b), 1},
                 {std::uint16_t(0x835e), 10},
@@ -4762,7 +4763,7 @@ namespace metrics {
             },
             false,
         };
-        const metric_cpu_events_t c1_nano_metrics {
+        constexpr metric_cpu_events_t c1_nano_metrics {
             {
                 ipc_0,
                 {},
@@ -5876,7 +5877,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t c1_premium_metrics {
+        constexpr metric_cpu_events_t c1_premium_metrics {
             {
                 ipc_0,
                 {},
@@ -7178,7 +7179,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t c1_pro_metrics {
+        constexpr metric_cpu_events_t c1_pro_metrics {
             {
                 ipc_0,
                 {},
@@ -8462,7 +8463,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t c1_ultra_metrics {
+        constexpr metric_cpu_events_t c1_ultra_metrics {
             {
                 ipc_0,
                 {},
@@ -9764,7 +9765,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a32_metrics {
+        constexpr metric_cpu_events_t cortex_a32_metrics {
             {
                 ipc_0,
                 {},
@@ -9820,7 +9821,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a34_metrics {
+        constexpr metric_cpu_events_t cortex_a34_metrics {
             {
                 ipc_0,
                 {},
@@ -9876,7 +9877,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a35_metrics {
+        constexpr metric_cpu_events_t cortex_a35_metrics {
             {
                 ipc_0,
                 {},
@@ -9963,7 +9964,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a53_metrics {
+        constexpr metric_cpu_events_t cortex_a53_metrics {
             {
                 ipc_0,
                 {},
@@ -10019,7 +10020,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a55_metrics {
+        constexpr metric_cpu_events_t cortex_a55_metrics {
             {
                 ipc_0,
                 {},
@@ -10270,7 +10271,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a57_metrics {
+        constexpr metric_cpu_events_t cortex_a57_metrics {
             {
                 ipc_0,
                 {},
@@ -10459,7 +10460,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a65ae_metrics {
+        constexpr metric_cpu_events_t cortex_a65ae_metrics {
             {
                 ipc_0,
                 {},
@@ -10722,7 +10723,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_e1_metrics {
+        constexpr metric_cpu_events_t neoverse_e1_metrics {
             {
                 ipc_0,
                 {},
@@ -10985,7 +10986,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a72_metrics {
+        constexpr metric_cpu_events_t cortex_a72_metrics {
             {
                 ipc_0,
                 {},
@@ -11174,7 +11175,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a73_metrics {
+        constexpr metric_cpu_events_t cortex_a73_metrics {
             {
                 ipc_0,
                 {},
@@ -11333,7 +11334,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a75_metrics {
+        constexpr metric_cpu_events_t cortex_a75_metrics {
             {
                 ipc_0,
                 {},
@@ -11608,7 +11609,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a76_metrics {
+        constexpr metric_cpu_events_t cortex_a76_metrics {
             {
                 ipc_0,
                 {},
@@ -11907,7 +11908,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a77_metrics {
+        constexpr metric_cpu_events_t cortex_a77_metrics {
             {
                 ipc_0,
                 {},
@@ -12206,7 +12207,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a78_metrics {
+        constexpr metric_cpu_events_t cortex_a78_metrics {
             {
                 ipc_0,
                 {},
@@ -12506,7 +12507,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a78ae_metrics {
+        constexpr metric_cpu_events_t cortex_a78ae_metrics {
             {
                 ipc_0,
                 {},
@@ -12806,7 +12807,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a78c_metrics {
+        constexpr metric_cpu_events_t cortex_a78c_metrics {
             {
                 ipc_0,
                 {},
@@ -13106,7 +13107,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a510_metrics {
+        constexpr metric_cpu_events_t cortex_a510_metrics {
             {
                 ipc_0,
                 {},
@@ -13394,7 +13395,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a520_metrics {
+        constexpr metric_cpu_events_t cortex_a520_metrics {
             {
                 ipc_0,
                 {},
@@ -13878,7 +13879,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a520ae_metrics {
+        constexpr metric_cpu_events_t cortex_a520ae_metrics {
             {
                 ipc_0,
                 {},
@@ -14362,7 +14363,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a710_metrics {
+        constexpr metric_cpu_events_t cortex_a710_metrics {
             {
                 ipc_0,
                 {},
@@ -14728,7 +14729,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_x2_metrics {
+        constexpr metric_cpu_events_t cortex_x2_metrics {
             {
                 ipc_0,
                 {},
@@ -15094,7 +15095,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_x3_metrics {
+        constexpr metric_cpu_events_t cortex_x3_metrics {
             {
                 ipc_0,
                 {},
@@ -15460,7 +15461,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a715_metrics {
+        constexpr metric_cpu_events_t cortex_a715_metrics {
             {
                 ipc_0,
                 {},
@@ -15826,7 +15827,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a720_metrics {
+        constexpr metric_cpu_events_t cortex_a720_metrics {
             {
                 ipc_0,
                 {},
@@ -16336,7 +16337,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a720ae_metrics {
+        constexpr metric_cpu_events_t cortex_a720ae_metrics {
             {
                 ipc_0,
                 {},
@@ -16846,7 +16847,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_a725_metrics {
+        constexpr metric_cpu_events_t cortex_a725_metrics {
             {
                 ipc_0,
                 {},
@@ -17410,7 +17411,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_x1_metrics {
+        constexpr metric_cpu_events_t cortex_x1_metrics {
             {
                 ipc_0,
                 {},
@@ -17710,7 +17711,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_x1c_metrics {
+        constexpr metric_cpu_events_t cortex_x1c_metrics {
             {
                 ipc_0,
                 {},
@@ -18010,7 +18011,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_x4_metrics {
+        constexpr metric_cpu_events_t cortex_x4_metrics {
             {
                 ipc_0,
                 {},
@@ -18585,7 +18586,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_x925_metrics {
+        constexpr metric_cpu_events_t cortex_x925_metrics {
             {
                 ipc_0,
                 {},
@@ -19160,7 +19161,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_r52__metrics {
+        constexpr metric_cpu_events_t cortex_r52__metrics {
             {
                 ipc_0,
                 {},
@@ -19242,7 +19243,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_r82_metrics {
+        constexpr metric_cpu_events_t cortex_r82_metrics {
             {
                 ipc_0,
                 {},
@@ -19433,7 +19434,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t cortex_r82ae_metrics {
+        constexpr metric_cpu_events_t cortex_r82ae_metrics {
             {
                 ipc_0,
                 {},
@@ -19624,7 +19625,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_n1_metrics {
+        constexpr metric_cpu_events_t neoverse_n1_metrics {
             {
                 ipc_0,
                 {},
@@ -19923,7 +19924,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_v1_metrics {
+        constexpr metric_cpu_events_t neoverse_v1_metrics {
             {
                 ipc_0,
                 {},
@@ -20284,7 +20285,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_n2_common_metrics {
+        constexpr metric_cpu_events_t neoverse_n2_common_metrics {
             {
                 ipc_0,
                 {},
@@ -20649,7 +20650,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_n2_tel_v0_metrics {
+        constexpr metric_cpu_events_t neoverse_n2_tel_v0_metrics {
             {
                 ipc_0,
                 {},
@@ -20950,7 +20951,7 @@ namespace metrics {
                 true,
             },
         };
-        const metric_cpu_events_t neoverse_n2_tel_v1_metrics {
+        constexpr metric_cpu_events_t neoverse_n2_tel_v1_metrics {
             {
                 ipc_0,
                 {},
@@ -21251,7 +21252,7 @@ namespace metrics {
                 true,
             },
         };
-        const metric_cpu_events_t neoverse_v2_metrics {
+        constexpr metric_cpu_events_t neoverse_v2_metrics {
             {
                 ipc_0,
                 {},
@@ -21630,7 +21631,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_n3_metrics {
+        constexpr metric_cpu_events_t neoverse_n3_metrics {
             {
                 ipc_0,
                 {},
@@ -22255,7 +22256,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_v3_metrics {
+        constexpr metric_cpu_events_t neoverse_v3_metrics {
             {
                 ipc_0,
                 {},
@@ -22843,7 +22844,7 @@ namespace metrics {
                 false,
             },
         };
-        const metric_cpu_events_t neoverse_v3ae_metrics {
+        constexpr metric_cpu_events_t neoverse_v3ae_metrics {
             {
                 ipc_0,
                 {},
@@ -23432,406 +23433,412 @@ namespace metrics {
             },
         };
     }
-    metric_cpu_events_map_t const cpu_metrics_table {
-        {
-            "ARMv9_C1_Nano",
+    namespace {
+        constexpr std::array<metric_cpu_events_map_value_t, 44> cpu_metrics_table_entries {{
             {
-                0x000e,
+                "ARMv8R_Cortex_R52X",
                 {
-                    {{}, {c1_nano_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_r52__metrics, 2}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_C1_Premium",
             {
-                0x000e,
+                "ARMv8R_Cortex_R82",
                 {
-                    {{}, {c1_premium_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_r82_metrics, 3}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_C1_Pro",
             {
-                0x000e,
+                "ARMv8R_Cortex_R82AE",
                 {
-                    {{}, {c1_pro_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_r82ae_metrics, 3}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_C1_Ultra",
             {
-                0x000e,
+                "ARMv8_Cortex_A32",
                 {
-                    {{}, {c1_ultra_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a32_metrics, 2}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A32",
             {
-                0x000e,
+                "ARMv8_Cortex_A34",
                 {
-                    {{}, {cortex_a32_metrics, 2}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a34_metrics, 2}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A34",
             {
-                0x000e,
+                "ARMv8_Cortex_A35",
                 {
-                    {{}, {cortex_a34_metrics, 2}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a35_metrics, 2}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A35",
             {
-                0x000e,
+                "ARMv8_Cortex_A510",
                 {
-                    {{}, {cortex_a35_metrics, 2}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a510_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A53",
             {
-                0x000e,
+                "ARMv8_Cortex_A53",
                 {
-                    {{}, {cortex_a53_metrics, 2}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a53_metrics, 2}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A55",
             {
-                0x000e,
+                "ARMv8_Cortex_A55",
                 {
-                    {{}, {cortex_a55_metrics, 3}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a55_metrics, 3}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A57",
             {
-                0x0079,
+                "ARMv8_Cortex_A57",
                 {
-                    {{}, {cortex_a57_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a57_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A65AE",
             {
-                0x000e,
+                "ARMv8_Cortex_A65AE",
                 {
-                    {{}, {cortex_a65ae_metrics, 3}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a65ae_metrics, 3}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Neoverse_E1",
             {
-                0x000e,
+                "ARMv8_Cortex_A710",
                 {
-                    {{}, {neoverse_e1_metrics, 3}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a710_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A72",
             {
-                0x0079,
+                "ARMv8_Cortex_A72",
                 {
-                    {{}, {cortex_a72_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a72_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A73",
             {
-                0x000e,
+                "ARMv8_Cortex_A73",
                 {
-                    {{}, {cortex_a73_metrics, 4}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a73_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A75",
             {
-                0x000e,
+                "ARMv8_Cortex_A75",
                 {
-                    {{}, {cortex_a75_metrics, 4}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a75_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A76",
             {
-                0x0079,
+                "ARMv8_Cortex_A76",
                 {
-                    {{}, {cortex_a76_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a76_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A77",
             {
-                0x0079,
+                "ARMv8_Cortex_A77",
                 {
-                    {{}, {cortex_a77_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a77_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A78",
             {
-                0x0079,
+                "ARMv8_Cortex_A78",
                 {
-                    {{}, {cortex_a78_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a78_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A78AE",
             {
-                0x0079,
+                "ARMv8_Cortex_A78AE",
                 {
-                    {{}, {cortex_a78ae_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a78ae_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A78C",
             {
-                0x0079,
+                "ARMv8_Cortex_A78C",
                 {
-                    {{}, {cortex_a78c_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a78c_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A510",
             {
-                0x000e,
+                "ARMv8_Cortex_X1",
                 {
-                    {{}, {cortex_a510_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_x1_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_A520",
             {
-                0x000e,
+                "ARMv8_Cortex_X1C",
                 {
-                    {{}, {cortex_a520_metrics, 5}},
+                    0x0079,
+                    {
+                        {{}, {cortex_x1c_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_A520AE",
             {
-                0x000e,
+                "ARMv8_Cortex_X2",
                 {
-                    {{}, {cortex_a520ae_metrics, 5}},
+                    0x0079,
+                    {
+                        {{}, {cortex_x2_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_A710",
             {
-                0x0079,
+                "ARMv8_Neoverse_E1",
                 {
-                    {{}, {cortex_a710_metrics, 4}},
+                    0x000e,
+                    {
+                        {{}, {neoverse_e1_metrics, 3}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_X2",
             {
-                0x0079,
+                "ARMv8_Neoverse_N1",
                 {
-                    {{}, {cortex_x2_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {neoverse_n1_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_X3",
             {
-                0x0079,
+                "ARMv8_Neoverse_N2",
                 {
-                    {{}, {cortex_x3_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {neoverse_n2_common_metrics, 4}},
+                        {{0, 0}, {neoverse_n2_tel_v0_metrics, 5}},
+                        {{0, 3}, {neoverse_n2_tel_v1_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_A715",
             {
-                0x0079,
+                "ARMv8_Neoverse_V1",
                 {
-                    {{}, {cortex_a715_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {neoverse_v1_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_A720",
             {
-                0x000e,
+                "ARMv9_C1_Nano",
                 {
-                    {{}, {cortex_a720_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {c1_nano_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_A720AE",
             {
-                0x000e,
+                "ARMv9_C1_Premium",
                 {
-                    {{}, {cortex_a720ae_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {c1_premium_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_A725",
             {
-                0x000e,
+                "ARMv9_C1_Pro",
                 {
-                    {{}, {cortex_a725_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {c1_pro_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_X1",
             {
-                0x0079,
+                "ARMv9_C1_Ultra",
                 {
-                    {{}, {cortex_x1_metrics, 4}},
+                    0x000e,
+                    {
+                        {{}, {c1_ultra_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Cortex_X1C",
             {
-                0x0079,
+                "ARMv9_Cortex_A520",
                 {
-                    {{}, {cortex_x1c_metrics, 4}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a520_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_X4",
             {
-                0x000e,
+                "ARMv9_Cortex_A520AE",
                 {
-                    {{}, {cortex_x4_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a520ae_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Cortex_X925",
             {
-                0x000e,
+                "ARMv9_Cortex_A715",
                 {
-                    {{}, {cortex_x925_metrics, 5}},
+                    0x0079,
+                    {
+                        {{}, {cortex_a715_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8R_Cortex_R52X",
             {
-                0x000e,
+                "ARMv9_Cortex_A720",
                 {
-                    {{}, {cortex_r52__metrics, 2}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a720_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8R_Cortex_R82",
             {
-                0x000e,
+                "ARMv9_Cortex_A720AE",
                 {
-                    {{}, {cortex_r82_metrics, 3}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a720ae_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8R_Cortex_R82AE",
             {
-                0x000e,
+                "ARMv9_Cortex_A725",
                 {
-                    {{}, {cortex_r82ae_metrics, 3}},
+                    0x000e,
+                    {
+                        {{}, {cortex_a725_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Neoverse_N1",
             {
-                0x0079,
+                "ARMv9_Cortex_X3",
                 {
-                    {{}, {neoverse_n1_metrics, 4}},
+                    0x0079,
+                    {
+                        {{}, {cortex_x3_metrics, 4}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Neoverse_V1",
             {
-                0x0079,
+                "ARMv9_Cortex_X4",
                 {
-                    {{}, {neoverse_v1_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_x4_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv8_Neoverse_N2",
             {
-                0x0079,
+                "ARMv9_Cortex_X925",
                 {
-                    {{}, {neoverse_n2_common_metrics, 4}},
-                    {{0, 0}, {neoverse_n2_tel_v0_metrics, 5}},
-                    {{0, 3}, {neoverse_n2_tel_v1_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {cortex_x925_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Neoverse_V2",
             {
-                0x0079,
+                "ARMv9_Neoverse_N3",
                 {
-                    {{}, {neoverse_v2_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {neoverse_n3_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Neoverse_N3",
             {
-                0x000e,
+                "ARMv9_Neoverse_V2",
                 {
-                    {{}, {neoverse_n3_metrics, 5}},
+                    0x0079,
+                    {
+                        {{}, {neoverse_v2_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Neoverse_V3",
             {
-                0x000e,
+                "ARMv9_Neoverse_V3",
                 {
-                    {{}, {neoverse_v3_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {neoverse_v3_metrics, 5}},
+                    },
                 },
             },
-        },
-        {
-            "ARMv9_Neoverse_V3AE",
             {
-                0x000e,
+                "ARMv9_Neoverse_V3AE",
                 {
-                    {{}, {neoverse_v3ae_metrics, 5}},
+                    0x000e,
+                    {
+                        {{}, {neoverse_v3ae_metrics, 5}},
+                    },
                 },
             },
-        },
-    };
+        }};
+
+        static_assert(is_sorted_metrics_table(cpu_metrics_table_entries), "cpu_metrics_table must be sorted");
+    }
+
+    metric_cpu_events_map_t const cpu_metrics_table {cpu_metrics_table_entries};
 
     std::string_view metric_group_title(metric_group_id_t id)
     {
@@ -3,12 +3,12 @@
 #pragma once
 
 #include "lib/Assert.h"
+#include "lib/Span.h"
 
 #include <cassert>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
-#include <map>
 #include <string_view>
 
 namespace metrics {
@@ -241,7 +241,7 @@ namespace metrics {
 
     /** Represents a single entry in the hierarchy */
     struct metric_hierarchy_entry_t {
-        std::reference_wrapper<metric_events_set_t const> metric;
+        metric_events_set_t const & metric;
         std::initializer_list<metric_hierarchy_entry_t> children;
         metric_group_id_t group;
         bool top_down;
@@ -252,7 +252,7 @@ namespace metrics {
 
     /** Properties pertaining to on version of a cpu */
     struct metric_cpu_version_map_entry_t {
-        std::reference_wrapper<metric_cpu_events_t const> root_events;
+        metric_cpu_events_t const & root_events;
         std::size_t largest_metric_event_count;
     };
 
@@ -297,7 +297,7 @@ namespace metrics {
             if (a.major_version < b.major_version) {
                 return true;
             }
-            if (b.major_version > a.major_version) {
+            if (a.major_version > b.major_version) {
                 return false;
             }
 
@@ -306,20 +306,58 @@ namespace metrics {
         }
     };
 
+    /** Associates some cpu version with its metrics */
+    struct metric_cpu_version_metrics_t {
+        metric_cpu_version_t version;
+        metric_cpu_version_map_entry_t metrics;
+    };
+
     /** The CPU to metric list entry */
     struct metric_cpu_event_map_entry_t {
         std::uint16_t return_event_code;
-        std::map<metric_cpu_version_t, metric_cpu_version_map_entry_t> per_version_metrics;
+        /** Sorted by version, with the common metrics (if any) first */
+        std::initializer_list<metric_cpu_version_metrics_t> per_version_metrics;
+    };
+
+    /** An entry in the CPU to metric list table */
+    struct metric_cpu_events_map_value_t {
+        std::string_view cset_id;
+        metric_cpu_event_map_entry_t metrics;
     };
 
-    /** The CPU to metric list lookup type */
-    using metric_cpu_events_map_t = std::map<std::string_view, metric_cpu_event_map_entry_t>;
+    /** The CPU to metric list lookup type; sorted by counter set name so that it may be binary searched */
+    using metric_cpu_events_map_t = lib::Span<metric_cpu_events_map_value_t const>;
 
     /**
-     * The map from CPU to metric list
+     * The map from CPU to metric list.
+     *
+     * This is constant data (there is no static initializer), so it is safe to use from any other static initializer.
      */
     extern metric_cpu_events_map_t const cpu_metrics_table;
 
+    /**
+     * Check the ordering that lookups in cpu_metrics_table rely on, for use in a static_assert
+     *
+     * @return True if the table is strictly sorted by name, and each entry's versions are strictly sorted
+     */
+    [[nodiscard]] constexpr bool is_sorted_metrics_table(metric_cpu_events_map_t table)
+    {
+        for (std::size_t n = 0; n < table.size(); ++n) {
+            if ((n > 0) && !(table[n - 1].cset_id < table[n].cset_id)) {
+                return false;
+            }
+
+            auto const & versions = table[n].metrics.per_version_metrics;
+            for (auto const * it = versions.begin(); (it != versions.end()) && ((it + 1) != versions.end()); ++it) {
+                if (!(it[0].version < it[1].version)) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
     /**
      * Map group title from enum
      */
@@ -2,40 +2,98 @@
 
 #include "metrics/group_generator.hpp"
 
+#include "Logging.h"
 #include "lib/Assert.h"
 #include "lib/Span.h"
 #include "metrics/definitions.hpp"
 
 #include <algorithm>
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
+#include <optional>
 #include <set>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace metrics {
     namespace {
+        constexpr std::uint16_t arm32_linux_cycle_counter = 0xff;
+        constexpr std::uint16_t arm64_linux_cycle_counter = 0x11;
+
+        /** Enough bits for every distinct event code used by the metrics of any one CPU */
+        constexpr std::size_t max_distinct_event_codes = 512;
+
+        /**
+         * The maximum number of nodes group_packer_t may visit for each set of EBS compatible metrics. Most of the
+         * improvement over the heuristic combination is found within the first few thousand, and this bounds the
+         * worst case to a few tens of milliseconds for the largest CPUs when there are few counters.
+         */
+        constexpr std::size_t max_packer_search_steps = 5000;
+
+        /** A set of event codes, as bits allocated by event_code_index_t */
+        using event_bits_t = std::bitset<max_distinct_event_codes>;
+
+        /** Allocates a bit to each distinct event code seen by one call to make_combinations */
+        class event_code_index_t {
+        public:
+            [[nodiscard]] std::size_t bit_for(std::uint16_t code)
+            {
+                auto const [it, inserted] = bits.try_emplace(code, codes.size());
+                if (inserted) {
+                    runtime_assert(codes.size() < max_distinct_event_codes, "Too many distinct metric event codes");
+                    codes.push_back(code);
+                }
+                return it->second;
+            }
+
+            [[nodiscard]] std::optional<std::size_t> find_bit(std::uint16_t code) const
+            {
+                if (auto const it = bits.find(code); it != bits.end()) {
+                    return it->second;
+                }
+                return {};
+            }
+
+            [[nodiscard]] std::unordered_set<std::uint16_t> to_codes(event_bits_t const & event_bits) const
+            {
+                std::unordered_set<std::uint16_t> result {};
+                for (std::size_t n = 0; n < codes.size(); ++n) {
+                    if (event_bits.test(n)) {
+                        result.insert(codes[n]);
+                    }
+                }
+                return result;
+            }
+
+        private:
+            std::unordered_map<std::uint16_t, std::size_t> bits {};
+            std::vector<std::uint16_t> codes {};
+        };
 
         struct raw_combination_t {
             std::unordered_set<metric_events_set_t const *> contains_sets;
-            std::unordered_set<std::uint16_t> event_codes;
+            event_bits_t event_codes;
             metric_priority_t priority;
             std::uint16_t ebs_ratio;
             metric_arch_t arch;
             bool uses_cycles;
 
             raw_combination_t(std::unordered_set<metric_events_set_t const *> contains_sets,
-                              std::unordered_set<std::uint16_t> event_codes,
+                              event_bits_t event_codes,
                               metric_priority_t priority,
                               std::uint16_t ebs_ratio,
                               metric_arch_t arch,
                               bool uses_cycles)
                 : contains_sets(std::move(contains_sets)),
-                  event_codes(std::move(event_codes)),
+                  event_codes(event_codes),
                   priority(priority),
                   ebs_ratio(ebs_ratio),
                   arch(arch),
@@ -46,9 +104,6 @@ namespace metrics {
 
         [[nodiscard]] bool is_cycle_counter(std::uint16_t code, metric_arch_t arch)
         {
-            constexpr std::uint16_t arm32_linux_cycle_counter = 0xff;
-            constexpr std::uint16_t arm64_linux_cycle_counter = 0x11;
-
             switch (arch) {
                 case metric_arch_t::v7:
                     return (code == arm32_linux_cycle_counter);
@@ -60,6 +115,31 @@ namespace metrics {
             }
         }
 
+        /** @return The bit for the cycle counter of @a arch, if the cycle counter was seen and the arch is known */
+        [[nodiscard]] event_bits_t cycle_counter_bits(event_code_index_t const & index, metric_arch_t arch)
+        {
+            event_bits_t result {};
+
+            std::optional<std::size_t> bit {};
+            switch (arch) {
+                case metric_arch_t::v7:
+                    bit = index.find_bit(arm32_linux_cycle_counter);
+                    break;
+                case metric_arch_t::v8:
+                    bit = index.find_bit(arm64_linux_cycle_counter);
+                    break;
+                case metric_arch_t::any:
+                default:
+                    break;
+            }
+
+            if (bit) {
+                result.set(*bit);
+            }
+
+            return result;
+        }
+
         [[nodiscard]] constexpr metric_priority_t select_best(metric_priority_t a, metric_priority_t b)
         {
             return std::min(a, b);
@@ -80,50 +160,27 @@ namespace metrics {
             return a;
         }
 
-        [[nodiscard]] constexpr std::uint16_t to_event_code(std::uint16_t event)
-        {
-            return event;
-        }
-
-        [[nodiscard]] constexpr std::uint16_t to_event_code(metric_event_code_and_ratio_t const & event)
+        /** The union of two event sets, excluding the cycle counter (which does not consume a programmable counter) */
+        [[nodiscard]] event_bits_t combine_codes(event_code_index_t const & index,
+                                                 event_bits_t const & event_codes_a,
+                                                 metric_arch_t arch_a,
+                                                 event_bits_t const & event_codes_b,
+                                                 metric_arch_t arch_b)
         {
-            return event.code;
-        }
-
-        template<typename EventCodesA, typename EventCodesB>
-        [[nodiscard]] std::unordered_set<std::uint16_t> combine_codes(EventCodesA const & event_codes_a,
-                                                                      metric_arch_t arch_a,
-                                                                      EventCodesB const & event_codes_b,
-                                                                      metric_arch_t arch_b)
-        {
-            std::unordered_set<std::uint16_t> result {};
-
-            for (auto const & event : event_codes_a) {
-                auto const code = to_event_code(event);
-                if (!is_cycle_counter(code, arch_a)) {
-                    result.insert(code);
-                }
-            }
-
-            for (auto const & event : event_codes_b) {
-                auto const code = to_event_code(event);
-                if (!is_cycle_counter(code, arch_b)) {
-                    result.insert(code);
-                }
-            }
-
-            return result;
+            return (event_codes_a & ~cycle_counter_bits(index, arch_a))
+                 | (event_codes_b & ~cycle_counter_bits(index, arch_b));
         }
 
         template<typename EventCodes>
-        [[nodiscard]] std::unordered_set<std::uint16_t> filter_cycles(EventCodes const & event_codes,
-                                                                      metric_arch_t arch)
+        [[nodiscard]] event_bits_t filter_cycles(event_code_index_t & index,
+                                                 EventCodes const & event_codes,
+                                                 metric_arch_t arch)
         {
-            std::unordered_set<std::uint16_t> result {};
+            event_bits_t result {};
 
             for (auto const & event : event_codes) {
                 if (!is_cycle_counter(event.code, arch)) {
-                    result.insert(event.code);
+                    result.set(index.bit_for(event.code));
                 }
             }
 
@@ -176,6 +233,7 @@ namespace metrics {
             std::size_t max_events,
             lib::Span<std::reference_wrapper<metrics::metric_events_set_t const> const> const & metric_events,
             std::function<bool(metric_events_set_t const &)> const & filter_predicate,
+            event_code_index_t & index,
             bool & has_boundness,
             bool & has_stalled_cycles,
             std::vector<raw_combination_t> & result,
@@ -195,14 +253,14 @@ namespace metrics {
 
                 raw_combination_t current_combination {
                     {&metric_a},
-                    filter_cycles(metric_a.event_codes, metric_a.arch),
+                    filter_cycles(index, metric_a.event_codes, metric_a.arch),
                     metric_a.priority_group,
                     (ebs_mode ? max_ebs_ratio(metric_a.uses_cycles, metric_a.event_codes) : std::uint16_t(0)),
                     metric_a.arch,
                     metric_a.uses_cycles,
                 };
 
-                if (current_combination.event_codes.size() > max_events) {
+                if (current_combination.event_codes.count() > max_events) {
                     continue;
                 }
 
@@ -237,11 +295,12 @@ namespace metrics {
                     }
 
                     // combine the event codes
-                    auto combined_codes = combine_codes(current_combination.event_codes,
+                    auto combined_codes = combine_codes(index,
+                                                        current_combination.event_codes,
                                                         current_combination.arch,
-                                                        metric_b.event_codes,
+                                                        filter_cycles(index, metric_b.event_codes, metric_b.arch),
                                                         metric_b.arch);
-                    if (combined_codes.size() > max_events) {
+                    if (combined_codes.count() > max_events) {
                         continue;
                     }
 
@@ -252,7 +311,7 @@ namespace metrics {
                     consumed_metrics.insert(&metric_b);
                     current_combination.contains_sets.insert(&metric_b);
                     current_combination.arch = combined_arch;
-                    current_combination.event_codes = std::move(combined_codes);
+                    current_combination.event_codes = combined_codes;
                 }
 
                 result.emplace_back(std::move(current_combination));
@@ -264,6 +323,7 @@ namespace metrics {
             std::size_t max_events,
             lib::Span<std::reference_wrapper<metrics::metric_events_set_t const> const> events,
             std::function<bool(metric_events_set_t const &)> const & filter_predicate,
+            event_code_index_t & index,
             bool & has_boundness,
             bool & has_stalled_cycles)
         {
@@ -278,6 +338,7 @@ namespace metrics {
                                             max_events,
                                             events,
                                             filter_predicate,
+                                            index,
                                             has_boundness,
                                             has_stalled_cycles,
                                             result,
@@ -301,6 +362,7 @@ namespace metrics {
         [[nodiscard]] std::vector<raw_combination_t> combine_combinations(
             bool ebs_mode,
             std::size_t max_events,
+            event_code_index_t const & index,
             std::vector<raw_combination_t> initial_combinations,
             Predicate && predicate)
         {
@@ -319,7 +381,7 @@ namespace metrics {
                         continue;
                     }
 
-                    if (combination_a.event_codes.size() > max_events) {
+                    if (combination_a.event_codes.count() > max_events) {
                         continue;
                     }
 
@@ -349,11 +411,12 @@ namespace metrics {
                         }
 
                         // combine the event codes
-                        auto combined_codes = combine_codes(current_combination.event_codes,
+                        auto combined_codes = combine_codes(index,
+                                                            current_combination.event_codes,
                                                             current_combination.arch,
                                                             combination_b.event_codes,
                                                             combination_b.arch);
-                        if (combined_codes.size() > max_events) {
+                        if (combined_codes.count() > max_events) {
                             continue;
                         }
 
@@ -361,12 +424,12 @@ namespace metrics {
                         auto const combined_arch = combine_arch(current_combination.arch, combination_b.arch);
 
                         // update current
-                        modified |= combined_codes.size() != current_combination.event_codes.size();
+                        modified |= combined_codes.count() != current_combination.event_codes.count();
                         consumed_metrics.insert(combination_b.contains_sets.begin(), combination_b.contains_sets.end());
                         current_combination.contains_sets.insert(combination_b.contains_sets.begin(),
                                                                  combination_b.contains_sets.end());
                         current_combination.arch = combined_arch;
-                        current_combination.event_codes = std::move(combined_codes);
+                        current_combination.event_codes = combined_codes;
                         current_combination.priority =
                             select_best(current_combination.priority, combination_b.priority);
                     }
@@ -397,14 +460,309 @@ namespace metrics {
             };
         }
 
-        [[nodiscard]] std::vector<combination_t> convert_to_final(std::vector<raw_combination_t> combinations)
+        /** A metric to be placed by group_packer_t */
+        struct packer_item_t {
+            metric_events_set_t const * set;
+            /** The index of the metric in the input events; breaks ties so the packing is the same on every run */
+            std::size_t ordinal;
+            event_bits_t event_codes;
+            metric_priority_t priority;
+            metric_arch_t arch;
+            bool uses_cycles;
+        };
+
+        /**
+         * Finds the smallest number of groups that the (mutually EBS compatible) metrics can be packed into with at
+         * most max_events events per group, using a bounded branch and bound search.
+         *
+         * Metrics are placed largest first, trying each existing group before opening a new one, so the first
+         * solution found is the first-fit-decreasing packing. The search then only explores branches that could use
+         * fewer groups than the best solution so far, and stops early if it reaches a lower bound (from the total
+         * number of distinct events, or from a set of metrics no two of which fit in one group).
+         */
+        class group_packer_t {
+        public:
+            group_packer_t(event_code_index_t const & index, std::size_t max_events, std::vector<packer_item_t> items)
+                : max_events(max_events),
+                  items(std::move(items)),
+                  not_v7_cycles(~cycle_counter_bits(index, metric_arch_t::v7)),
+                  not_v8_cycles(~cycle_counter_bits(index, metric_arch_t::v8))
+            {
+                // placing the largest first finds good solutions sooner, and prunes more of the search.
+                // ties go to the later metric in the input, which packs the current tables slightly better
+                std::sort(this->items.begin(),
+                                 this->items.end(),
+                                 [](packer_item_t const & a, packer_item_t const & b) {
+                                     return std::make_tuple(a.event_codes.count(), b.priority, a.ordinal)
+                                          > std::make_tuple(b.event_codes.count(), a.priority, b.ordinal);
+                                 });
+            }
+
+            /**
+             * @param upper_bound The number of groups to improve upon
+             * @return The groups, if a solution using fewer than @a upper_bound groups was found
+             */
+            [[nodiscard]] std::optional<std::vector<raw_combination_t>> pack(std::size_t upper_bound)
+            {
+                event_bits_t all_codes {};
+                for (auto const & item : items) {
+                    all_codes |= item.event_codes;
+                }
+
+                lower_bound = std::max<std::size_t>({std::size_t(1),
+                                                     (all_codes.count() + max_events - 1) / max_events,
+                                                     count_mutually_exclusive()});
+                best_count = upper_bound;
+                steps_remaining = max_packer_search_steps;
+                assignment.assign(items.size(), 0);
+
+                if (lower_bound >= upper_bound) {
+                    return {};
+                }
+
+                search(0);
+
+                if (best_assignment.empty()) {
+                    return {};
+                }
+
+                return make_groups();
+            }
+
+        private:
+            struct bin_t {
+                event_bits_t event_codes;
+                metric_arch_t arch;
+            };
+
+            std::size_t max_events;
+            std::vector<packer_item_t> items;
+            event_bits_t not_v7_cycles;
+            event_bits_t not_v8_cycles;
+            std::vector<bin_t> bins {};
+            std::vector<std::size_t> assignment {};
+            std::vector<std::size_t> best_assignment {};
+            std::size_t best_count = 0;
+            std::size_t lower_bound = 0;
+            std::size_t steps_remaining = 0;
+
+            [[nodiscard]] bool finished() const { return (best_count <= lower_bound) || (steps_remaining == 0); }
+
+            [[nodiscard]] event_bits_t without_cycle_counter(event_bits_t const & event_codes, metric_arch_t arch) const
+            {
+                switch (arch) {
+                    case metric_arch_t::v7:
+                        return event_codes & not_v7_cycles;
+                    case metric_arch_t::v8:
+                        return event_codes & not_v8_cycles;
+                    case metric_arch_t::any:
+                    default:
+                        return event_codes;
+                }
+            }
+
+            /** @return The size of some set of items where no two items fit in the same group */
+            [[nodiscard]] std::size_t count_mutually_exclusive() const
+            {
+                std::vector<bin_t> exclusive {};
+
+                for (auto const & item : items) {
+                    auto const fits_any = std::any_of(exclusive.begin(), exclusive.end(), [&](bin_t const & bin) {
+                        return try_add(bin, item).has_value();
+                    });
+                    if (!fits_any) {
+                        exclusive.push_back(bin_t {item.event_codes, item.arch});
+                    }
+                }
+
+                return exclusive.size();
+            }
+
+            [[nodiscard]] std::optional<bin_t> try_add(bin_t const & bin, packer_item_t const & item) const
+            {
+                if ((bin.arch != metric_arch_t::any) && (item.arch != metric_arch_t::any) && (bin.arch != item.arch)) {
+                    return {};
+                }
+
+                auto const arch = (bin.arch != metric_arch_t::any ? bin.arch : item.arch);
+                auto const event_codes = without_cycle_counter(bin.event_codes | item.event_codes, arch);
+
+                if (event_codes.count() > max_events) {
+                    return {};
+                }
+
+                return bin_t {event_codes, arch};
+            }
+
+            void search(std::size_t item_no)
+            {
+                if ((bins.size() >= best_count) || finished()) {
+                    return;
+                }
+
+                --steps_remaining;
+
+                if (item_no == items.size()) {
+                    best_count = bins.size();
+                    best_assignment = assignment;
+                    return;
+                }
+
+                auto const & item = items[item_no];
+
+                // an item that adds no new events to some group may as well go there; no other choice is better
+                for (std::size_t bin_no = 0; bin_no < bins.size(); ++bin_no) {
+                    auto const & bin = bins[bin_no];
+                    if (((item.arch == metric_arch_t::any) || (item.arch == bin.arch))
+                        && (item.event_codes & ~bin.event_codes).none()) {
+                        assignment[item_no] = bin_no;
+                        search(item_no + 1);
+                        return;
+                    }
+                }
+
+                for (std::size_t bin_no = 0; (bin_no < bins.size()) && !finished(); ++bin_no) {
+                    auto const combined = try_add(bins[bin_no], item);
+                    if (!combined) {
+                        continue;
+                    }
+
+                    auto const previous = bins[bin_no];
+                    bins[bin_no] = *combined;
+                    assignment[item_no] = bin_no;
+                    search(item_no + 1);
+                    bins[bin_no] = previous;
+                }
+
+                // only open a new group if that could still beat the best solution so far
+                if ((bins.size() + 1 < best_count) && !finished()) {
+                    bins.push_back(bin_t {item.event_codes, item.arch});
+                    assignment[item_no] = bins.size() - 1;
+                    search(item_no + 1);
+                    bins.pop_back();
+                }
+            }
+
+            [[nodiscard]] std::vector<raw_combination_t> make_groups() const
+            {
+                std::vector<std::optional<raw_combination_t>> groups(best_count);
+
+                for (std::size_t item_no = 0; item_no < items.size(); ++item_no) {
+                    auto const & item = items[item_no];
+                    auto & group = groups[best_assignment[item_no]];
+
+                    if (!group) {
+                        group.emplace(std::unordered_set<metric_events_set_t const *> {item.set},
+                                      item.event_codes,
+                                      item.priority,
+                                      std::uint16_t(0),
+                                      item.arch,
+                                      item.uses_cycles);
+                        continue;
+                    }
+
+                    auto const arch = (group->arch != metric_arch_t::any ? group->arch : item.arch);
+
+                    group->contains_sets.insert(item.set);
+                    group->event_codes = without_cycle_counter(group->event_codes | item.event_codes, arch);
+                    group->priority = select_best(group->priority, item.priority);
+                    group->arch = arch;
+                }
+
+                std::vector<raw_combination_t> result {};
+                result.reserve(groups.size());
+                for (auto & group : groups) {
+                    result.emplace_back(std::move(*group));
+                }
+                return result;
+            }
+        };
+
+        /**
+         * Metrics can only share a group if they sample at the same rate in EBS mode; see is_valid_ebs_combo. That
+         * relation partitions the metrics, and each partition is packed independently.
+         */
+        using ebs_class_t = std::pair<std::uint16_t, bool>;
+
+        [[nodiscard]] ebs_class_t ebs_class_of(std::uint16_t ebs_ratio, bool uses_cycles)
+        {
+            return {ebs_ratio, (ebs_ratio > EBS_RATE_CYCLES) && uses_cycles};
+        }
+
+        /**
+         * Repack the metrics of the heuristically combined groups into fewer groups, where possible.
+         *
+         * The heuristic combination keeps related metrics together, so its groups are kept unless the packer finds a
+         * solution that needs fewer of them.
+         */
+        [[nodiscard]] std::vector<raw_combination_t> minimize_combinations(
+            bool ebs_mode,
+            std::size_t max_events,
+            lib::Span<std::reference_wrapper<metrics::metric_events_set_t const> const> events,
+            event_code_index_t & index,
+            std::vector<raw_combination_t> combinations)
+        {
+            std::map<ebs_class_t, std::vector<raw_combination_t>> by_class {};
+
+            // contains_sets iterates in an order that depends on the pointer values, which differ from run to run
+            std::unordered_map<metric_events_set_t const *, std::size_t> ordinals {};
+            for (std::size_t n = 0; n < events.size(); ++n) {
+                ordinals.emplace(&events[n].get(), n);
+            }
+
+            for (auto & combination : combinations) {
+                auto const key = (ebs_mode ? ebs_class_of(combination.ebs_ratio, combination.uses_cycles)
+                                           : ebs_class_t {0, false});
+                by_class[key].emplace_back(std::move(combination));
+            }
+
+            std::vector<raw_combination_t> result {};
+
+            for (auto & [key, heuristic_groups] : by_class) {
+                std::vector<packer_item_t> items {};
+
+                for (auto const & combination : heuristic_groups) {
+                    for (auto const * set : combination.contains_sets) {
+                        items.push_back(packer_item_t {
+                            set,
+                            ordinals.at(set),
+                            filter_cycles(index, set->event_codes, set->arch),
+                            set->priority_group,
+                            set->arch,
+                            set->uses_cycles,
+                        });
+                    }
+                }
+
+                group_packer_t packer {index, max_events, std::move(items)};
+
+                if (auto packed_groups = packer.pack(heuristic_groups.size())) {
+                    LOG_DEBUG("Packed %zu metric groups into %zu", heuristic_groups.size(), packed_groups->size());
+
+                    for (auto & group : *packed_groups) {
+                        group.ebs_ratio = key.first;
+                        result.emplace_back(std::move(group));
+                    }
+                }
+                else {
+                    for (auto & group : heuristic_groups) {
+                        result.emplace_back(std::move(group));
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] std::vector<combination_t> convert_to_final(event_code_index_t const & index,
+                                                                  std::vector<raw_combination_t> combinations)
         {
             std::vector<combination_t> result {};
             result.reserve(combinations.size());
 
             for (auto & combination : combinations) {
                 result.emplace_back(std::move(combination.contains_sets),
-                                    std::move(combination.event_codes),
+                                    index.to_codes(combination.event_codes),
                                     combination.ebs_ratio,
                                     combination.arch,
                                     combination.uses_cycles);
@@ -416,8 +774,15 @@ namespace metrics {
 
     metric_cpu_event_map_entry_t const * find_events_for_cset(std::string_view cset_id)
     {
-        if (auto const it = cpu_metrics_table.find(cset_id); it != cpu_metrics_table.end()) {
-            return &(it->second);
+        // the table is sorted by name
+        auto const it = std::lower_bound(cpu_metrics_table.begin(),
+                                         cpu_metrics_table.end(),
+                                         cset_id,
+                                         [](metric_cpu_events_map_value_t const & entry, std::string_view id) {
+                                             return entry.cset_id < id;
+                                         });
+        if ((it != cpu_metrics_table.end()) && (it->cset_id == cset_id)) {
+            return &(it->metrics);
         }
         return nullptr;
     }
@@ -430,12 +795,14 @@ namespace metrics {
     {
         bool has_boundness = false;
         bool has_stalled_cycles = false;
+        event_code_index_t index {};
 
         // make the initial set
         auto raw_combinations = make_initial_combinations(ebs_mode,
                                                           max_events,
                                                           events,
                                                           filter_predicate,
+                                                          index,
                                                           has_boundness,
                                                           has_stalled_cycles);
 
@@ -443,6 +810,7 @@ namespace metrics {
         raw_combinations =
             combine_combinations(ebs_mode,
                                  max_events,
+                                 index,
                                  std::move(raw_combinations),
                                  filter_for_priorities<metric_priority_t::top_level, metric_priority_t::boundness>());
 
@@ -451,6 +819,7 @@ namespace metrics {
             raw_combinations =
                 combine_combinations(ebs_mode,
                                      max_events,
+                                     index,
                                      std::move(raw_combinations),
                                      filter_for_priorities<metric_priority_t::top_level, metric_priority_t::branch>());
         }
@@ -459,6 +828,7 @@ namespace metrics {
         raw_combinations = combine_combinations(
             ebs_mode,
             max_events,
+            index,
             std::move(raw_combinations),
             filter_for_priorities<metric_priority_t::top_level, metric_priority_t::stall_cycles>());
 
@@ -467,6 +837,7 @@ namespace metrics {
             raw_combinations =
                 combine_combinations(ebs_mode,
                                      max_events,
+                                     index,
                                      std::move(raw_combinations),
                                      filter_for_priorities<metric_priority_t::top_level, metric_priority_t::branch>());
         }
@@ -474,6 +845,7 @@ namespace metrics {
         // merge boundness, stall_cylces, frontend, backend
         raw_combinations = combine_combinations(ebs_mode,
                                                 max_events,
+                                                index,
                                                 std::move(raw_combinations),
                                                 filter_for_priorities<metric_priority_t::boundness,
                                                                       metric_priority_t::stall_cycles,
@@ -484,6 +856,7 @@ namespace metrics {
         raw_combinations =
             combine_combinations(ebs_mode,
                                  max_events,
+                                 index,
                                  std::move(raw_combinations),
                                  filter_for_priorities<metric_priority_t::top_level, metric_priority_t::data>());
 
@@ -491,6 +864,7 @@ namespace metrics {
         raw_combinations =
             combine_combinations(ebs_mode,
                                  max_events,
+                                 index,
                                  std::move(raw_combinations),
                                  filter_for_priorities<metric_priority_t::data, metric_priority_t::ls>());
 
@@ -498,12 +872,14 @@ namespace metrics {
         raw_combinations = combine_combinations(
             ebs_mode,
             max_events,
+            index,
             std::move(raw_combinations),
             filter_for_priorities<metric_priority_t::data, metric_priority_t::ls, metric_priority_t::l2>());
 
         // merge data, ls, l2, l3
         raw_combinations = combine_combinations(ebs_mode,
                                                 max_events,
+                                                index,
                                                 std::move(raw_combinations),
                                                 filter_for_priorities<metric_priority_t::data,
                                                                       metric_priority_t::ls,
@@ -513,6 +889,7 @@ namespace metrics {
         // merge data, ls, l2, l3, ll
         raw_combinations = combine_combinations(ebs_mode,
                                                 max_events,
+                                                index,
                                                 std::move(raw_combinations),
                                                 filter_for_priorities<metric_priority_t::data,
                                                                       metric_priority_t::ls,
@@ -524,9 +901,13 @@ namespace metrics {
         raw_combinations =
             combine_combinations(ebs_mode,
                                  max_events,
+                                 index,
                                  std::move(raw_combinations),
                                  [](raw_combination_t const & /*a*/, raw_combination_t const & /*b*/) { return true; });
 
-        return convert_to_final(std::move(raw_combinations));
+        // and finally see if the same metrics fit into fewer groups, as fewer groups means less multiplexing
+        raw_combinations = minimize_combinations(ebs_mode, max_events, events, index, std::move(raw_combinations));
+
+        return convert_to_final(index, std::move(raw_combinations));
     }
 }
@@ -1,52 +1,66 @@
-/* Copyright (C) 2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2024-2025 by Arm Limited. All rights reserved. */
 
 #include "metrics/metric_group_set.hpp"
 
 #include "metrics/definitions.hpp"
 
-#include <algorithm>
-#include <iterator>
-#include <set>
+#include <cstddef>
+#include <initializer_list>
 
 namespace metrics {
-    [[nodiscard]] bool metric_group_set_t::has_member(metric_group_id_t const item) const
+    metric_group_set_t::metric_group_set_t(std::initializer_list<metric_group_id_t> members)
     {
-        if (all) {
-            return true;
+        for (auto const item : members) {
+            this->members.set(std::size_t(item));
         }
-        if (auto const & iter = members.find(item); iter == members.end()) {
-            return false;
+    }
+
+    metric_group_set_t::metric_group_set_t(bool represents_all)
+    {
+        if (represents_all) {
+            members.set();
         }
-        return true;
+    }
+
+    [[nodiscard]] bool metric_group_set_t::has_member(metric_group_id_t const item) const
+    {
+        auto const index = std::size_t(item);
+        return (index < members.size()) && members.test(index);
+    }
+
+    [[nodiscard]] bool metric_group_set_t::intersects(metric_group_set_t const & rhs) const
+    {
+        return (members & rhs.members).any();
     }
 
     [[nodiscard]] bool metric_group_set_t::empty() const
     {
-        return !all && members.empty();
+        return members.none();
+    }
+
+    [[nodiscard]] std::size_t metric_group_set_t::size() const
+    {
+        return members.count();
     }
 
     [[nodiscard]] metric_group_set_t metric_group_set_t::set_union(metric_group_set_t const & rhs) const
     {
-        bool const my_all = all || rhs.all;
-        if (my_all) {
-            return metric_group_set_t {true};
-        }
+        return metric_group_set_t {members | rhs.members};
+    }
 
-        std::set<metric_group_id_t> const & lhs_members = members;
-        std::set<metric_group_id_t> const & rhs_members = rhs.members;
-        std::set<metric_group_id_t> unified {};
-        std::set_union(lhs_members.begin(),
-                       lhs_members.end(),
-                       rhs_members.begin(),
-                       rhs_members.end(),
-                       std::inserter(unified, unified.begin()));
+    [[nodiscard]] metric_group_set_t metric_group_set_t::set_intersection(metric_group_set_t const & rhs) const
+    {
+        return metric_group_set_t {members & rhs.members};
+    }
 
-        return metric_group_set_t {std::move(unified)};
+    [[nodiscard]] metric_group_set_t metric_group_set_t::set_difference(metric_group_set_t const & rhs) const
+    {
+        return metric_group_set_t {members & ~rhs.members};
     }
 
     bool operator==(metric_group_set_t const & lhs, metric_group_set_t const & rhs)
     {
-        return lhs.all == rhs.all && lhs.members == rhs.members;
+        return lhs.members == rhs.members;
     }
 
 }
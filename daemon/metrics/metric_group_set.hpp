@@ -1,23 +1,27 @@
-/* Copyright (C) 2024 by Arm Limited. All rights reserved. */
+/* Copyright (C) 2024-2025 by Arm Limited. All rights reserved. */
 
 #pragma once
 
 #include "metrics/definitions.hpp"
 
-#include <set>
-#include <utility>
+#include <bitset>
+#include <cstddef>
+#include <initializer_list>
 namespace metrics {
 
     /** Represents an immutable set of metric groups.
-        Since the actual list of metric_group_id_t enums is expected
-        to be added to, this object caters for the set of 'all'
-        metric_group_id_ts specially, so that there doesn't have to be
-        a hardcoded array/list/set of all metric_group_id_t somewhere in gator. */
+        Membership is stored as a bitset indexed by metric_group_id_t, sized from
+        metric_group_id_t::count, so the set of 'all' metric_group_id_ts grows with
+        the enum and there doesn't have to be a hardcoded array/list/set of all
+        metric_group_id_t somewhere in gator. */
     class metric_group_set_t {
     public:
+        /** The number of distinct metric groups */
+        static constexpr std::size_t max_members = std::size_t(metric_group_id_t::count);
+
         metric_group_set_t() = default;
-        metric_group_set_t(std::set<metric_group_id_t> members) : members {std::move(members)} {}
-        metric_group_set_t(bool represents_all) : all {represents_all} {}
+        metric_group_set_t(std::initializer_list<metric_group_id_t> members);
+        metric_group_set_t(bool represents_all);
 
         metric_group_set_t(metric_group_set_t const &) = default;
         metric_group_set_t(metric_group_set_t &&) = default;
@@ -33,6 +37,15 @@ namespace metrics {
          */
         [[nodiscard]] bool has_member(metric_group_id_t item) const;
 
+        /**
+         * @brief True if this set and the parameter have at least one member in common.
+         *
+         * @param rhs the other metric_group_set_t to test against.
+         * @return true if the intersection of the two sets is not empty
+         * @return false otherwise
+         */
+        [[nodiscard]] bool intersects(metric_group_set_t const & rhs) const;
+
         /**
          * @brief Compute the union of this set and the parameter.
          *
@@ -41,6 +54,22 @@ namespace metrics {
          */
         [[nodiscard]] metric_group_set_t set_union(metric_group_set_t const & rhs) const;
 
+        /**
+         * @brief Compute the intersection of this set and the parameter.
+         *
+         * @param rhs the other metric_group_set_t to compute the intersection with.
+         * @return metric_group_set_t the members that are in both sets.
+         */
+        [[nodiscard]] metric_group_set_t set_intersection(metric_group_set_t const & rhs) const;
+
+        /**
+         * @brief Compute the difference of this set and the parameter.
+         *
+         * @param rhs the metric_group_set_t whose members are to be removed.
+         * @return metric_group_set_t the members of this set that are not in rhs.
+         */
+        [[nodiscard]] metric_group_set_t set_difference(metric_group_set_t const & rhs) const;
+
         /**
          * @brief True if metrics group set is empty.
          *
@@ -49,13 +78,21 @@ namespace metrics {
          */
         [[nodiscard]] bool empty() const;
 
+        /**
+         * @brief The number of metric groups in the set.
+         */
+        [[nodiscard]] std::size_t size() const;
+
         ~metric_group_set_t() = default;
 
         friend bool operator==(metric_group_set_t const & lhs, metric_group_set_t const & rhs);
 
     private:
-        bool all {false};
-        std::set<metric_group_id_t> members {};
+        using bits_t = std::bitset<max_members>;
+
+        bits_t members {};
+
+        explicit metric_group_set_t(bits_t members) : members {members} {}
     };
 
 }